@@ -8,6 +8,7 @@
 #include "ft2_gfxdata.h"
 #include "ft2_pattern_ed.h" // exitPatternEditorExtended()
 #include "ft2_config.h"
+#include "ft2_about.h"
 
 #define OLD_NUM_STARS 1000
 #define NUM_STARS 1500
@@ -63,6 +64,7 @@ static oldRotate_t oldStarRotation;
 static oldMatrix_t oldStarMatrix;
 static vector_t starPoints[NUM_STARS], starRotation;
 static matrix_t starMatrix;
+static uint32_t aboutBuffer[ABOUT_SCREEN_W * ABOUT_SCREEN_H]; // true-color layer for the new about screen
 
 // exact Turbo Pascal Random() implementation
 static int32_t Random(int32_t limit)
@@ -87,7 +89,7 @@ static uint32_t blendPixels(uint32_t pixelA, uint32_t pixelB, uint16_t alpha)
 
 static void blendPixelsXY(uint32_t x, uint32_t y, uint32_t pixelB_r, uint32_t pixelB_g, uint32_t pixelB_b, uint16_t alpha)
 {
-	uint32_t *p = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint32_t *p = &aboutBuffer[(y * ABOUT_SCREEN_W) + x];
 	const uint32_t pixelA = *p;
 
 	const uint16_t invAlpha = alpha ^ 0xFFFF;
@@ -166,19 +168,19 @@ static void starfield(void)
 		// plot and blend sides of star (basic shine effect)
 
 		if (outX-1 >= ABOUT_SCREEN_X)
-			blendPixelsXY(outX-1, outY, r, g, b, starShineAlpha16);
+			blendPixelsXY(outX-1-ABOUT_SCREEN_X, outY-ABOUT_SCREEN_Y, r, g, b, starShineAlpha16);
 
 		if (outX+1 < ABOUT_SCREEN_X+ABOUT_SCREEN_W)
-			blendPixelsXY(outX+1, outY, r, g, b, starShineAlpha16);
+			blendPixelsXY(outX+1-ABOUT_SCREEN_X, outY-ABOUT_SCREEN_Y, r, g, b, starShineAlpha16);
 
 		if (outY-1 >= ABOUT_SCREEN_Y)
-			blendPixelsXY(outX, outY-1, r, g, b, starShineAlpha16);
+			blendPixelsXY(outX-ABOUT_SCREEN_X, outY-1-ABOUT_SCREEN_Y, r, g, b, starShineAlpha16);
 
 		if (outY+1 < ABOUT_SCREEN_Y+ABOUT_SCREEN_H)
-			blendPixelsXY(outX, outY+1, r, g, b, starShineAlpha16);
+			blendPixelsXY(outX-ABOUT_SCREEN_X, outY+1-ABOUT_SCREEN_Y, r, g, b, starShineAlpha16);
 
 		// plot center pixel
-		video.frameBuffer[(outY * SCREEN_W) + outX] = RGB32(r, g, b);
+		aboutBuffer[((outY - ABOUT_SCREEN_Y) * ABOUT_SCREEN_W) + (outX - ABOUT_SCREEN_X)] = RGB32(r, g, b);
 	}
 }
 
@@ -191,7 +193,7 @@ static void oldStarfield(void)
 		int32_t screenBufferPos = lastStarScreenPos[i];
 		if (screenBufferPos >= 0)
 		{
-			video.frameBuffer[screenBufferPos] = video.palette[PAL_BCKGRND];
+			video.frameBuffer[screenBufferPos] = PAL_BCKGRND;
 			lastStarScreenPos[i] = -1;
 		}
 
@@ -211,12 +213,12 @@ static void oldStarfield(void)
 
 		// render star pixel only if the pixel under it is the background color
 		screenBufferPos = ((y + 4) * SCREEN_W) + (x + 4);
-		if ((video.frameBuffer[screenBufferPos] >> 24) == PAL_BCKGRND)
+		if (video.frameBuffer[screenBufferPos] == PAL_BCKGRND)
 		{
 			const uint8_t col = ((uint8_t)~(z >> 8) >> 3) - (22 - 8);
 			if (col < 24)
 			{
-				video.frameBuffer[screenBufferPos] = video.palette[starColConv[col]];
+				video.frameBuffer[screenBufferPos] = starColConv[col];
 				lastStarScreenPos[i] = screenBufferPos;
 			}
 		}
@@ -259,7 +261,15 @@ void renderAboutScreenFrame(void)
 {
 	if (config.useNewAboutScreen)
 	{
-		clearRect(ABOUT_SCREEN_X, ABOUT_SCREEN_Y, ABOUT_SCREEN_W, ABOUT_SCREEN_H);
+		/* The starfield and logo are blended in true color, so they are drawn to
+		** their own buffer and shown through the PAL_TRUECOL pixels. The texts and
+		** the exit button are drawn on top as normal (palette index) pixels.
+		*/
+		fillRect(ABOUT_SCREEN_X, ABOUT_SCREEN_Y, ABOUT_SCREEN_W, ABOUT_SCREEN_H, PAL_TRUECOL);
+
+		const uint32_t bgColor = video.palette[PAL_BCKGRND] & 0xFFFFFF;
+		for (int32_t i = 0; i < ABOUT_SCREEN_W*ABOUT_SCREEN_H; i++)
+			aboutBuffer[i] = bgColor;
 
 		// 3D starfield
 
@@ -271,8 +281,8 @@ void renderAboutScreenFrame(void)
 
 		// waving FT2 logo
 	
-		uint32_t *dstPtr = video.frameBuffer + (ABOUT_SCREEN_Y * SCREEN_W) + ABOUT_SCREEN_X;
-		for (int32_t y = 0; y < ABOUT_SCREEN_H; y++, dstPtr += SCREEN_W)
+		uint32_t *dstPtr = aboutBuffer;
+		for (int32_t y = 0; y < ABOUT_SCREEN_H; y++, dstPtr += ABOUT_SCREEN_W)
 		{
 			for (int32_t x = 0; x < ABOUT_SCREEN_W; x++)
 			{
@@ -319,6 +329,20 @@ static inline int32_t Sqr(int32_t x)
 
 void showAboutScreen(void) // called once when about screen is opened
 {
+	static bool aboutScreenInitialized;
+
+	if (!aboutScreenInitialized) // not needed at startup, done on first use
+	{
+		if (!loadAboutScreenBMPs())
+		{
+			okBox(0, "System message", "Not enough memory!", NULL);
+			return;
+		}
+
+		initAboutScreen();
+		aboutScreenInitialized = true;
+	}
+
 	if (ui.extendedPatternEditor)
 		exitPatternEditorExtended();
 
@@ -329,6 +353,9 @@ void showAboutScreen(void) // called once when about screen is opened
 
 	showPushButton(PB_EXIT_ABOUT);
 
+	if (config.useNewAboutScreen)
+		setTrueColorLayer(aboutBuffer, ABOUT_SCREEN_X, ABOUT_SCREEN_Y, ABOUT_SCREEN_W, ABOUT_SCREEN_H);
+
 	if (!config.useNewAboutScreen)
 	{
 		oldVector_t *s = oldStarPoints;
@@ -446,6 +473,7 @@ void initAboutScreen(void)
 
 void hideAboutScreen(void)
 {
+	setTrueColorLayer(NULL, 0, 0, 0, 0);
 	hidePushButton(PB_EXIT_ABOUT);
 	ui.aboutScreenShown = false;
 }
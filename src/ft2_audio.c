@@ -15,6 +15,7 @@
 #include "ft2_tables.h"
 #include "ft2_structs.h"
 #include "ft2_audioselector.h"
+#include "ft2_smp_preview.h"
 #include "mixer/ft2_mix.h"
 #include "mixer/ft2_silence_mix.h"
 
@@ -27,7 +28,18 @@ static int32_t smpShiftValue;
 static uint32_t oldAudioFreq, tickTimeLenInt;
 static uint64_t tickTimeLenFrac;
 static float fAudioNormalizeMul, fSqrtPanningTable[256+1];
-static voice_t voice[MAX_CHANNELS * 2];
+static voice_t voice[MAX_VOICES]; // channel voices, then the fade-out voice pool
+
+/* Voices that may be sounding, in mixing order (channel voice, then its fade-out voices).
+** Voices are added when they get activated, and removed by the mixer once they're inactive.
+*/
+static bool voiceListed[MAX_VOICES];
+static uint8_t activeVoiceList[MAX_VOICES], fadeOutVoiceCh[MAX_FADEOUT_VOICES];
+static int32_t numActiveVoices, numFadeOutVoices = DEFAULT_FADEOUT_VOICES;
+
+// tick length used for volume ramps (not read from 'audio' directly, the pipelined WAV renderer sets its own)
+static uint32_t rampSamplesPerTick;
+static float fRampSamplesPerTickMul;
 
 // globalized
 audio_t audio;
@@ -45,11 +57,22 @@ void stopVoice(int32_t i)
 	memset(v, 0, sizeof (voice_t));
 	v->panning = 128;
 
-	// clear "fade out" voice too
+	// clear the channel's "fade out" voices too
 
-	v = &voice[MAX_CHANNELS + i];
-	memset(v, 0, sizeof (voice_t));
-	v->panning = 128;
+	v = &voice[MAX_CHANNELS];
+	for (int32_t j = 0; j < numFadeOutVoices; j++, v++)
+	{
+		if (fadeOutVoiceCh[j] == i)
+		{
+			memset(v, 0, sizeof (voice_t));
+			v->panning = 128;
+		}
+	}
+}
+
+void setNumFadeOutVoices(int32_t numVoices) // only call this before the audio is started
+{
+	numFadeOutVoices = CLAMP(numVoices, MIN_FADEOUT_VOICES, MAX_FADEOUT_VOICES);
 }
 
 bool setNewAudioSettings(void) // only call this from the main input/video thread
@@ -216,6 +239,84 @@ void calcPanningTable(void)
 		fSqrtPanningTable[i] = (float)sqrt(i / 256.0);
 }
 
+static int32_t getVoiceMixOrder(int32_t voiceNum)
+{
+	if (voiceNum >= MAX_CHANNELS)
+		return (fadeOutVoiceCh[voiceNum - MAX_CHANNELS] << 1) + 1; // fade-out voice
+	else
+		return voiceNum << 1;
+}
+
+static void addToActiveVoiceList(int32_t voiceNum) // audio must be locked
+{
+	if (voiceListed[voiceNum])
+		return;
+
+	voiceListed[voiceNum] = true;
+
+	// insertion sort, to keep the original mixing order (affects floating-point rounding)
+	const int32_t order = getVoiceMixOrder(voiceNum);
+
+	int32_t i = numActiveVoices++;
+	for (; i > 0 && getVoiceMixOrder(activeVoiceList[i-1]) > order; i--)
+		activeVoiceList[i] = activeVoiceList[i-1];
+
+	activeVoiceList[i] = (uint8_t)voiceNum;
+}
+
+static void removeFromActiveVoiceList(int32_t voiceNum) // audio must be locked
+{
+	if (!voiceListed[voiceNum])
+		return;
+
+	voiceListed[voiceNum] = false;
+
+	int32_t numListed = 0;
+	for (int32_t i = 0; i < numActiveVoices; i++)
+	{
+		if (activeVoiceList[i] != voiceNum)
+			activeVoiceList[numListed++] = activeVoiceList[i];
+	}
+	numActiveVoices = numListed;
+}
+
+static voice_t *allocateFadeOutVoice(int32_t ch) // audio must be locked
+{
+	int32_t voiceNum = -1;
+
+	// find a free voice (one that the mixer has dropped from the active list)
+	for (int32_t i = 0; i < numFadeOutVoices; i++)
+	{
+		if (!voiceListed[MAX_CHANNELS+i])
+		{
+			voiceNum = MAX_CHANNELS+i;
+			break;
+		}
+	}
+
+	if (voiceNum == -1)
+	{
+		// pool is full, steal the voice with the least fade-out left (a stopped voice counts as done)
+		uint32_t minRampLength = UINT32_MAX;
+		for (int32_t i = 0; i < numFadeOutVoices; i++)
+		{
+			const voice_t *f = &voice[MAX_CHANNELS+i];
+
+			const uint32_t rampLength = f->active ? f->volumeRampLength : 0;
+			if (rampLength < minRampLength)
+			{
+				minRampLength = rampLength;
+				voiceNum = MAX_CHANNELS+i;
+			}
+		}
+
+		removeFromActiveVoiceList(voiceNum);
+	}
+
+	fadeOutVoiceCh[voiceNum - MAX_CHANNELS] = (uint8_t)ch;
+	return &voice[voiceNum];
+}
+
 static void voiceUpdateVolumes(int32_t i, uint8_t status)
 {
 	voice_t *v = &voice[i];
@@ -244,7 +345,7 @@ static void voiceUpdateVolumes(int32_t i, uint8_t status)
 		{
 			// setup fadeout voice
 
-			voice_t *f = &voice[MAX_CHANNELS+i];
+			voice_t *f = allocateFadeOutVoice(i);
 
 			*f = *v; // copy current voice to new fadeout-ramp voice
 
@@ -256,6 +357,9 @@ static void voiceUpdateVolumes(int32_t i, uint8_t status)
 			f->fVolumeRDelta = fVolumeRDiff * audio.fQuickVolRampSamplesMul;
 
 			f->isFadeOutVoice = true;
+
+			if (f->active)
+				addToActiveVoiceList((int32_t)(f - voice));
 		}
 
 		// make current voice fade in from zero when it starts
@@ -279,8 +383,8 @@ static void voiceUpdateVolumes(int32_t i, uint8_t status)
 		}
 		else // duration of a tick
 		{
-			v->volumeRampLength = audio.samplesPerTickInt;
-			fRampLengthMul = audio.fSamplesPerTickIntMul;
+			v->volumeRampLength = rampSamplesPerTick;
+			fRampLengthMul = fRampSamplesPerTickMul;
 		}
 
 		v->fVolumeLDelta = fVolumeLDiff * fRampLengthMul;
@@ -288,10 +392,9 @@ static void voiceUpdateVolumes(int32_t i, uint8_t status)
 	}
 }
 
-static void voiceTrigger(int32_t ch, sample_t *s, int32_t position)
+// sets up v for sampling s from position, returns false if the voice can't play (v->active is left alone)
+static bool setVoiceSample(voice_t *v, const sample_t *s, int32_t position)
 {
-	voice_t *v = &voice[ch];
-
 	int32_t length = s->length;
 	int32_t loopStart = s->loopStart;
 	int32_t loopLength = s->loopLength;
@@ -300,10 +403,7 @@ static void voiceTrigger(int32_t ch, sample_t *s, int32_t position)
 	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
 	if (s->dataPtr == NULL || length < 1)
-	{
-		v->active = false; // shut down voice (illegal parameters)
-		return;
-	}
+		return false; // illegal parameters
 
 	if (loopLength < 1) // disable loop if loopLength is below 1
 		loopType = 0;
@@ -332,15 +432,137 @@ static void voiceTrigger(int32_t ch, sample_t *s, int32_t position)
 
 	// if position overflows, shut down voice (f.ex. through 9xx command)
 	if (v->position >= v->sampleEnd)
+		return false;
+
+	v->mixFuncOffset = ((int32_t)sample16Bit * 18) + (audio.interpolationType * 3) + loopType;
+	return true;
+}
+
+static void setVoiceDelta(voice_t *v, uint16_t period)
+{
+	const double dVoiceHz = dPeriod2Hz(period);
+
+	// set voice delta
+	v->delta = (int64_t)((dVoiceHz * audio.dHz2MixDeltaMul) + 0.5); // Hz -> fixed-point delta (rounded)
+	if (audio.sincInterpolation)
 	{
-		v->active = false;
+		// decide which sinc LUT to use according to the resampling ratio
+		if (v->delta <= sincRatio1)
+			v->fSincLUT = fSinc_1;
+		else if (v->delta <= sincRatio2)
+			v->fSincLUT = fSinc_2;
+		else
+			v->fSincLUT = fSinc_3;
+	}
+}
+
+static void voiceTrigger(int32_t ch, sample_t *s, int32_t position)
+{
+	voice_t *v = &voice[ch];
+
+	if (!setVoiceSample(v, s, position))
+	{
+		v->active = false; // shut down voice
 		return;
 	}
 
-	v->mixFuncOffset = ((int32_t)sample16Bit * 18) + (audio.interpolationType * 3) + loopType;
+	v->active = true;
+	addToActiveVoiceList(ch);
+}
+
+/* Replayer snapshots/seeking: the replayer dry-run advances its own voices
+** with dryRunVoiceTick() (same tick lengths and position math as the mixer,
+** nothing is mixed), so a seek can continue with the exact sampling state.
+*/
+
+void storeVoiceSnapshot(const voice_t *v, snapshotVoice_t *sv)
+{
+	memset(sv, 0, sizeof (snapshotVoice_t));
+
+	sv->fVolume = v->fVolume;
+	sv->panning = v->panning;
+
+	if (v->active)
+	{
+		sv->active = true;
+		sv->samplingBackwards = v->samplingBackwards;
+		sv->hasLooped = v->hasLooped;
+		sv->position = v->position;
+		sv->positionFrac = v->positionFrac;
+	}
+}
+
+void getVoiceSnapshot(int32_t i, snapshotVoice_t *sv) // audio must be locked
+{
+	storeVoiceSnapshot(&voice[i], sv);
+}
+
+void loadVoiceSnapshot(voice_t *v, const sample_t *s, const snapshotVoice_t *sv, uint16_t period)
+{
+	memset(v, 0, sizeof (voice_t));
+	v->fVolume = sv->fVolume;
+	v->panning = sv->panning;
+
+	if (!sv->active || s == NULL || !setVoiceSample(v, s, sv->position))
+		return; // voice is not active
+
+	v->samplingBackwards = sv->samplingBackwards;
+	v->hasLooped = sv->hasLooped;
+	v->positionFrac = sv->positionFrac;
+	setVoiceDelta(v, period);
 	v->active = true;
 }
 
+void dryRunVoiceTick(voice_t *v, channel_t *ch, uint32_t samplesToMix)
+{
+	const uint8_t status = ch->status;
+	ch->status = 0;
+
+	if (status & IS_Vol)
+		v->fVolume = ch->fFinalVol;
+
+	if (status & IS_Pan)
+		v->panning = ch->finalPan;
+
+	if (status & IS_Period)
+		setVoiceDelta(v, ch->finalPeriod);
+
+	if ((status & IS_Trigger) && ch->smpPtr != NULL)
+		v->active = setVoiceSample(v, ch->smpPtr, ch->smpStartPos);
+
+	if (v->active)
+		silenceMixRoutine(v, samplesToMix);
+}
+
+/* Continues mixer voice i from the dry-run voice v, as it was at the start
+** of a tick (no volume ramp pending). The voice must be stopped.
+*/
+void startVoiceFromDryRun(int32_t i, const voice_t *v)
+{
+	voice_t *mv = &voice[i];
+
+	*mv = *v;
+	mv->scopeVolume = (uint8_t)((mv->fVolume * (SCOPE_HEIGHT*(1<<2))) + 0.5f); // rounded
+	mv->fTargetVolumeL = mv->fCurrVolumeL = mv->fVolume * fSqrtPanningTable[256-mv->panning];
+	mv->fTargetVolumeR = mv->fCurrVolumeR = mv->fVolume * fSqrtPanningTable[    mv->panning];
+	mv->volumeRampLength = 0;
+
+	if (mv->active)
+		addToActiveVoiceList(i);
+}
+
+bool voicesUseSmpData(const int8_t *dataPtr) // audio must be locked
+{
+	for (int32_t i = 0; i < numActiveVoices; i++) // includes fade-out voices
+	{
+		const voice_t *v = &voice[activeVoiceList[i]];
+		if (v->active && (v->base8 == dataPtr || (const int8_t *)v->base16 == dataPtr))
+			return true;
+	}
+
+	return false;
+}
+
 void resetRampVolumes(void)
 {
 	voice_t *v = voice;
@@ -352,54 +574,90 @@ void resetRampVolumes(void)
 	}
 }
 
-void updateVoices(void)
+static void updateVoice(int32_t i, const voiceUpdate_t *u)
 {
-	channel_t *ch = channel;
-	voice_t *v = voice;
+	voice_t *v = &voice[i];
+	const uint8_t status = u->status;
 
-	for (int32_t i = 0; i < song.numChannels; i++, ch++, v++)
+	if (status & IS_Vol)
 	{
-		const uint8_t status = ch->tmpStatus = ch->status; // (tmpStatus is used for audio/video sync queue)
-		if (status == 0)
-			continue;
+		v->fVolume = u->fVolume;
 
-		ch->status = 0;
+		// set scope volume (scaled)
+		const int32_t scopeVolume = (int32_t)((u->fVolume * (SCOPE_HEIGHT*(1<<2))) + 0.5f); // rounded
+		v->scopeVolume = (uint8_t)scopeVolume;
+	}
 
-		if (status & IS_Vol)
-		{
-			v->fVolume = ch->fFinalVol;
+	if (status & IS_Pan)
+		v->panning = u->panning;
 
-			// set scope volume (scaled)
-			const int32_t scopeVolume = (int32_t)((ch->fFinalVol * (SCOPE_HEIGHT*(1<<2))) + 0.5f); // rounded
-			v->scopeVolume = (uint8_t)scopeVolume;
-		}
+	if (status & (IS_Vol + IS_Pan))
+		voiceUpdateVolumes(i, status);
 
-		if (status & IS_Pan)
-			v->panning = ch->finalPan;
+	if (status & IS_Period)
+		setVoiceDelta(v, u->period);
 
-		if (status & (IS_Vol + IS_Pan))
-			voiceUpdateVolumes(i, status);
+	if (status & IS_Trigger)
+		voiceTrigger(i, u->smpPtr, u->smpStartPos);
+}
 
-		if (status & IS_Period)
-		{
-			const double dVoiceHz = dPeriod2Hz(ch->finalPeriod);
+static void getVoiceUpdate(channel_t *ch, voiceUpdate_t *u)
+{
+	u->status = ch->tmpStatus = ch->status; // (tmpStatus is used for audio/video sync queue)
+	if (u->status == 0)
+		return;
 
-			// set voice delta
-			v->delta = (int64_t)((dVoiceHz * audio.dHz2MixDeltaMul) + 0.5); // Hz -> fixed-point delta (rounded)
-			if (audio.sincInterpolation)
-			{
-				// decide which sinc LUT to use according to the resampling ratio
-				if (v->delta <= sincRatio1)
-					v->fSincLUT = fSinc_1;
-				else if (v->delta <= sincRatio2)
-					v->fSincLUT = fSinc_2;
-				else
-					v->fSincLUT = fSinc_3;
-			}
-		}
+	ch->status = 0;
+
+	u->fVolume = ch->fFinalVol;
+	u->panning = ch->finalPan;
+	u->period = ch->finalPeriod;
+	u->smpPtr = ch->smpPtr;
+	u->smpStartPos = ch->smpStartPos;
+}
 
-		if (status & IS_Trigger)
-			voiceTrigger(i, ch->smpPtr, ch->smpStartPos);
+void updateVoices(void)
+{
+	voiceUpdate_t u;
+
+	rampSamplesPerTick = audio.samplesPerTickInt;
+	fRampSamplesPerTickMul = audio.fSamplesPerTickIntMul;
+
+	channel_t *ch = channel;
+	for (int32_t i = 0; i < song.numChannels; i++, ch++)
+	{
+		getVoiceUpdate(ch, &u);
+		if (u.status != 0)
+			updateVoice(i, &u);
+	}
+}
+
+void captureVoiceUpdates(tickUpdate_t *t)
+{
+	t->samplesPerTickInt = audio.samplesPerTickInt;
+	t->fSamplesPerTickIntMul = audio.fSamplesPerTickIntMul;
+
+	channel_t *ch = channel;
+	for (int32_t i = 0; i < song.numChannels; i++, ch++)
+		getVoiceUpdate(ch, &t->voices[i]);
+}
+
+void applyVoiceUpdates(const tickUpdate_t *t)
+{
+	if (!t->hasVoiceUpdates)
+		return; // music was paused
+
+	if (audio.volumeRampingFlag)
+		resetRampVolumes();
+
+	rampSamplesPerTick = t->samplesPerTickInt;
+	fRampSamplesPerTickMul = t->fSamplesPerTickIntMul;
+
+	const voiceUpdate_t *u = t->voices;
+	for (int32_t i = 0; i < song.numChannels; i++, u++)
+	{
+		if (u->status != 0)
+			updateVoice(i, u);
 	}
 }
 
@@ -440,25 +698,38 @@ static void sendSamples32BitFloatStereo(void *stream, uint32_t sampleBlockLength
 
 static void doChannelMixing(int32_t bufferPosition, int32_t samplesToMix)
 {
-	voice_t *v = voice; // normal voices
-	voice_t *r = &voice[MAX_CHANNELS]; // volume ramp fadeout-voices
-
 	const int32_t mixOffsetBias = 3 * NUM_INTERPOLATORS * 2; // 3 = loop types (off/fwd/bidi), 2 = bit depths (8-bit/16-bit)
 
-	for (int32_t i = 0; i < song.numChannels; i++, v++, r++)
+	int32_t numListed = 0;
+	for (int32_t i = 0; i < numActiveVoices; i++)
 	{
-		if (v->active)
+		const int32_t voiceNum = activeVoiceList[i];
+		voice_t *v = &voice[voiceNum];
+
+		const int32_t ch = (voiceNum >= MAX_CHANNELS) ? fadeOutVoiceCh[voiceNum - MAX_CHANNELS] : voiceNum;
+		if (v->active && ch < song.numChannels)
 		{
-			const bool volRampFlag = (v->volumeRampLength > 0);
-			if (!volRampFlag && v->fCurrVolumeL == 0.0f && v->fCurrVolumeR == 0.0f)
-				silenceMixRoutine(v, samplesToMix);
+			if (voiceNum >= MAX_CHANNELS) // volume ramp fadeout-voice
+			{
+				mixFuncTab[mixOffsetBias + v->mixFuncOffset](v, bufferPosition, samplesToMix);
+			}
 			else
-				mixFuncTab[((int32_t)volRampFlag * mixOffsetBias) + v->mixFuncOffset](v, bufferPosition, samplesToMix);
+			{
+				const bool volRampFlag = (v->volumeRampLength > 0);
+				if (!volRampFlag && v->fCurrVolumeL == 0.0f && v->fCurrVolumeR == 0.0f)
+					silenceMixRoutine(v, samplesToMix);
+				else
+					mixFuncTab[((int32_t)volRampFlag * mixOffsetBias) + v->mixFuncOffset](v, bufferPosition, samplesToMix);
+			}
 		}
 
-		if (r->active) // volume ramp fadeout-voice
-			mixFuncTab[mixOffsetBias + r->mixFuncOffset](r, bufferPosition, samplesToMix);
+		// drop voices that were stopped or have ended
+		if (v->active)
+			activeVoiceList[numListed++] = (uint8_t)voiceNum;
+		else
+			voiceListed[voiceNum] = false;
 	}
+	numActiveVoices = numListed;
 }
 
 // used for song-to-WAV renderer
@@ -762,6 +1033,7 @@ static void fillVisualsSyncBuffer(void)
 	syncedChannel_t *c = chSyncData.channels;
 	channel_t *s = channel;
 	voice_t *v = voice;
+	const bool getPianoKeys = songPlaying && ui.instEditorShown;
 
 	for (int32_t i = 0; i < song.numChannels; i++, c++, s++, v++)
 	{
@@ -773,7 +1045,7 @@ static void fillVisualsSyncBuffer(void)
 		c->smpStartPos = s->smpStartPos;
 
 		c->pianoNoteNum = 255; // no piano key
-		if (songPlaying && ui.instEditorShown && (c->status & IS_Period) && !s->keyOff)
+		if (getPianoKeys && (c->status & IS_Period) && !s->keyOff)
 		{
 			const int32_t note = getPianoKey(s->finalPeriod, s->finetune, s->relativeNote);
 			if (note >= 0 && note <= 95)
@@ -843,6 +1115,8 @@ static void SDLCALL audioCallback(void *userdata, Uint8 *stream, int len)
 		samplesLeft -= samplesToMix;
 	}
 
+	mixSmpPreview(audio.fMixBufferL, audio.fMixBufferR, len); // Disk Op. sample preview (if active)
+
 	if (config.specialFlags & BITDEPTH_16)
 		sendSamples16BitStereo(stream, len);
 	else
@@ -851,7 +1125,7 @@ static void SDLCALL audioCallback(void *userdata, Uint8 *stream, int len)
 	(void)userdata;
 }
 
-static bool setupAudioBuffers(void)
+bool setupAudioBuffers(void)
 {
 	const int32_t maxAudioFreq = MAX(MAX_AUDIO_FREQ, MAX_WAV_RENDER_FREQ);
 	int32_t maxSamplesPerTick = (int32_t)ceil(maxAudioFreq / (MIN_BPM / 2.5)) + 1;
@@ -865,7 +1139,7 @@ static bool setupAudioBuffers(void)
 	return true;
 }
 
-static void freeAudioBuffers(void)
+void freeAudioBuffers(void)
 {
 	if (audio.fMixBufferL != NULL)
 	{
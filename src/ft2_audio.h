@@ -18,6 +18,18 @@ enum
 
 #define MAX_AUDIO_DEVICES 99
 
+/* Mixer voices: one per channel, the rest is a pool of volume ramp fade-out voices (used
+** when a voice is retriggered while sounding), shared by all channels. A channel can have
+** several fade-outs going at once. If the pool is full, the fade-out voice closest to being
+** done is taken over. The pool is only used with volume ramping on. Its size is set with
+** "--fadeout-voices <32..224>" (default 32, one per channel like FT2). This doesn't change
+** the channel limit, songs still have at most MAX_CHANNELS (32) channels.
+*/
+#define MAX_VOICES 256 // voice numbers are stored as uint8_t
+#define MIN_FADEOUT_VOICES MAX_CHANNELS
+#define MAX_FADEOUT_VOICES (MAX_VOICES-MAX_CHANNELS)
+#define DEFAULT_FADEOUT_VOICES MAX_CHANNELS
+
 // more bits makes little sense here
 
 #define BPM_FRAC_BITS 52
@@ -74,6 +86,26 @@ typedef struct
 	float fVolume, fCurrVolumeL, fCurrVolumeR, fVolumeLDelta, fVolumeRDelta, fTargetVolumeL, fTargetVolumeR;
 } voice_t;
 
+// replayer -> voice parameters for one channel (what updateVoices() reads from channel_t)
+typedef struct voiceUpdate_t
+{
+	uint8_t status, panning;
+	uint16_t period;
+	int32_t smpStartPos;
+	float fVolume;
+	sample_t *smpPtr;
+} voiceUpdate_t;
+
+// one replayer tick, for the pipelined WAV renderer (replayer and mixer on separate threads)
+typedef struct tickUpdate_t
+{
+	bool endOfRender, hasVoiceUpdates;
+	uint32_t samplesToMix, samplesPerTickInt;
+	float fSamplesPerTickIntMul;
+	uint8_t pattNum, globalVolume, songPos, speed, row, BPM; // for the visuals, shown when the tick gets mixed
+	voiceUpdate_t voices[MAX_CHANNELS];
+} tickUpdate_t;
+
 #ifdef _MSC_VER
 #pragma pack(push)
 #pragma pack(1)
@@ -135,8 +167,17 @@ void setMixerBPM(int32_t bpm);
 void audioSetVolRamp(bool volRamp);
 void audioSetInterpolationType(uint8_t interpolationType);
 void stopVoice(int32_t i);
+void setNumFadeOutVoices(int32_t numVoices); // MIN_FADEOUT_VOICES..MAX_FADEOUT_VOICES, only before the audio is started
+void getVoiceSnapshot(int32_t i, snapshotVoice_t *sv);
+void storeVoiceSnapshot(const voice_t *v, snapshotVoice_t *sv);
+void loadVoiceSnapshot(voice_t *v, const sample_t *s, const snapshotVoice_t *sv, uint16_t period);
+void dryRunVoiceTick(voice_t *v, channel_t *ch, uint32_t samplesToMix); // advances v like the mixer would
+void startVoiceFromDryRun(int32_t i, const voice_t *v); // audio must be locked
+bool voicesUseSmpData(const int8_t *dataPtr); // audio must be locked
 bool setupAudio(bool showErrorMsg);
 void closeAudio(void);
+bool setupAudioBuffers(void); // mix buffers, also used without an audio device (render test)
+void freeAudioBuffers(void);
 void pauseAudio(void);
 void resumeAudio(void);
 bool setNewAudioSettings(void);
@@ -146,6 +187,8 @@ void lockMixerCallback(void);
 void unlockMixerCallback(void);
 void resetRampVolumes(void);
 void updateVoices(void);
+void captureVoiceUpdates(tickUpdate_t *t); // like updateVoices(), but into 't' (replayer thread)
+void applyVoiceUpdates(const tickUpdate_t *t); // mixer thread
 void mixReplayerTickToBuffer(uint32_t samplesToMix, void *stream, uint8_t bitDepth);
 
 // in ft2_audio.c
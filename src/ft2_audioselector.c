@@ -13,6 +13,8 @@
 #include "ft2_audioselector.h"
 #include "ft2_structs.h"
 
+static bool audioDeviceListsScanned;
+
 enum
 {
 	INPUT_DEVICE = 0,
@@ -393,10 +395,18 @@ void setToDefaultAudioInputDevice(void)
 	}
 }
 
+void scanAudioDevicesOnFirstUse(void) // the device lists are only needed by the audio config screen
+{
+	if (!audioDeviceListsScanned)
+		rescanAudioDevices();
+}
+
 void rescanAudioDevices(void)
 {
 	const bool listShown = (ui.configScreenShown && editor.currConfigScreen == CONFIG_SCREEN_AUDIO);
 
+	audioDeviceListsScanned = true;
+
 	freeAudioDeviceLists();
 
 	// GET AUDIO OUTPUT DEVICES
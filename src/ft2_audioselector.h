@@ -12,6 +12,7 @@ char *getAudioInputDeviceFromConfig(void);
 bool saveAudioDevicesToConfig(const char *inputString, const char *outputString);
 bool testAudioDeviceListsMouseDown(void);
 void rescanAudioDevices(void);
+void scanAudioDevicesOnFirstUse(void);
 void scrollAudInputDevListUp(void);
 void scrollAudInputDevListDown(void);
 void scrollAudOutputDevListUp(void);
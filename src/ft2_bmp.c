@@ -70,8 +70,8 @@ bool loadBMPs(void)
 {
 	memset(&bmp, 0, sizeof (bmp));
 
-	bmp.ft2OldAboutLogo = loadBMPTo4BitPal(ft2OldAboutLogoBMP);
-	bmp.ft2AboutLogo = loadBMPTo32Bit(ft2AboutLogoBMP);
+	// About screen and Nibbles graphics are not needed at startup, see loadAboutScreenBMPs()/loadNibblesBMPs()
+
 	bmp.buttonGfx = loadBMPTo1Bit(buttonGfxBMP);
 	bmp.font1 = loadBMPTo1Bit(font1BMP);
 	bmp.font2 = loadBMPTo1Bit(font2BMP);
@@ -83,8 +83,6 @@ bool loadBMPs(void)
 	bmp.ft2LogoBadges = loadBMPTo4BitPal(ft2LogoBadgesBMP);
 	bmp.ft2ByBadges = loadBMPTo4BitPal(ft2ByBadgesBMP);
 	bmp.midiLogo = loadBMPTo4BitPal(midiLogoBMP);
-	bmp.nibblesLogo = loadBMPTo4BitPal(nibblesLogoBMP);
-	bmp.nibblesStages = loadBMPTo4BitPal(nibblesStagesBMP);
 	bmp.loopPins = loadBMPTo4BitPal(loopPinsBMP);
 	bmp.mouseCursors = loadBMPTo4BitPal(mouseCursorsBMP);
 	bmp.mouseCursorBusyClock = loadBMPTo4BitPal(mouseCursorBusyClockBMP);
@@ -97,11 +95,10 @@ bool loadBMPs(void)
 	bmp.radiobuttonGfx = loadBMPTo4BitPal(radiobuttonGfxBMP);
 	bmp.checkboxGfx = loadBMPTo4BitPal(checkboxGfxBMP);
 
-	if (bmp.ft2OldAboutLogo == NULL || bmp.ft2AboutLogo == NULL || bmp.buttonGfx == NULL || bmp.font1 == NULL || bmp.font2 == NULL ||
+	if (bmp.buttonGfx == NULL || bmp.font1 == NULL || bmp.font2 == NULL ||
 		bmp.font3 == NULL || bmp.font4 == NULL || bmp.font6 == NULL || bmp.font7 == NULL ||
 		bmp.font8 == NULL || bmp.ft2LogoBadges == NULL || bmp.ft2ByBadges == NULL ||
-		bmp.midiLogo == NULL || bmp.nibblesLogo == NULL || bmp.nibblesStages == NULL ||
-		bmp.loopPins == NULL || bmp.mouseCursors == NULL || bmp.mouseCursorBusyClock == NULL ||
+		bmp.midiLogo == NULL || bmp.loopPins == NULL || bmp.mouseCursors == NULL || bmp.mouseCursorBusyClock == NULL ||
 		bmp.mouseCursorBusyGlass == NULL || bmp.whitePianoKeys == NULL || bmp.blackPianoKeys == NULL ||
 		bmp.vibratoWaveforms == NULL || bmp.scopeRec == NULL || bmp.scopeMute == NULL ||
 		bmp.radiobuttonGfx == NULL || bmp.checkboxGfx == NULL)
@@ -113,6 +110,28 @@ bool loadBMPs(void)
 	return true;
 }
 
+bool loadAboutScreenBMPs(void) // decoded on first use
+{
+	if (bmp.ft2OldAboutLogo == NULL)
+		bmp.ft2OldAboutLogo = loadBMPTo4BitPal(ft2OldAboutLogoBMP);
+
+	if (bmp.ft2AboutLogo == NULL)
+		bmp.ft2AboutLogo = loadBMPTo32Bit(ft2AboutLogoBMP);
+
+	return bmp.ft2OldAboutLogo != NULL && bmp.ft2AboutLogo != NULL;
+}
+
+bool loadNibblesBMPs(void) // decoded on first use
+{
+	if (bmp.nibblesLogo == NULL)
+		bmp.nibblesLogo = loadBMPTo4BitPal(nibblesLogoBMP);
+
+	if (bmp.nibblesStages == NULL)
+		bmp.nibblesStages = loadBMPTo4BitPal(nibblesStagesBMP);
+
+	return bmp.nibblesLogo != NULL && bmp.nibblesStages != NULL;
+}
+
 void freeBMPs(void)
 {
 	if (bmp.ft2OldAboutLogo != NULL) { free(bmp.ft2OldAboutLogo); bmp.ft2OldAboutLogo = NULL; }
@@ -307,6 +326,9 @@ static uint32_t *loadBMPTo32Bit(const uint8_t *src)
 	return outData;
 }
 
+/* 1-bit images are stored as byte masks (0x00/0xFF, not 0/1), so that
+** glyphBlit() can merge them into the framebuffer without branching.
+*/
 static uint8_t *loadBMPTo1Bit(const uint8_t *src) // supports 4-bit RLE only
 {
 	uint8_t palIdx, color, color2, *tmp8;
@@ -332,7 +354,7 @@ static uint8_t *loadBMPTo1Bit(const uint8_t *src) // supports 4-bit RLE only
 	memcpy(pal, &src[0x36], palEntries * sizeof (uint32_t));
 
 	// pre-fill image with first palette color
-	color = !!pal[0];
+	color = pal[0] ? 0xFF : 0x00;
 	for (i = 0; i < hdr->biWidth * hdr->biHeight; i++)
 		outData[i] = color;
 
@@ -379,12 +401,12 @@ static uint8_t *loadBMPTo1Bit(const uint8_t *src) // supports 4-bit RLE only
 					palIdx = *src8++;
 
 					CHECK_DST8_BOUNDARY_X
-					tmp8[x++] = !!pal[palIdx >> 4];
+					tmp8[x++] = pal[palIdx >> 4] ? 0xFF : 0x00;
 					
 					if (x < lineEnd)
 					{
 						CHECK_DST8_BOUNDARY_X
-						tmp8[x++] = !!pal[palIdx & 0xF];
+						tmp8[x++] = pal[palIdx & 0xF] ? 0xFF : 0x00;
 					}
 				}
 
@@ -397,8 +419,8 @@ static uint8_t *loadBMPTo1Bit(const uint8_t *src) // supports 4-bit RLE only
 			CHECK_SRC_BOUNDARY
 			palIdx = *src8++;
 
-			color = !!pal[palIdx >> 4];
-			color2 = !!pal[palIdx & 0x0F];
+			color = pal[palIdx >> 4] ? 0xFF : 0x00;
+			color2 = pal[palIdx & 0x0F] ? 0xFF : 0x00;
 
 			len = byte >> 1;
 			tmp8 = &dst8[y * hdr->biWidth];
@@ -16,4 +16,6 @@ typedef struct bmp_t
 extern bmp_t bmp; // ft2_bmp.c
 
 bool loadBMPs(void);
+bool loadAboutScreenBMPs(void);
+bool loadNibblesBMPs(void);
 void freeBMPs(void);
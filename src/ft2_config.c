@@ -187,7 +187,7 @@ static void loadConfigFromBuffer(bool defaults)
 	changeLogoType(config.id_FastLogo);
 	changeBadgeType(config.id_TritonProd);
 	ui.maxVisibleChannels = (uint8_t)(2 + ((config.ptnMaxChannels + 1) * 2));
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	updatePattFontPtrs();
 
 	unlockMixerCallback();
@@ -1139,6 +1139,7 @@ void showConfigScreen(void)
 			drawFramework(112,  16, AUDIO_SELECTORS_BOX_WIDTH+4, 69, FRAMEWORK_TYPE2);
 			drawFramework(112, 103, AUDIO_SELECTORS_BOX_WIDTH+4, 47, FRAMEWORK_TYPE2);
 
+			scanAudioDevicesOnFirstUse();
 			drawAudioOutputList();
 			drawAudioInputList();
 
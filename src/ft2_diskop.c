@@ -20,6 +20,10 @@
 #include <fts.h> // for fts_open() and stuff in recursiveDelete()
 #include <unistd.h>
 #include <dirent.h>
+#include <fcntl.h> // fstatat()
+#ifdef __linux__
+#include <sys/inotify.h>
+#endif
 #endif
 #include <wchar.h>
 #include <sys/stat.h>
@@ -39,6 +43,7 @@
 #include "ft2_video.h"
 #include "ft2_inst_ed.h"
 #include "ft2_structs.h"
+#include "ft2_smp_preview.h"
 
 // hide POSIX warnings for chdir()
 #ifdef _MSC_VER
@@ -46,6 +51,7 @@
 #endif
 
 #define FILENAME_TEXT_X 170
+#define FILESIZE_UNKNOWN (-2) // DirRec.filesize: not fetched yet (only the visible rows get stat()'ed)
 #define FILESIZE_TEXT_X 295
 #define DISKOP_MAX_DRIVE_BUTTONS 8
 
@@ -78,9 +84,14 @@ static char *modTmpFNameUTF8; // for window title
 static uint8_t FReq_Item;
 static bool FReq_ShowAllFiles, insPathSet, smpPathSet, patPathSet, trkPathSet, firstTimeOpeningDiskOp = true;
 static int32_t FReq_EntrySelected = -1, FReq_FileCount, FReq_DirPos, lastMouseY;
+static bool smpPreviewMode;
 static UNICHAR *FReq_CurPathU, *FReq_ModCurPathU, *FReq_InsCurPathU, *FReq_SmpCurPathU, *FReq_PatCurPathU, *FReq_TrkCurPathU;
 static DirRec *FReq_Buffer;
 static SDL_Thread *thread;
+static volatile bool dirReadInProgress;
+#ifdef __linux__
+static int32_t dirWatchFd = -1, dirWatchDesc = -1;
+#endif
 
 static void setDiskOpItem(uint8_t item);
 
@@ -276,6 +287,16 @@ static void freeDirRecBuffer(void)
 
 void freeDiskOp(void)
 {
+	stopSmpPreview();
+#ifdef __linux__
+	if (dirWatchFd != -1)
+	{
+		close(dirWatchFd);
+		dirWatchFd = -1;
+		dirWatchDesc = -1;
+	}
+#endif
+
 	if (editor.tmpFilenameU != NULL)
 	{
 		free(editor.tmpFilenameU);
@@ -1000,7 +1021,8 @@ static void diskOpSave(bool checkOverwrite)
 				return;
 			}
 
-			editor.diskOpReadDir = savePattern(fileNameU);
+			if (savePattern(fileNameU))
+				diskOp_DirContentsChanged();
 			free(fileNameU);
 		}
 		break;
@@ -1023,7 +1045,8 @@ static void diskOpSave(bool checkOverwrite)
 				return;
 			}
 
-			editor.diskOpReadDir = saveTrack(fileNameU);
+			if (saveTrack(fileNameU))
+				diskOp_DirContentsChanged();
 			free(fileNameU);
 		}
 		break;
@@ -1094,7 +1117,7 @@ static void fileListPressed(int32_t index)
 						if (!result)
 							okBox(0, "System message", "Couldn't delete folder: Access denied!", NULL);
 						else
-							editor.diskOpReadDir = true;
+							diskOp_DirContentsChanged();
 					}
 					else
 					{
@@ -1102,7 +1125,7 @@ static void fileListPressed(int32_t index)
 						if (!result)
 							okBox(0, "System message", "Couldn't delete file: Access denied!", NULL);
 						else
-							editor.diskOpReadDir = true;
+							diskOp_DirContentsChanged();
 					}
 				}
 			}
@@ -1142,7 +1165,7 @@ static void fileListPressed(int32_t index)
 					}
 					else
 					{
-						editor.diskOpReadDir = true;
+						diskOp_DirContentsChanged();
 					}
 				}
 			}
@@ -1151,6 +1174,20 @@ static void fileListPressed(int32_t index)
 	}
 }
 
+// right mouse button held on a file in "Sample" mode = audition it (streamed from disk)
+static void previewListEntry(int32_t index)
+{
+	const int32_t entryIndex = FReq_DirPos + index;
+	if (entryIndex < 0 || entryIndex >= FReq_FileCount)
+		return;
+
+	DirRec *dirEntry = &FReq_Buffer[entryIndex];
+	if (dirEntry->isDir)
+		stopSmpPreview();
+	else
+		startSmpPreview(dirEntry->nameU);
+}
+
 bool testDiskOpMouseDown(bool mouseHeldDlown)
 {
 	int32_t tmpEntry;
@@ -1168,11 +1205,16 @@ bool testDiskOpMouseDown(bool mouseHeldDlown)
 
 		if (mouse.x >= 169 && mouse.x <= 331 && mouse.y >= 4 && mouse.y <= 168)
 		{
+			smpPreviewMode = mouse.rightButtonPressed && FReq_Item == DISKOP_ITEM_SAMPLE && mouse.mode == MOUSE_MODE_NORMAL;
+
 			tmpEntry = (mouse.y - 4) / (FONT1_CHAR_H + 1);
 			if (tmpEntry >= 0 && tmpEntry < max)
 			{
 				FReq_EntrySelected = tmpEntry;
 				diskOp_DrawFilelist();
+
+				if (smpPreviewMode)
+					previewListEntry(tmpEntry);
 			}
 
 			mouse.lastUsedObjectType = OBJECT_DISKOPLIST;
@@ -1212,6 +1254,9 @@ bool testDiskOpMouseDown(bool mouseHeldDlown)
 	{
 		FReq_EntrySelected = tmpEntry;
 		diskOp_DrawFilelist();
+
+		if (smpPreviewMode)
+			previewListEntry(tmpEntry);
 	}
 
 	return true;
@@ -1219,6 +1264,21 @@ bool testDiskOpMouseDown(bool mouseHeldDlown)
 
 void testDiskOpMouseRelease(void)
 {
+	if (smpPreviewMode)
+	{
+		// releasing the right mouse button only ends the preview, it doesn't load the file
+		smpPreviewMode = false;
+		stopSmpPreview();
+
+		if (FReq_EntrySelected != -1)
+		{
+			FReq_EntrySelected = -1;
+			diskOp_DrawFilelist();
+		}
+
+		return;
+	}
+
 	if (ui.diskOpShown && FReq_EntrySelected != -1)
 	{
 		if (mouse.x >= 169 && mouse.x <= 329 && mouse.y >= 4 && mouse.y <= 168)
@@ -1367,18 +1427,56 @@ skipEntry:
 	return true;
 }
 
+#ifndef _WIN32
+/* Only the directory entry type is used here, so that we don't have to stat()
+** every file in big folders (very slow on network mounts). File sizes are
+** fetched later by getDirRecFilesize(), and only for the rows that are shown.
+*/
+static bool setDirRecFromDirent(DirRec *searchRec, struct dirent *fData)
+{
+	struct stat st;
+
+	searchRec->nameU = UNICHAR_STRDUP(fData->d_name);
+	if (searchRec->nameU == NULL)
+		return false;
+
+	searchRec->filesize = FILESIZE_UNKNOWN;
+
+#if defined(__sun) || defined(sun)
+	// no d_type
+	if (fstatat(dirfd(hFind), fData->d_name, &st, 0) == 0)
+		searchRec->isDir = ((st.st_mode & S_IFMT) == S_IFDIR) ? true : false;
+	else
+		searchRec->isDir = false;
+#else
+	searchRec->isDir = (fData->d_type == DT_DIR) ? true : false;
+
+	// the type is unknown (some filesystems) or a link, follow it to see if it's a directory
+	if (fData->d_type == DT_UNKNOWN || fData->d_type == DT_LNK)
+	{
+		if (fstatat(dirfd(hFind), fData->d_name, &st, 0) == 0 && (st.st_mode & S_IFMT) == S_IFDIR)
+			searchRec->isDir = true;
+	}
+#endif
+
+	return true;
+}
+#endif
+
+static int32_t getDirRecFilesize(DirRec *dirEntry)
+{
+	if (dirEntry->filesize == FILESIZE_UNKNOWN)
+		dirEntry->filesize = getFileSize(dirEntry->nameU); // we're chdir'd into the listed folder
+
+	return dirEntry->filesize;
+}
+
 static int8_t findFirst(DirRec *searchRec)
 {
 #ifdef _WIN32
 	WIN32_FIND_DATAW fData;
 #else
 	struct dirent *fData;
-	struct stat st;
-	int64_t fSize;
-#endif
-
-#if defined(__sun) || defined(sun)
-	struct stat s;
 #endif
 
 	searchRec->nameU = NULL; // this one must be initialized
@@ -1392,7 +1490,7 @@ static int8_t findFirst(DirRec *searchRec)
 	if (searchRec->nameU == NULL)
 		return LFF_SKIP;
 
-	searchRec->filesize = (fData.nFileSizeHigh > 0) ? -1 : fData.nFileSizeLow;
+	searchRec->filesize = (fData.nFileSizeHigh > 0 || fData.nFileSizeLow > INT32_MAX) ? -1 : fData.nFileSizeLow;
 	searchRec->isDir = (fData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? true : false;
 #else
 	hFind = opendir(".");
@@ -1403,47 +1501,10 @@ static int8_t findFirst(DirRec *searchRec)
 	if (fData == NULL)
 		return LFF_DONE;
 
-	searchRec->nameU = UNICHAR_STRDUP(fData->d_name);
-	if (searchRec->nameU == NULL)
+	if (!setDirRecFromDirent(searchRec, fData))
 		return LFF_SKIP;
-
-	searchRec->filesize = 0;
-
-#if defined(__sun) || defined(sun)
-	stat(fData->d_name, &s);
-	searchRec->isDir = (s.st_mode != S_IFDIR) ? true : false;
-#else
-	searchRec->isDir = (fData->d_type == DT_DIR) ? true : false;
 #endif
 
-#if defined(__sun) || defined(sun)
-	if (s.st_mode == S_IFLNK)
-#else
-	if (fData->d_type == DT_UNKNOWN || fData->d_type == DT_LNK)
-#endif
-	{
-		if (stat(fData->d_name, &st) == 0)
-		{
-			fSize = (int64_t)st.st_size;
-			searchRec->filesize = (fSize > INT32_MAX) ? -1 : (fSize & 0xFFFFFFFF);
-
-			if ((st.st_mode & S_IFMT) == S_IFDIR)
-				searchRec->isDir = true;
-		}
-	}
-	else if (!searchRec->isDir)
-	{
-		if (stat(fData->d_name, &st) == 0)
-		{
-			fSize = (int64_t)st.st_size;
-			searchRec->filesize = (fSize > INT32_MAX) ? -1 : (fSize & 0xFFFFFFFF);
-		}
-	}
-#endif
-
-	if (searchRec->filesize < -1)
-		searchRec->filesize = -1;
-
 	if (handleEntrySkip(searchRec->nameU, searchRec->isDir))
 	{
 		// skip file
@@ -1462,12 +1523,6 @@ static int8_t findNext(DirRec *searchRec)
 	WIN32_FIND_DATAW fData;
 #else
 	struct dirent *fData;
-	struct stat st;
-	int64_t fSize;
-#endif
-
-#if defined(__sun) || defined(sun)
-	struct stat s;
 #endif
 
 	searchRec->nameU = NULL; // important
@@ -1480,53 +1535,16 @@ static int8_t findNext(DirRec *searchRec)
 	if (searchRec->nameU == NULL)
 		return LFF_SKIP;
 
-	searchRec->filesize = (fData.nFileSizeHigh > 0) ? -1 : fData.nFileSizeLow;
+	searchRec->filesize = (fData.nFileSizeHigh > 0 || fData.nFileSizeLow > INT32_MAX) ? -1 : fData.nFileSizeLow;
 	searchRec->isDir = (fData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? true : false;
 #else
 	if (hFind == NULL || (fData = readdir(hFind)) == NULL)
 		return LFF_DONE;
 
-	searchRec->nameU = UNICHAR_STRDUP(fData->d_name);
-	if (searchRec->nameU == NULL)
+	if (!setDirRecFromDirent(searchRec, fData))
 		return LFF_SKIP;
-
-	searchRec->filesize = 0;
-
-#if defined(__sun) || defined(sun)
-	stat(fData->d_name, &s);
-	searchRec->isDir = (s.st_mode != S_IFDIR) ? true : false;
-#else
-	searchRec->isDir = (fData->d_type == DT_DIR) ? true : false;
-#endif
-
-#if defined(__sun) || defined(sun)
-	if (s.st_mode == S_IFLNK)
-#else
-	if (fData->d_type == DT_UNKNOWN || fData->d_type == DT_LNK)
-#endif
-	{
-		if (stat(fData->d_name, &st) == 0)
-		{
-			fSize = (int64_t)st.st_size;
-			searchRec->filesize = (fSize > INT32_MAX) ? -1 : (fSize & 0xFFFFFFFF);
-
-			if ((st.st_mode & S_IFMT) == S_IFDIR)
-				searchRec->isDir = true;
-		}
-	}
-	else if (!searchRec->isDir)
-	{
-		if (stat(fData->d_name, &st) == 0)
-		{
-			fSize = (int64_t)st.st_size;
-			searchRec->filesize = (fSize > INT32_MAX) ? -1 : (fSize & 0xFFFFFFFF);
-		}
-	}
 #endif
 
-	if (searchRec->filesize < -1)
-		searchRec->filesize = -1;
-
 	if (handleEntrySkip(searchRec->nameU, searchRec->isDir))
 	{
 		// skip file
@@ -1703,7 +1721,7 @@ static void printFormattedFilesize(uint16_t x, uint16_t y, uint32_t bufEntry)
 	char sizeStrBuffer[16];
 	int32_t printFilesize;
 
-	const int32_t filesize = FReq_Buffer[bufEntry].filesize;
+	const int32_t filesize = getDirRecFilesize(&FReq_Buffer[bufEntry]);
 	if (filesize == -1)
 	{
 		x += 6;
@@ -1899,6 +1917,7 @@ static DirRec *bufferCreateEmptyDir(void) // special case: creates a dir entry w
 static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 {
 	DirRec tmpBuffer;
+	int32_t bufferSize = 0;
 
 	FReq_DirPos = 0;
 
@@ -1911,7 +1930,8 @@ static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 	int8_t lastFindFileFlag = findFirst(&tmpBuffer);
 	if (lastFindFileFlag != LFF_DONE && lastFindFileFlag != LFF_SKIP)
 	{
-		FReq_Buffer = (DirRec *)malloc(sizeof (DirRec) * (FReq_FileCount+1));
+		bufferSize = 256;
+		FReq_Buffer = (DirRec *)malloc(sizeof (DirRec) * bufferSize);
 		if (FReq_Buffer == NULL)
 		{
 			findClose();
@@ -1924,6 +1944,7 @@ static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 			else
 				okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 
+			dirReadInProgress = false;
 			setMouseBusy(false);
 			return false;
 		}
@@ -1938,15 +1959,21 @@ static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 		lastFindFileFlag = findNext(&tmpBuffer);
 		if (lastFindFileFlag != LFF_DONE && lastFindFileFlag != LFF_SKIP)
 		{
-			DirRec *newPtr = (DirRec *)realloc(FReq_Buffer, sizeof (DirRec) * (FReq_FileCount + 1));
-			if (newPtr == NULL)
+			if (FReq_FileCount >= bufferSize) // grow in big steps, folders can have tens of thousands of files
 			{
-				freeDirRecBuffer();
-				okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
-				break;
-			}
+				bufferSize *= 2;
+
+				DirRec *newPtr = (DirRec *)realloc(FReq_Buffer, sizeof (DirRec) * bufferSize);
+				if (newPtr == NULL)
+				{
+					free(tmpBuffer.nameU);
+					freeDirRecBuffer();
+					okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+					break;
+				}
 
-			FReq_Buffer = newPtr;
+				FReq_Buffer = newPtr;
+			}
 
 			memcpy(&FReq_Buffer[FReq_FileCount], &tmpBuffer, sizeof (DirRec));
 			FReq_FileCount++;
@@ -1969,6 +1996,7 @@ static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 			okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 	}
 
+	dirReadInProgress = false;
 	editor.diskOpReadDone = true;
 	setMouseBusy(false);
 
@@ -1977,14 +2005,237 @@ static int32_t SDLCALL diskOp_ReadDirectoryThread(void *ptr)
 	(void)ptr;
 }
 
+/* Live update of the file list (Linux only, inotify).
+**
+** The current folder is watched, and files that are added, removed or renamed
+** there (by us or other programs) are inserted/removed in FReq_Buffer directly
+** instead of re-reading the whole folder. Changes on network mounts made by
+** other machines are not reported by the kernel, "Refresh" still does a full
+** re-read for that.
+*/
+
+#ifdef __linux__
+static int32_t findDirEntry(const UNICHAR *nameU)
+{
+	for (int32_t i = 0; i < FReq_FileCount; i++)
+	{
+		if (FReq_Buffer[i].nameU != NULL && !UNICHAR_STRCMP(FReq_Buffer[i].nameU, nameU))
+			return i;
+	}
+
+	return -1;
+}
+
+static bool insertDirEntry(const UNICHAR *nameU, bool isDir)
+{
+	struct stat st;
+
+	// links and the like don't get IN_ISDIR
+	if (!isDir && stat(nameU, &st) == 0 && (st.st_mode & S_IFMT) == S_IFDIR)
+		isDir = true;
+
+	const int32_t oldEntry = findDirEntry(nameU);
+	if (oldEntry != -1)
+	{
+		FReq_Buffer[oldEntry].isDir = isDir;
+		FReq_Buffer[oldEntry].filesize = FILESIZE_UNKNOWN;
+		return true;
+	}
+
+	if (handleEntrySkip((UNICHAR *)nameU, isDir))
+		return false;
+
+	UNICHAR *newNameU = UNICHAR_STRDUP(nameU);
+	if (newNameU == NULL)
+		return false;
+
+	DirRec *newPtr = (DirRec *)realloc(FReq_Buffer, sizeof (DirRec) * (FReq_FileCount + 1));
+	if (newPtr == NULL)
+	{
+		free(newNameU);
+		return false;
+	}
+
+	FReq_Buffer = newPtr;
+
+	const int32_t newEntry = FReq_FileCount++;
+	FReq_Buffer[newEntry].nameU = newNameU;
+	FReq_Buffer[newEntry].isDir = isDir;
+	FReq_Buffer[newEntry].filesize = FILESIZE_UNKNOWN;
+
+	// binary search for its place, using the same sort key as sortDirectory()
+	char *newKey = ach(newEntry);
+	if (newKey == NULL)
+		return true; // just leave it at the end
+
+	int32_t lo = 0, hi = newEntry;
+	while (lo < hi)
+	{
+		const int32_t mid = (lo + hi) >> 1;
+
+		char *midKey = ach(mid);
+		if (midKey == NULL)
+			break;
+
+		if (_stricmp(midKey, newKey) > 0)
+			hi = mid;
+		else
+			lo = mid + 1;
+
+		free(midKey);
+	}
+	free(newKey);
+
+	if (lo < newEntry)
+	{
+		DirRec tmpBuffer = FReq_Buffer[newEntry];
+		memmove(&FReq_Buffer[lo+1], &FReq_Buffer[lo], sizeof (DirRec) * (newEntry - lo));
+		FReq_Buffer[lo] = tmpBuffer;
+	}
+
+	return true;
+}
+
+static bool removeDirEntry(const UNICHAR *nameU)
+{
+	const int32_t entry = findDirEntry(nameU);
+	if (entry == -1)
+		return false;
+
+	free(FReq_Buffer[entry].nameU);
+
+	FReq_FileCount--;
+	memmove(&FReq_Buffer[entry], &FReq_Buffer[entry+1], sizeof (DirRec) * (FReq_FileCount - entry));
+
+	return true;
+}
+
+static bool invalidateDirEntrySize(const UNICHAR *nameU)
+{
+	const int32_t entry = findDirEntry(nameU);
+	if (entry == -1)
+		return false;
+
+	FReq_Buffer[entry].filesize = FILESIZE_UNKNOWN;
+	return true;
+}
+#endif
+
+static void startDirWatch(void)
+{
+#ifdef __linux__
+	if (dirWatchFd == -1)
+	{
+		dirWatchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (dirWatchFd == -1)
+			return; // no live updates, we'll just re-read the folder like before
+	}
+
+	if (dirWatchDesc != -1)
+		inotify_rm_watch(dirWatchFd, dirWatchDesc);
+
+	dirWatchDesc = inotify_add_watch(dirWatchFd, ".", IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+		IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR);
+#endif
+}
+
+// call after writing/deleting/renaming something in the Disk Op. folder (thread-safe)
+void diskOp_DirContentsChanged(void)
+{
+#ifdef __linux__
+	if (dirWatchDesc != -1)
+		return; // the folder watch will pick it up
+#endif
+
+	editor.diskOpReadDir = true;
+}
+
+void diskOp_HandleDirWatch(void)
+{
+#ifdef __linux__
+	char eventBuf[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+	if (dirWatchDesc == -1 || dirReadInProgress || FReq_Buffer == NULL)
+		return;
+
+	// don't change the list while the user is clicking in it (the events stay queued)
+	if (mouse.lastUsedObjectType == OBJECT_DISKOPLIST)
+		return;
+
+	bool listChanged = false;
+	while (true)
+	{
+		const ssize_t bytesRead = read(dirWatchFd, eventBuf, sizeof (eventBuf));
+		if (bytesRead <= 0)
+			break;
+
+		const struct inotify_event *ev;
+		for (char *ptr = eventBuf; ptr < eventBuf+bytesRead; ptr += sizeof (struct inotify_event) + ev->len)
+		{
+			ev = (const struct inotify_event *)ptr;
+
+			if (ev->mask & IN_Q_OVERFLOW)
+			{
+				editor.diskOpReadDir = true; // lost track, do a full re-read
+				return;
+			}
+
+			if (ev->wd != dirWatchDesc)
+				continue; // old event from the previous folder
+
+			if (ev->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED))
+			{
+				// the folder itself is gone
+				inotify_rm_watch(dirWatchFd, dirWatchDesc);
+				dirWatchDesc = -1;
+				editor.diskOpReadDir = true;
+				return;
+			}
+
+			if (ev->len == 0 || ev->name[0] == '\0')
+				continue;
+
+			if (ev->mask & (IN_CREATE | IN_MOVED_TO))
+				listChanged |= insertDirEntry(ev->name, (ev->mask & IN_ISDIR) ? true : false);
+			else if (ev->mask & (IN_DELETE | IN_MOVED_FROM))
+				listChanged |= removeDirEntry(ev->name);
+			else if (ev->mask & IN_CLOSE_WRITE)
+				listChanged |= invalidateDirEntrySize(ev->name);
+		}
+	}
+
+	if (!listChanged)
+		return;
+
+	FReq_EntrySelected = -1;
+
+	if (FReq_DirPos > FReq_FileCount-DISKOP_ENTRY_NUM)
+		FReq_DirPos = FReq_FileCount-DISKOP_ENTRY_NUM;
+
+	if (FReq_DirPos < 0)
+		FReq_DirPos = 0;
+
+	if (ui.diskOpShown)
+		diskOp_DrawDirectory();
+#endif
+}
+
 void diskOp_StartDirReadThread(void)
 {
 	editor.diskOpReadDone = false;
+	dirReadInProgress = true;
+
+	/* Start watching the new folder before it's read. Changes made while
+	** reading are then applied afterwards, and adding an entry that is
+	** already listed (or removing one that isn't) is harmless.
+	*/
+	startDirWatch();
 
 	mouseAnimOn();
 	thread = SDL_CreateThread(diskOp_ReadDirectoryThread, NULL, NULL);
 	if (thread == NULL)
 	{
+		dirReadInProgress = false;
 		editor.diskOpReadDone = true;
 		okBox(0, "System message", "Couldn't create thread!", NULL);
 		return;
@@ -2294,6 +2545,9 @@ void showDiskOpScreen(void)
 
 void hideDiskOpScreen(void)
 {
+	smpPreviewMode = false;
+	stopSmpPreview();
+
 #ifdef _WIN32
 	for (uint16_t i = 0; i < DISKOP_MAX_DRIVE_BUTTONS; i++)
 		hidePushButton(PB_DISKOP_DRIVE1 + i);
@@ -2413,7 +2667,7 @@ void pbDiskOpMakeDir(void)
 		}
 
 		if (makeDirAnsi(FReq_NameTemp))
-			editor.diskOpReadDir = true;
+			diskOp_DirContentsChanged();
 		else
 			okBox(0, "System message", "Couldn't create directory: Access denied, or a dir with the same name already exists!", NULL);
 	}
@@ -42,6 +42,8 @@ int32_t getExtOffset(char *s, int32_t stringLen); // get byte offset of file ext
 bool testDiskOpMouseDown(bool mouseHeldDown);
 void testDiskOpMouseRelease(void);
 void diskOp_StartDirReadThread(void);
+void diskOp_DirContentsChanged(void); // call after writing/deleting a file in the Disk Op. folder (thread-safe)
+void diskOp_HandleDirWatch(void); // applies folder changes to the file list (Linux), called every frame
 void diskOp_DrawFilelist(void);
 void diskOp_DrawDirectory(void);
 void showDiskOpScreen(void);
@@ -15,6 +15,7 @@
 #include "ft2_textboxes.h"
 #include "ft2_tables.h"
 #include "ft2_structs.h"
+#include "ft2_undo.h"
 
 enum
 {
@@ -53,10 +54,18 @@ static bool testNoteKeys(SDL_Scancode scancode)
 			int16_t row = editor.row;
 			resumeMusic();
 
+			undoPattSnap_t snap;
+			undoPattBegin(&snap, curPattern);
+
 			if (!allocatePattern(curPattern))
+			{
+				undoPattEnd(&snap);
 				return true; // key pressed
+			}
 
 			pattern[curPattern][(row * MAX_CHANNELS) + cursor.ch].note = NOTE_OFF;
+			pattUsageChanged(curPattern);
+			undoPattEnd(&snap);
 
 			const uint16_t numRows = patternNumRows[curPattern];
 			if (playMode == PLAYMODE_EDIT && numRows >= 1)
@@ -165,6 +174,9 @@ static bool testEditKeys(SDL_Scancode scancode, SDL_Keycode keycode)
 	if (i == -1 || !allocatePattern(curPattern))
 		return false; // no edit to be done
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	// insert slot data
 
 	note_t *p = &pattern[curPattern][(row * MAX_CHANNELS) + cursor.ch];
@@ -256,6 +268,8 @@ static bool testEditKeys(SDL_Scancode scancode, SDL_Keycode keycode)
 		default: break;
 	}
 
+	pattUsageChanged(curPattern);
+
 	// increase row (only in edit mode)
 
 	const int16_t numRows = patternNumRows[curPattern];
@@ -265,6 +279,8 @@ static bool testEditKeys(SDL_Scancode scancode, SDL_Keycode keycode)
 	if (i == 0) // if we inserted a zero, check if pattern is empty
 		killPatternIfUnused(curPattern);
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	return true;
 }
@@ -453,6 +469,9 @@ void recordNote(uint8_t noteNum, int8_t vol) // directly ported from the origina
 		{
 			if (allocatePattern(pattNum))
 			{
+				undoPattSnap_t snap;
+				undoPattBegin(&snap, pattNum);
+
 				const int16_t numRows = patternNumRows[pattNum];
 				p = &pattern[pattNum][(row * MAX_CHANNELS) + c];
 
@@ -480,6 +499,9 @@ void recordNote(uint8_t noteNum, int8_t vol) // directly ported from the origina
 					}
 				}
 
+				pattUsageChanged(pattNum);
+				undoPattEnd(&snap);
+
 				ui.updatePatternEditor = true;
 				setSongModifiedFlag();
 			}
@@ -513,6 +535,9 @@ void recordNote(uint8_t noteNum, int8_t vol) // directly ported from the origina
 		{
 			if (allocatePattern(pattNum))
 			{
+				undoPattSnap_t snap;
+				undoPattBegin(&snap, pattNum);
+
 				// insert data
 
 				int16_t numRows = patternNumRows[pattNum];
@@ -533,6 +558,7 @@ void recordNote(uint8_t noteNum, int8_t vol) // directly ported from the origina
 
 						pattNum = song.orders[songPos];
 						numRows = patternNumRows[pattNum];
+						undoPattAdd(&snap, pattNum);
 					}
 				}
 
@@ -555,6 +581,9 @@ void recordNote(uint8_t noteNum, int8_t vol) // directly ported from the origina
 					}
 				}
 
+				pattUsageChanged(pattNum);
+				undoPattEnd(&snap);
+
 				ui.updatePatternEditor = true;
 				setSongModifiedFlag();
 			}
@@ -579,6 +608,9 @@ bool handleEditKeys(SDL_Keycode keycode, SDL_Scancode scancode)
 		if (pattern[curPattern] == NULL)
 			return true;
 
+		undoPattSnap_t snap;
+		undoPattBegin(&snap, curPattern);
+
 		note_t *p = &pattern[curPattern][(row * MAX_CHANNELS) + cursor.ch];
 
 		if (keyb.leftShiftPressed)
@@ -615,6 +647,7 @@ bool handleEditKeys(SDL_Keycode keycode, SDL_Scancode scancode)
 		}
 
 		killPatternIfUnused(curPattern);
+		undoPattEnd(&snap);
 
 		// increase row (only in edit mode)
 		const int16_t numRows = patternNumRows[curPattern];
@@ -671,9 +704,15 @@ void writeFromMacroSlot(uint8_t slot)
 	if (!editmode && playMode != PLAYMODE_RECSONG && playMode != PLAYMODE_RECPATT)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	if (!allocatePattern(curPattern))
+	{
+		undoPattEnd(&snap);
 		return;
-	
+	}
+
 	note_t *p = &pattern[curPattern][(row * MAX_CHANNELS) + cursor.ch];
 	if (cursor.object == CURSOR_VOL1 || cursor.object == CURSOR_VOL2)
 	{
@@ -700,6 +739,7 @@ void writeFromMacroSlot(uint8_t slot)
 		setPos(-1, (row + editor.editRowSkip) % numRows, true);
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -720,6 +760,9 @@ void insertPatternNote(void)
 	if (p == NULL)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	const int16_t numRows = patternNumRows[curPattern];
 
 	if (numRows > 1)
@@ -731,6 +774,7 @@ void insertPatternNote(void)
 	memset(&p[(row * MAX_CHANNELS) + cursor.ch], 0, sizeof (note_t));
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -747,6 +791,9 @@ void insertPatternLine(void)
 	if (!editmode && playMode != PLAYMODE_RECPATT && playMode != PLAYMODE_RECSONG)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	setPatternLen(curPattern, patternNumRows[curPattern] + config.recTrueInsert); // config.recTrueInsert is 0 or 1
 
 	note_t *p = pattern[curPattern];
@@ -768,6 +815,8 @@ void insertPatternLine(void)
 		killPatternIfUnused(curPattern);
 	}
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -783,6 +832,9 @@ void deletePatternNote(void)
 	if (!editmode && playMode != PLAYMODE_RECPATT && playMode != PLAYMODE_RECSONG)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	const int16_t numRows = patternNumRows[curPattern];
 
 	note_t *p = pattern[curPattern];
@@ -809,6 +861,7 @@ void deletePatternNote(void)
 	}
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -825,6 +878,9 @@ void deletePatternLine(void)
 	if (!editmode && playMode != PLAYMODE_RECPATT && playMode != PLAYMODE_RECSONG)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	const int16_t numRows = patternNumRows[curPattern];
 	note_t *p = pattern[curPattern];
 	if (p != NULL)
@@ -856,6 +912,7 @@ void deletePatternLine(void)
 		setPatternLen(curPattern, numRows-1);
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1012,6 +1069,9 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 			if (p == NULL)
 				return;
 
+			undoPattSnap_t snap;
+			undoPattBegin(&snap, curPattern);
+
 			p += cursor.ch;
 
 			for (int32_t row = 0; row < numRows; row++, p += MAX_CHANNELS)
@@ -1026,6 +1086,8 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 					p->note = note;
 				}
 			}
+
+			undoPattEnd(&snap);
 		}
 		break;
 
@@ -1035,6 +1097,9 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 			if (p == NULL)
 				return;
 
+			undoPattSnap_t snap;
+			undoPattBegin(&snap, curPattern);
+
 			const int32_t pitch = MAX_CHANNELS - song.numChannels;
 			for (int32_t row = 0; row < numRows; row++, p += pitch)
 			{
@@ -1051,11 +1116,16 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 					}
 				}
 			}
+
+			undoPattEnd(&snap);
 		}
 		break;
 
 		case TRANSP_SONG:
 		{
+			undoPattSnap_t snap;
+			undoPattBegin(&snap, -1);
+
 			const int32_t pitch = MAX_CHANNELS - song.numChannels;
 			for (int32_t i = 0; i < MAX_PATTERNS; i++)
 			{
@@ -1079,6 +1149,8 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 					}
 				}
 			}
+
+			undoPattEnd(&snap);
 		}
 		break;
 
@@ -1106,6 +1178,9 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 			if (p == NULL || markX1 < 0 || markY1 < 0 || markX2 < 0 || markY2 < 0)
 				return;
 
+			undoPattSnap_t snap;
+			undoPattBegin(&snap, curPattern);
+
 			p += (markY1 * MAX_CHANNELS) + markX1;
 
 			const int32_t pitch = MAX_CHANNELS - ((markX2 + 1) - markX1);
@@ -1124,12 +1199,19 @@ static void doTranspose(uint8_t mode, int8_t addValue, bool allInstrumentsFlag)
 					}
 				}
 			}
+
+			undoPattEnd(&snap);
 		}
 		break;
 
 		default: break;
 	}
 
+	if (mode == TRANSP_SONG)
+		allPattUsageChanged();
+	else
+		pattUsageChanged(curPattern);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -1352,6 +1434,9 @@ void cutTrack(void)
 	if (p == NULL)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	const int16_t numRows = patternNumRows[curPattern];
 
 	if (config.ptnCutToBuffer)
@@ -1370,6 +1455,7 @@ void cutTrack(void)
 	resumeMusic();
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1399,6 +1485,9 @@ void pasteTrack(void)
 	if (trkBufLen == 0 || !allocatePattern(curPattern))
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	note_t *p = pattern[curPattern];
 	const int16_t numRows = patternNumRows[curPattern];
 
@@ -1408,6 +1497,7 @@ void pasteTrack(void)
 	resumeMusic();
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1421,6 +1511,9 @@ void cutPattern(void)
 	if (p == NULL)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	const int16_t numRows = patternNumRows[curPattern];
 
 	if (config.ptnCutToBuffer)
@@ -1445,6 +1538,7 @@ void cutPattern(void)
 	resumeMusic();
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1477,6 +1571,9 @@ void pastePattern(void)
 	if (ptnBufLen == 0)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	if (patternNumRows[curPattern] != ptnBufLen)
 	{
 		if (okBox(2, "System request", "Adjust pattern length to match copied pattern length?", NULL) == 1)
@@ -1484,7 +1581,10 @@ void pastePattern(void)
 	}
 
 	if (!allocatePattern(curPattern))
+	{
+		undoPattEnd(&snap);
 		return;
+	}
 
 	note_t *p = pattern[curPattern];
 	const int16_t numRows = patternNumRows[curPattern];
@@ -1498,6 +1598,7 @@ void pastePattern(void)
 	resumeMusic();
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1536,6 +1637,9 @@ void cutBlock(void)
 	note_t *p = pattern[curPattern];
 	if (p != NULL && markY1 >= 0 && markX1 >= 0 && markX2 >= 0 && markY2 >= 0)
 	{
+		undoPattSnap_t snap;
+		undoPattBegin(&snap, curPattern);
+
 		pauseMusic();
 		for (int32_t x = markX1; x <= markX2; x++)
 		{
@@ -1552,6 +1656,7 @@ void cutBlock(void)
 		resumeMusic();
 
 		killPatternIfUnused(curPattern);
+		undoPattEnd(&snap);
 
 		if (config.ptnCutToBuffer)
 		{
@@ -1620,6 +1725,9 @@ void pasteBlock(void)
 	if (!blockCopied || !allocatePattern(curPattern))
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	int32_t chStart = cursor.ch;
 	int32_t rowStart = curRow;
 	const int16_t numRows = patternNumRows[curPattern];
@@ -1652,6 +1760,7 @@ void pasteBlock(void)
 	}
 
 	killPatternIfUnused(curPattern);
+	undoPattEnd(&snap);
 
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
@@ -1690,6 +1799,8 @@ static void remapInstrXY(int32_t pattNum, int32_t x1, int32_t y1, int32_t x2, in
 				p->instr = dst;
 		}
 	}
+
+	pattUsageChanged((uint16_t)pattNum);
 }
 
 void remapBlock(void)
@@ -1705,12 +1816,17 @@ void remapBlock(void)
 	if (editor.srcInstr == editor.curInstr || markY1 == markY2 || markY1 > markY2)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	remapInstrXY(curPattern,
 	             markX1, markY1,
 	             markX2, markY2 - 1,
 	             editor.srcInstr, editor.curInstr);
 	resumeMusic();
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -1722,6 +1838,9 @@ void remapTrack(void)
 	if (editor.srcInstr == editor.curInstr)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	pauseMusic();
 	remapInstrXY(curPattern,
 	             cursor.ch, 0,
@@ -1729,6 +1848,8 @@ void remapTrack(void)
 	             editor.srcInstr, editor.curInstr);
 	resumeMusic();
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -1740,6 +1861,9 @@ void remapPattern(void)
 	if (editor.srcInstr == editor.curInstr)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	pauseMusic();
 	remapInstrXY(curPattern,
 	             0, 0,
@@ -1747,6 +1871,8 @@ void remapPattern(void)
 	             editor.srcInstr, editor.curInstr);
 	resumeMusic();
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -1756,6 +1882,9 @@ void remapSong(void)
 	if (editor.srcInstr == editor.curInstr)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, -1);
+
 	pauseMusic();
 	for (int32_t i = 0; i < MAX_PATTERNS; i++)
 	{
@@ -1767,6 +1896,8 @@ void remapSong(void)
 	}
 	resumeMusic();
 
+	undoPattEnd(&snap);
+
 	ui.updatePatternEditor = true;
 	setSongModifiedFlag();
 }
@@ -1835,6 +1966,7 @@ static void scaleNote(int32_t pattNum, int32_t ch, int32_t row, double dScale)
 		vol = (int32_t)((vol * dScale) + 0.5); // rounded
 		vol = MIN(MAX(0, vol), 64);
 		setNoteVolume(p, (int8_t)vol);
+		pattUsageChanged((uint16_t)pattNum);
 	}
 }
 
@@ -1886,6 +2018,9 @@ void scaleFadeVolumeTrack(void)
 
 	double dVol = dVolScaleFK1;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	pauseMusic();
 	for (int32_t row = 0; row < numRows; row++)
 	{
@@ -1893,6 +2028,8 @@ void scaleFadeVolumeTrack(void)
 		dVol += dVolDelta;
 	}
 	resumeMusic();
+
+	undoPattEnd(&snap);
 }
 
 void scaleFadeVolumePattern(void)
@@ -1913,6 +2050,9 @@ void scaleFadeVolumePattern(void)
 
 	double dVol = dVolScaleFK1;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	pauseMusic();
 	for (int32_t row = 0; row < numRows; row++)
 	{
@@ -1922,6 +2062,8 @@ void scaleFadeVolumePattern(void)
 		dVol += dVolDelta;
 	}
 	resumeMusic();
+
+	undoPattEnd(&snap);
 }
 
 void scaleFadeVolumeBlock(void)
@@ -1948,6 +2090,9 @@ void scaleFadeVolumeBlock(void)
 
 	double dVol = dVolScaleFK1;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	pauseMusic();
 	for (int32_t row = markY1; row < markY2; row++)
 	{
@@ -1957,6 +2102,8 @@ void scaleFadeVolumeBlock(void)
 		dVol += dVolDelta;
 	}
 	resumeMusic();
+
+	undoPattEnd(&snap);
 }
 
 void toggleCopyMaskEnable(void) { editor.copyMaskEnable ^= 1; }
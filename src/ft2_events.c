@@ -1,3 +1,7 @@
+#ifdef __linux__
+#define _GNU_SOURCE // struct ucred, accept4()
+#endif
+
 // for finding memory leaks in debug mode with Visual Studio
 #if defined _DEBUG && defined _MSC_VER
 #include <crtdbg.h>
@@ -12,6 +16,13 @@
 #include <signal.h>
 #include <unistd.h> // chdir()
 #endif
+#ifdef __linux__
+#include <stdlib.h> // realpath()
+#include <stddef.h> // offsetof()
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
 #include <stdio.h>
 #include <sys/stat.h>
 #include "ft2_header.h"
@@ -40,6 +51,11 @@
 
 static bool backupMadeAfterCrash;
 
+// files from a multi-file drag'n'drop, collected between SDL_DROPBEGIN and SDL_DROPCOMPLETE
+static bool dropInProgress;
+static char **droppedFiles;
+static int32_t numDroppedFiles;
+
 #ifdef _WIN32
 #define SYSMSG_FILE_ARG (WM_USER+1)
 #define ARGV_SHARED_MEM_MAX_LEN ((PATH_MAX+1) * sizeof (WCHAR))
@@ -50,6 +66,14 @@ static HANDLE oneInstHandle, hMapFile;
 static LPCTSTR sharedMemBuf;
 #endif
 
+#ifdef __linux__
+#define INSTANCE_MSG_MAX_LEN 65536 // max. total length of the file arguments sent to the first instance
+static int instanceSocket = -1, instanceClient = -1;
+static char *instanceMsgBuf;
+static size_t instanceMsgLen;
+static uint64_t instanceMsgTimeout64;
+#endif
+
 static void handleSDLEvents(void);
 
 void readInput(void)
@@ -89,6 +113,8 @@ void handleEvents(void)
 		trimThreadDone();
 	}
 
+	freeRetiredSmpData(); // old sample data from edits, once the voices and scopes are done with it
+
 	if (editor.updateCurSmp)
 	{
 		editor.updateCurSmp = false;
@@ -128,6 +154,8 @@ void handleEvents(void)
 			diskOp_DrawDirectory();
 	}
 
+	diskOp_HandleDirWatch();
+
 	handleLoadMusicEvents();
 
 	if (editor.samplingAudioFlag) handleSamplingUpdates();
@@ -378,11 +406,287 @@ void handleWaitVblQuirk(SDL_Event *event)
 	}
 }
 
+static void raiseWindowOnDrop(void)
+{
+	if (!video.fullscreen)
+	{
+		if (SDL_GetWindowFlags(video.window) & SDL_WINDOW_MINIMIZED)
+			SDL_RestoreWindow(video.window);
+
+		SDL_RaiseWindow(video.window);
+	}
+}
+
+#if !(SDL_MAJOR_VERSION == 2 && SDL_MINOR_VERSION == 0 && SDL_PATCHLEVEL < 5)
+static void freeDroppedFiles(void)
+{
+	for (int32_t i = 0; i < numDroppedFiles; i++)
+		SDL_free(droppedFiles[i]);
+
+	if (droppedFiles != NULL)
+	{
+		free(droppedFiles);
+		droppedFiles = NULL;
+	}
+
+	numDroppedFiles = 0;
+}
+#endif
+
+// Linux specific routines
+#ifdef __linux__
+/* The first instance listens on a Unix domain socket in the abstract
+** namespace (no file on disk, and it's gone as soon as the process dies).
+** A later instance that was started with file arguments connects to it,
+** sends the full paths (zero-terminated) and quits right away, before
+** SDL or anything else has been initialized. Abstract sockets have no
+** file permissions, so connections from other users are rejected.
+*/
+static socklen_t getInstanceSocketAddr(struct sockaddr_un *addr)
+{
+	memset(addr, 0, sizeof (struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+
+	// sun_path[0] = '\0' means abstract namespace, one per user
+	const int32_t nameLen = snprintf(&addr->sun_path[1], sizeof (addr->sun_path)-1, "ft2-clone-%u", (uint32_t)getuid());
+	return (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + nameLen);
+}
+
+static bool writeToSocket(int fd, const char *data, size_t length)
+{
+	while (length > 0)
+	{
+		const ssize_t bytesWritten = write(fd, data, length);
+		if (bytesWritten < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			return false;
+		}
+
+		data += bytesWritten;
+		length -= bytesWritten;
+	}
+
+	return true;
+}
+
+static bool sendArgsToInstance(int fd, int32_t argc, char **argv)
+{
+	for (int32_t i = 1; i < argc; i++)
+	{
+		if (argv[i][0] == '\0')
+			continue;
+
+		// the other instance has a different working directory
+		char *fullPath = realpath(argv[i], NULL);
+		const char *path = (fullPath != NULL) ? fullPath : argv[i];
+
+		const bool result = writeToSocket(fd, path, strlen(path) + 1);
+
+		if (fullPath != NULL)
+			free(fullPath);
+
+		if (!result)
+			return false;
+	}
+
+	return true;
+}
+
+static bool peerIsSameUser(int fd)
+{
+	struct ucred cred;
+	socklen_t credLen = sizeof (cred);
+
+	if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &credLen) != 0)
+		return false;
+
+	return (cred.uid == getuid());
+}
+
+bool handleSingleInstancing(int32_t argc, char **argv)
+{
+	struct sockaddr_un addr;
+
+	const socklen_t addrLen = getInstanceSocketAddr(&addr);
+
+	if (argc >= 2 && argv[1][0] != '\0')
+	{
+		int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (fd != -1)
+		{
+			if (connect(fd, (struct sockaddr *)&addr, addrLen) == 0)
+			{
+				if (!peerIsSameUser(fd))
+				{
+					// another user owns the socket name, don't send them our paths (and we can't listen on it)
+					close(fd);
+					return false;
+				}
+
+				if (sendArgsToInstance(fd, argc, argv))
+				{
+					close(fd);
+					return true; // quit instance now
+				}
+			}
+
+			close(fd);
+		}
+	}
+
+	// no instance is open (or it didn't answer), listen for file arguments from later instances
+	instanceSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if (instanceSocket != -1)
+	{
+		if (bind(instanceSocket, (struct sockaddr *)&addr, addrLen) != 0 || listen(instanceSocket, 8) != 0)
+		{
+			// another instance owns the socket already, run as a normal instance
+			close(instanceSocket);
+			instanceSocket = -1;
+		}
+	}
+
+	return false;
+}
+
+static void closeInstanceClient(void)
+{
+	if (instanceClient != -1)
+	{
+		close(instanceClient);
+		instanceClient = -1;
+	}
+
+	if (instanceMsgBuf != NULL)
+	{
+		free(instanceMsgBuf);
+		instanceMsgBuf = NULL;
+	}
+
+	instanceMsgLen = 0;
+}
+
+static void loadInstanceMessageFiles(void)
+{
+	char *msgBuf = instanceMsgBuf;
+	const size_t msgLen = instanceMsgLen;
+
+	msgBuf[msgLen] = '\0'; // in case the last path got cut off
+
+	// split up the zero-terminated paths
+	int32_t numFiles = 0;
+	for (size_t i = 0; i < msgLen; i += strlen(&msgBuf[i]) + 1)
+	{
+		if (msgBuf[i] != '\0')
+			numFiles++;
+	}
+
+	if (numFiles <= 0)
+		return;
+
+	char **filePaths = (char **)malloc(numFiles * sizeof (char *));
+	if (filePaths == NULL)
+		return;
+
+	numFiles = 0;
+	for (size_t i = 0; i < msgLen; i += strlen(&msgBuf[i]) + 1)
+	{
+		if (msgBuf[i] != '\0')
+			filePaths[numFiles++] = &msgBuf[i];
+	}
+
+	editor.autoPlayOnDrop = true;
+	raiseWindowOnDrop();
+	loadDroppedFiles(filePaths, numFiles);
+
+	free(filePaths);
+}
+
+/* Called every frame. The connection is non-blocking, whatever has arrived
+** is buffered until the sender closes it (or the timeout hits), so a slow or
+** stuck sender never stalls the GUI.
+*/
+static void handleInstanceMessages(void)
+{
+	if (instanceSocket == -1)
+		return;
+
+	if (instanceClient == -1)
+	{
+		if (ui.sysReqShown)
+			return;
+
+		const int fd = accept4(instanceSocket, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+		if (fd == -1)
+			return;
+
+		if (!peerIsSameUser(fd))
+		{
+			close(fd);
+			return;
+		}
+
+		instanceMsgBuf = (char *)malloc(INSTANCE_MSG_MAX_LEN + 1);
+		if (instanceMsgBuf == NULL)
+		{
+			close(fd);
+			return;
+		}
+
+		instanceClient = fd;
+		instanceMsgLen = 0;
+		instanceMsgTimeout64 = SDL_GetPerformanceCounter() + SDL_GetPerformanceFrequency(); // one second
+	}
+
+	bool msgDone = false;
+	while (instanceMsgLen < INSTANCE_MSG_MAX_LEN)
+	{
+		const ssize_t bytesRead = read(instanceClient, &instanceMsgBuf[instanceMsgLen], INSTANCE_MSG_MAX_LEN - instanceMsgLen);
+		if (bytesRead < 0 && errno == EINTR)
+			continue;
+
+		if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			break; // nothing more right now, try again next frame
+
+		if (bytesRead <= 0)
+		{
+			msgDone = true; // the sender closed the connection (or error)
+			break;
+		}
+
+		instanceMsgLen += bytesRead;
+	}
+
+	if (instanceMsgLen >= INSTANCE_MSG_MAX_LEN || SDL_GetPerformanceCounter() >= instanceMsgTimeout64)
+		msgDone = true; // load what we got
+
+	if (msgDone)
+	{
+		loadInstanceMessageFiles();
+		closeInstanceClient();
+	}
+}
+
+void closeSingleInstancing(void)
+{
+	closeInstanceClient();
+
+	if (instanceSocket != -1)
+	{
+		close(instanceSocket);
+		instanceSocket = -1;
+	}
+}
+#endif
+
 static void handleSDLEvents(void)
 {
 	SDL_Event event;
 
-	if (!editor.busy)
+	if (!editor.busy && video.uiTick)
 		handleLastGUIObjectDown(); // this should be handled before main input poll (on next frame)
 
 	while (SDL_PollEvent(&event))
@@ -450,20 +754,47 @@ static void handleSDLEvents(void)
 			else if (event.wheel.y < 0)
 				mouseWheelHandler(MOUSE_WHEEL_DOWN);
 		}
-		else if (event.type == SDL_DROPFILE)
+#if !(SDL_MAJOR_VERSION == 2 && SDL_MINOR_VERSION == 0 && SDL_PATCHLEVEL < 5)
+		else if (event.type == SDL_DROPBEGIN)
 		{
-			editor.autoPlayOnDrop = false;
-
-			if (!video.fullscreen)
+			dropInProgress = true;
+		}
+		else if (event.type == SDL_DROPCOMPLETE)
+		{
+			dropInProgress = false;
+			if (numDroppedFiles > 0)
 			{
-				if (SDL_GetWindowFlags(video.window) & SDL_WINDOW_MINIMIZED)
-					SDL_RestoreWindow(video.window);
+				editor.autoPlayOnDrop = false;
+				raiseWindowOnDrop();
+				loadDroppedFiles(droppedFiles, numDroppedFiles);
+			}
 
-				SDL_RaiseWindow(video.window);
+			freeDroppedFiles();
+		}
+#endif
+		else if (event.type == SDL_DROPFILE)
+		{
+			if (dropInProgress) // collect the files, they get loaded on SDL_DROPCOMPLETE
+			{
+				char **newList = (char **)realloc(droppedFiles, (numDroppedFiles + 1) * sizeof (char *));
+				if (newList != NULL)
+				{
+					droppedFiles = newList;
+					droppedFiles[numDroppedFiles++] = event.drop.file;
+				}
+				else
+				{
+					SDL_free(event.drop.file);
+				}
 			}
+			else
+			{
+				editor.autoPlayOnDrop = false;
+				raiseWindowOnDrop();
 
-			loadDroppedFile(event.drop.file, true);
-			SDL_free(event.drop.file);
+				loadDroppedFile(event.drop.file, true);
+				SDL_free(event.drop.file);
+			}
 		}
 		else if (event.type == SDL_QUIT)
 		{
@@ -522,6 +853,11 @@ static void handleSDLEvents(void)
 			editor.programRunning = false;
 	}
 
+#ifdef __linux__
+	if (!editor.busy)
+		handleInstanceMessages(); // file arguments from a second instance
+#endif
+
 #ifdef HAS_MIDI
 	// MIDI vibrato
 	const uint8_t vibDepth = (midi.currMIDIVibDepth >> 9) & 0x0F;
@@ -17,7 +17,7 @@ void readInput(void);
 void handleEvents(void);
 void setupCrashHandler(void);
 void handleWaitVblQuirk(SDL_Event *event);
-#ifdef _WIN32
+#if defined _WIN32 || defined __linux__
 bool handleSingleInstancing(int32_t argc, char **argv);
 void closeSingleInstancing(void);
 #endif
@@ -201,8 +201,7 @@ bool setupGUI(void)
 		s->thumbH = 0;
 	}
 
-	setPal16(palTable[config.cfg_StdPalNum], false);
-	initAboutScreen();
+	setPal16(palTable[config.cfg_StdPalNum]);
 	setupInitialTextBoxPointers();
 	setInitialTrimFlags();
 	initializeScrollBars();
@@ -211,7 +210,6 @@ bool setupGUI(void)
 	drawGUIOnRunTime();
 	updateSampleEditorSample();
 	updatePatternWidth();
-	initFTHelp();
 
 	return true;
 
@@ -287,9 +285,75 @@ uint16_t textWidth16(const char *textPtr)
 	return textWidth;
 }
 
-void textOutTiny(int32_t xPos, int32_t yPos, char *str, uint32_t color) // A..Z/a..z and 0..9
+// GLYPH BLITTER
+
+/* The font bitmaps are loaded as byte masks (0x00 = transparent, 0xFF = set),
+** so a glyph row can be merged into the framebuffer 8 (or 4) pixels at a time
+** without a branch per pixel: dst = (dst & ~mask) | (color & mask). The mask is
+** independent of the color since the framebuffer holds palette indices.
+*/
+
+#define SPLAT64(x) ((x) * UINT64_C(0x0101010101010101))
+
+void glyphBlit(uint8_t *dstPtr, int32_t dstPitch, const uint8_t *maskPtr, int32_t maskPitch, int32_t w, int32_t h, uint8_t paletteIndex)
+{
+	const uint64_t color64 = SPLAT64(paletteIndex);
+	const uint32_t color32 = (uint32_t)color64;
+
+	for (int32_t y = 0; y < h; y++, dstPtr += dstPitch, maskPtr += maskPitch)
+	{
+		int32_t x = 0;
+
+		for (; x+8 <= w; x += 8)
+		{
+			uint64_t d, m;
+			memcpy(&m, &maskPtr[x], 8);
+			memcpy(&d, &dstPtr[x], 8);
+			d = (d & ~m) | (color64 & m);
+			memcpy(&dstPtr[x], &d, 8);
+		}
+
+		if (x+4 <= w)
+		{
+			uint32_t d, m;
+			memcpy(&m, &maskPtr[x], 4);
+			memcpy(&d, &dstPtr[x], 4);
+			d = (d & ~m) | (color32 & m);
+			memcpy(&dstPtr[x], &d, 4);
+			x += 4;
+		}
+
+		for (; x < w; x++)
+			dstPtr[x] = (dstPtr[x] & ~maskPtr[x]) | (paletteIndex & maskPtr[x]);
+	}
+}
+
+// opaque version, the background doesn't have to be read
+void glyphBlitBg(uint8_t *dstPtr, int32_t dstPitch, const uint8_t *maskPtr, int32_t maskPitch, int32_t w, int32_t h, uint8_t fgPalette, uint8_t bgPalette)
+{
+	const uint64_t fg64 = SPLAT64(fgPalette);
+	const uint64_t bg64 = SPLAT64(bgPalette);
+
+	for (int32_t y = 0; y < h; y++, dstPtr += dstPitch, maskPtr += maskPitch)
+	{
+		int32_t x = 0;
+
+		for (; x+8 <= w; x += 8)
+		{
+			uint64_t m;
+			memcpy(&m, &maskPtr[x], 8);
+			const uint64_t d = (bg64 & ~m) | (fg64 & m);
+			memcpy(&dstPtr[x], &d, 8);
+		}
+
+		for (; x < w; x++)
+			dstPtr[x] = (bgPalette & ~maskPtr[x]) | (fgPalette & maskPtr[x]);
+	}
+}
+
+void textOutTiny(int32_t xPos, int32_t yPos, char *str, uint8_t paletteIndex) // A..Z/a..z and 0..9
 {
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	while (*str != '\0')
 	{
 		char chr = *str++;
@@ -314,34 +378,19 @@ void textOutTiny(int32_t xPos, int32_t yPos, char *str, uint32_t color) // A..Z/
 			continue;
 		}
 
-		const uint8_t *srcPtr = &bmp.font3[chr * FONT3_CHAR_W];
-		for (int32_t y = 0; y < FONT3_CHAR_H; y++)
-		{
-			for (int32_t x = 0; x < FONT3_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = color;
-			}
-
-			srcPtr += FONT3_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-
-		dstPtr -= (SCREEN_W * FONT3_CHAR_H) - FONT3_CHAR_W;
+		glyphBlit(dstPtr, SCREEN_W, &bmp.font3[chr * FONT3_CHAR_W], FONT3_WIDTH, FONT3_CHAR_W, FONT3_CHAR_H, paletteIndex);
+		dstPtr += FONT3_CHAR_W;
 	}
 }
 
 void textOutTinyOutline(int32_t xPos, int32_t yPos, char *str) // A..Z/a..z and 0..9
 {
-	const uint32_t bgColor = video.palette[PAL_BCKGRND];
-	const uint32_t fgColor = video.palette[PAL_FORGRND];
+	textOutTiny(xPos-1, yPos,   str, PAL_BCKGRND);
+	textOutTiny(xPos,   yPos-1, str, PAL_BCKGRND);
+	textOutTiny(xPos+1, yPos,   str, PAL_BCKGRND);
+	textOutTiny(xPos,   yPos+1, str, PAL_BCKGRND);
 
-	textOutTiny(xPos-1, yPos,   str, bgColor);
-	textOutTiny(xPos,   yPos-1, str, bgColor);
-	textOutTiny(xPos+1, yPos,   str, bgColor);
-	textOutTiny(xPos,   yPos+1, str, bgColor);
-
-	textOutTiny(xPos, yPos, str, fgColor);
+	textOutTiny(xPos, yPos, str, PAL_FORGRND);
 }
 
 void charOut(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr)
@@ -355,21 +404,8 @@ void charOut(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr)
 	if (chr == ' ')
 		return;
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-	const uint8_t *srcPtr = &bmp.font1[chr * FONT1_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (uint32_t y = 0; y < FONT1_CHAR_H; y++)
-	{
-		for (uint32_t x = 0; x < FONT1_CHAR_W; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = pixVal;
-		}
-
-		srcPtr += FONT1_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font1[chr * FONT1_CHAR_W], FONT1_WIDTH, FONT1_CHAR_W, FONT1_CHAR_H, paletteIndex);
 }
 
 void charOutBg(uint16_t xPos, uint16_t yPos, uint8_t fgPalette, uint8_t bgPalette, char chr)
@@ -383,20 +419,8 @@ void charOutBg(uint16_t xPos, uint16_t yPos, uint8_t fgPalette, uint8_t bgPalett
 	if (chr == ' ')
 		return;
 
-	const uint32_t fg = video.palette[fgPalette];
-	const uint32_t bg = video.palette[bgPalette];
-
-	const uint8_t *srcPtr = &bmp.font1[chr * FONT1_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT1_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT1_CHAR_W-1; x++)
-			dstPtr[x] = srcPtr[x] ? fg : bg;
-
-		srcPtr += FONT1_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlitBg(dstPtr, SCREEN_W, &bmp.font1[chr * FONT1_CHAR_W], FONT1_WIDTH, FONT1_CHAR_W-1, FONT1_CHAR_H, fgPalette, bgPalette);
 }
 
 void charOutOutlined(uint16_t x, uint16_t y, uint8_t paletteIndex, char chr)
@@ -420,27 +444,11 @@ void charOutShadow(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, uint8_t s
 	if (chr == ' ')
 		return;
 
-	const uint32_t pixVal1 = video.palette[paletteIndex];
-	const uint32_t pixVal2 = video.palette[shadowPaletteIndex];
 	const uint8_t *srcPtr = &bmp.font1[chr * FONT1_CHAR_W];
-	uint32_t *dstPtr1 = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	uint32_t *dstPtr2 = dstPtr1 + (SCREEN_W+1);
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t y = 0; y < FONT1_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT1_CHAR_W; x++)
-		{
-			if (srcPtr[x] != 0)
-			{
-				dstPtr2[x] = pixVal2;
-				dstPtr1[x] = pixVal1;
-			}
-		}
-
-		srcPtr += FONT1_WIDTH;
-		dstPtr1 += SCREEN_W;
-		dstPtr2 += SCREEN_W;
-	}
+	glyphBlit(dstPtr + (SCREEN_W+1), SCREEN_W, srcPtr, FONT1_WIDTH, FONT1_CHAR_W, FONT1_CHAR_H, shadowPaletteIndex);
+	glyphBlit(dstPtr, SCREEN_W, srcPtr, FONT1_WIDTH, FONT1_CHAR_W, FONT1_CHAR_H, paletteIndex);
 }
 
 void charOutClipX(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr, uint16_t clipX)
@@ -457,25 +465,13 @@ void charOutClipX(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr,
 	if (chr == ' ')
 		return;
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-	const uint8_t *srcPtr = &bmp.font1[chr * FONT1_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
 	int32_t width = FONT1_CHAR_W;
 	if (xPos+width > clipX)
 		width = FONT1_CHAR_W - ((xPos + width) - clipX);
 
-	for (int32_t y = 0; y < FONT1_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < width; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = pixVal;
-		}
-
-		srcPtr += FONT1_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font1[chr * FONT1_CHAR_W], FONT1_WIDTH, width, FONT1_CHAR_H, paletteIndex);
 }
 
 void bigCharOut(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr)
@@ -489,21 +485,8 @@ void bigCharOut(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, char chr)
 	if (chr == ' ')
 		return;
 
-	const uint8_t *srcPtr = &bmp.font2[chr * FONT2_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	const uint32_t pixVal = video.palette[paletteIndex];
-
-	for (int32_t y = 0; y < FONT2_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT2_CHAR_W; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = pixVal;
-		}
-
-		srcPtr += FONT2_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font2[chr * FONT2_CHAR_W], FONT2_WIDTH, FONT2_CHAR_W, FONT2_CHAR_H, paletteIndex);
 }
 
 static void bigCharOutShadow(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, uint8_t shadowPaletteIndex, char chr)
@@ -517,27 +500,11 @@ static void bigCharOutShadow(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex,
 	if (chr == ' ')
 		return;
 
-	const uint32_t pixVal1 = video.palette[paletteIndex];
-	const uint32_t pixVal2 = video.palette[shadowPaletteIndex];
 	const uint8_t *srcPtr = &bmp.font2[chr * FONT2_CHAR_W];
-	uint32_t *dstPtr1 = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	uint32_t *dstPtr2 = dstPtr1 + (SCREEN_W+1);
-
-	for (int32_t y = 0; y < FONT2_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT2_CHAR_W; x++)
-		{
-			if (srcPtr[x] != 0)
-			{
-				dstPtr2[x] = pixVal2;
-				dstPtr1[x] = pixVal1;
-			}
-		}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-		srcPtr += FONT2_WIDTH;
-		dstPtr1 += SCREEN_W;
-		dstPtr2 += SCREEN_W;
-	}
+	glyphBlit(dstPtr + (SCREEN_W+1), SCREEN_W, srcPtr, FONT2_WIDTH, FONT2_CHAR_W, FONT2_CHAR_H, shadowPaletteIndex);
+	glyphBlit(dstPtr, SCREEN_W, srcPtr, FONT2_WIDTH, FONT2_CHAR_W, FONT2_CHAR_H, paletteIndex);
 }
 
 void textOut(uint16_t x, uint16_t y, uint8_t paletteIndex, const char *textPtr)
@@ -654,27 +621,12 @@ void hexOut(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, uint32_t val, ui
 {
 	assert(xPos < SCREEN_W && yPos < SCREEN_H);
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t i = numDigits-1; i >= 0; i--)
+	for (int32_t i = numDigits-1; i >= 0; i--, dstPtr += FONT6_CHAR_W)
 	{
 		const uint8_t *srcPtr = &bmp.font6[((val >> (i * 4)) & 15) * FONT6_CHAR_W];
-
-		// render glyph
-		for (int32_t y = 0; y < FONT6_CHAR_H; y++)
-		{
-			for (int32_t x = 0; x < FONT6_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = pixVal;
-			}
-
-			srcPtr += FONT6_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-
-		dstPtr -= (SCREEN_W * FONT6_CHAR_H) - FONT6_CHAR_W; // xpos += FONT6_CHAR_W
+		glyphBlit(dstPtr, SCREEN_W, srcPtr, FONT6_WIDTH, FONT6_CHAR_W, FONT6_CHAR_H, paletteIndex);
 	}
 }
 
@@ -682,26 +634,13 @@ void hexOutBg(uint16_t xPos, uint16_t yPos, uint8_t fgPalette, uint8_t bgPalette
 {
 	assert(xPos < SCREEN_W && yPos < SCREEN_H);
 
-	const uint32_t fg = video.palette[fgPalette];
-	const uint32_t bg = video.palette[bgPalette];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t i = numDigits-1; i >= 0; i--)
+	for (int32_t i = numDigits-1; i >= 0; i--, dstPtr += FONT6_CHAR_W)
 	{
 		// extract current nybble and set pointer to glyph
 		const uint8_t *srcPtr = &bmp.font6[((val >> (i * 4)) & 15) * FONT6_CHAR_W];
-
-		// render glyph
-		for (int32_t y = 0; y < FONT6_CHAR_H; y++)
-		{
-			for (int32_t x = 0; x < FONT6_CHAR_W; x++)
-				dstPtr[x] = srcPtr[x] ? fg : bg;
-
-			srcPtr += FONT6_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-
-		dstPtr -= (SCREEN_W * FONT6_CHAR_H) - FONT6_CHAR_W; // xpos += FONT6_CHAR_W 
+		glyphBlitBg(dstPtr, SCREEN_W, srcPtr, FONT6_WIDTH, FONT6_CHAR_W, FONT6_CHAR_H, fgPalette, bgPalette);
 	}
 }
 
@@ -717,43 +656,20 @@ void clearRect(uint16_t xPos, uint16_t yPos, uint16_t w, uint16_t h)
 {
 	assert(xPos < SCREEN_W && yPos < SCREEN_H && (xPos + w) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	const uint32_t pitch = w * sizeof (int32_t);
-
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < h; y++, dstPtr += SCREEN_W)
-		memset(dstPtr, 0, pitch);
+		memset(dstPtr, PAL_BCKGRND, w);
 }
 
 void fillRect(uint16_t xPos, uint16_t yPos, uint16_t w, uint16_t h, uint8_t paletteIndex)
 {
 	assert(xPos < SCREEN_W && yPos < SCREEN_H && (xPos + w) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
 	for (int32_t y = 0; y < h; y++)
 	{
-		for (int32_t x = 0; x < w; x++)
-			dstPtr[x] = pixVal;
-
-		dstPtr += SCREEN_W;
-	}
-}
-
-void blit32(uint16_t xPos, uint16_t yPos, const uint32_t *srcPtr, uint16_t w, uint16_t h)
-{
-	assert(srcPtr != NULL && xPos < SCREEN_W && yPos < SCREEN_H && (xPos + w) <= SCREEN_W && (yPos + h) <= SCREEN_H);
-
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	for (int32_t y = 0; y < h; y++)
-	{
-		for (int32_t x = 0; x < w; x++)
-		{
-			if (srcPtr[x] != 0x00FF00)
-				dstPtr[x] = srcPtr[x] | 0xFF000000; // most significant 8 bits = palette number. 0xFF because no true palette
-		}
-
-		srcPtr += w;
+		memset(dstPtr, paletteIndex, w);
 		dstPtr += SCREEN_W;
 	}
 }
@@ -762,14 +678,13 @@ void blit(uint16_t xPos, uint16_t yPos, const uint8_t *srcPtr, uint16_t w, uint1
 {
 	assert(srcPtr != NULL && xPos < SCREEN_W && yPos < SCREEN_H && (xPos + w) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < h; y++)
 	{
 		for (int32_t x = 0; x < w; x++)
 		{
-			const uint32_t pixel = srcPtr[x];
-			if (pixel != PAL_TRANSPR)
-				dstPtr[x] = video.palette[pixel];
+			if (srcPtr[x] != PAL_TRANSPR)
+				dstPtr[x] = srcPtr[x];
 		}
 
 		srcPtr += w;
@@ -784,14 +699,13 @@ void blitClipX(uint16_t xPos, uint16_t yPos, const uint8_t *srcPtr, uint16_t w,
 
 	assert(srcPtr != NULL && xPos < SCREEN_W && yPos < SCREEN_H && (xPos + clipX) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < h; y++)
 	{
 		for (int32_t x = 0; x < clipX; x++)
 		{
-			const uint32_t pixel = srcPtr[x];
-			if (pixel != PAL_TRANSPR)
-				dstPtr[x] = video.palette[pixel];
+			if (srcPtr[x] != PAL_TRANSPR)
+				dstPtr[x] = srcPtr[x];
 		}
 
 		srcPtr += w;
@@ -803,11 +717,10 @@ void blitFast(uint16_t xPos, uint16_t yPos, const uint8_t *srcPtr, uint16_t w, u
 {
 	assert(srcPtr != NULL && xPos < SCREEN_W && yPos < SCREEN_H && (xPos + w) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < h; y++)
 	{
-		for (int32_t x = 0; x < w; x++)
-			dstPtr[x] = video.palette[srcPtr[x]];
+		memcpy(dstPtr, srcPtr, w);
 
 		srcPtr += w;
 		dstPtr += SCREEN_W;
@@ -821,11 +734,10 @@ void blitFastClipX(uint16_t xPos, uint16_t yPos, const uint8_t *srcPtr, uint16_t
 
 	assert(srcPtr != NULL && xPos < SCREEN_W && yPos < SCREEN_H && (xPos + clipX) <= SCREEN_W && (yPos + h) <= SCREEN_H);
 
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < h; y++)
 	{
-		for (int32_t x = 0; x < clipX; x++)
-			dstPtr[x] = video.palette[srcPtr[x]];
+		memcpy(dstPtr, srcPtr, clipX);
 
 		srcPtr += w;
 		dstPtr += SCREEN_W;
@@ -838,23 +750,18 @@ void hLine(uint16_t x, uint16_t y, uint16_t w, uint8_t paletteIndex)
 {
 	assert(x < SCREEN_W && y < SCREEN_H && (x + w) <= SCREEN_W);
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-
-	uint32_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
-	for (int32_t i = 0; i < w; i++)
-		dstPtr[i] = pixVal;
+	uint8_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
+	memset(dstPtr, paletteIndex, w);
 }
 
 void vLine(uint16_t x, uint16_t y, uint16_t h, uint8_t paletteIndex)
 {
 	assert(x < SCREEN_W && y < SCREEN_H && (y + h) <= SCREEN_W);
 
-	const uint32_t pixVal = video.palette[paletteIndex];
-
-	uint32_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint8_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
 	for (int32_t i = 0; i < h; i++)
 	{
-		*dstPtr = pixVal;
+		*dstPtr = paletteIndex;
 		 dstPtr += SCREEN_W;
 	}
 }
@@ -882,9 +789,8 @@ void line(int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint8_t paletteIndex)
 	int16_t x = x1;
 	int16_t y  = y1;
 
-	uint32_t pixVal = video.palette[paletteIndex];
 	const int32_t pitch  = sy * SCREEN_W;
-	uint32_t *dst32  = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint8_t *dst8 = &video.frameBuffer[(y * SCREEN_W) + x];
 
 	// draw line
 	if (ax > ay)
@@ -892,19 +798,19 @@ void line(int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint8_t paletteIndex)
 		int16_t d = ay - (ax >> 1);
 		while (true)
 		{
-			*dst32 = pixVal;
+			*dst8 = paletteIndex;
 			if (x == x2)
 				break;
 
 			if (d >= 0)
 			{
 				d -= ax;
-				dst32 += pitch;
+				dst8 += pitch;
 			}
 
 			x += sx;
 			d += ay;
-			dst32 += sx;
+			dst8 += sx;
 		}
 	}
 	else
@@ -912,19 +818,19 @@ void line(int16_t x1, int16_t x2, int16_t y1, int16_t y2, uint8_t paletteIndex)
 		int16_t d = ax - (ay >> 1);
 		while (true)
 		{
-			*dst32 = pixVal;
+			*dst8 = paletteIndex;
 			if (y == y2)
 				break;
 
 			if (d >= 0)
 			{
 				d -= ay;
-				dst32 += sx;
+				dst8 += sx;
 			}
 
 			y += sy;
 			d += ax;
-			dst32 += pitch;
+			dst8 += pitch;
 		}
 	}
 }
@@ -29,6 +29,7 @@ typedef struct
 #define HELP_COLUMN 135
 #define HELP_WIDTH (596 - HELP_COLUMN)
 
+static bool helpParsed;
 static uint8_t fHlp_Num;
 static int16_t textLine, fHlp_Line, subjLen[MAX_SUBJ];
 static int32_t helpBufferPos;
@@ -279,20 +280,8 @@ static void bigTextOutHalf(uint16_t xPos, uint16_t yPos, uint8_t paletteIndex, b
 			if (!lowerHalf)
 				srcPtr += (FONT2_CHAR_H / 2) * FONT2_WIDTH;
 
-			uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + currX];
-			const uint32_t pixVal = video.palette[paletteIndex];
-
-			for (uint32_t y = 0; y < FONT2_CHAR_H/2; y++)
-			{
-				for (uint32_t x = 0; x < FONT2_CHAR_W; x++)
-				{
-					if (srcPtr[x])
-						dstPtr[x] = pixVal;
-				}
-
-				srcPtr += FONT2_WIDTH;
-				dstPtr += SCREEN_W;
-			}
+			uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + currX];
+			glyphBlit(dstPtr, SCREEN_W, srcPtr, FONT2_WIDTH, FONT2_CHAR_W, FONT2_CHAR_H/2, paletteIndex);
 		}
 
 		currX += charWidth16(chr);
@@ -373,6 +362,12 @@ void showHelpScreen(void)
 {
 	uint16_t tmpID;
 
+	if (!helpParsed) // not needed at startup, parsed on first use
+	{
+		initFTHelp();
+		helpParsed = true;
+	}
+
 	if (ui.extendedPatternEditor)
 		exitPatternEditorExtended();
 
@@ -1579,19 +1579,8 @@ static void pianoNumberOut(uint16_t xPos, uint16_t yPos, uint8_t fgPalette, uint
 {
 	assert(val <= 0xF);
 
-	const uint32_t fg = video.palette[fgPalette];
-	const uint32_t bg = video.palette[bgPalette];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	const uint8_t *srcPtr = &bmp.font8[val * FONT8_CHAR_W];
-
-	for (int32_t y = 0; y < FONT8_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT8_CHAR_W; x++)
-			dstPtr[x] = srcPtr[x] ? fg : bg;
-
-		dstPtr += SCREEN_W;
-		srcPtr += FONT8_WIDTH;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlitBg(dstPtr, SCREEN_W, &bmp.font8[val * FONT8_CHAR_W], FONT8_WIDTH, FONT8_CHAR_W, FONT8_CHAR_H, fgPalette, bgPalette);
 }
 
 static void writePianoNumber(uint8_t note, uint8_t key, uint8_t octave)
@@ -1773,12 +1762,11 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 	int16_t x = x1;
 	int16_t y = y1;
 
-	const uint32_t pal1 = video.palette[PAL_BLCKMRK];
-	const uint32_t pal2 = video.palette[PAL_BLCKTXT];
-	const uint32_t pixVal = video.palette[pal];
+	const uint8_t pal1 = PAL_BLCKMRK;
+	const uint8_t pal2 = PAL_BLCKTXT;
 	const int32_t pitch = sy * SCREEN_W;
 
-	uint32_t *dst32 = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint8_t *dst8 = &video.frameBuffer[(y * SCREEN_W) + x];
 
 	// draw line
 	if (ax > ay)
@@ -1787,12 +1775,12 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 		while (true)
 		{
 			// invert certain colors
-			if (*dst32 != pal2)
+			if (*dst8 != pal2)
 			{
-				if (*dst32 == pal1)
-					*dst32 = pal2;
+				if (*dst8 == pal1)
+					*dst8 = pal2;
 				else
-					*dst32 = pixVal;
+					*dst8 = pal;
 			}
 
 			if (x == x2)
@@ -1801,12 +1789,12 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 			if (d >= 0)
 			{
 				d -= ax;
-				dst32 += pitch;
+				dst8 += pitch;
 			}
 
 			x += sx;
 			d += ay;
-			dst32 += sx;
+			dst8 += sx;
 		}
 	}
 	else
@@ -1815,12 +1803,12 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 		while (true)
 		{
 			// invert certain colors
-			if (*dst32 != pal2)
+			if (*dst8 != pal2)
 			{
-				if (*dst32 == pal1)
-					*dst32 = pal2;
+				if (*dst8 == pal1)
+					*dst8 = pal2;
 				else
-					*dst32 = pixVal;
+					*dst8 = pal;
 			}
 
 			if (y == y2)
@@ -1829,12 +1817,12 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 			if (d >= 0)
 			{
 				d -= ay;
-				dst32 += sx;
+				dst8 += sx;
 			}
 
 			y += sy;
 			d += ax;
-			dst32 += pitch;
+			dst8 += pitch;
 		}
 	}
 }
@@ -1842,15 +1830,15 @@ static void envelopeLine(int32_t envNum, int16_t x1, int16_t y1, int16_t x2, int
 static void envelopePixel(int32_t envNum, int16_t x, int16_t y, uint8_t pal)
 {
 	y += (envNum == 0) ? 189 : 276;
-	video.frameBuffer[(y * SCREEN_W) + x] = video.palette[pal];
+	video.frameBuffer[(y * SCREEN_W) + x] = pal;
 }
 
 static void envelopeDot(int32_t envNum, int16_t x, int16_t y)
 {
 	y += (envNum == 0) ? 189 : 276;
 
-	const uint32_t pixVal = video.palette[PAL_BLCKTXT];
-	uint32_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
+	const uint8_t pixVal = PAL_BLCKTXT;
+	uint8_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
 
 	for (y = 0; y < 3; y++)
 	{
@@ -1866,14 +1854,11 @@ static void envelopeVertLine(int32_t envNum, int16_t x, int16_t y, uint8_t pal)
 {
 	y += (envNum == 0) ? 189 : 276;
 
-	const uint32_t pixVal1 = video.palette[pal];
-	const uint32_t pixVal2 = video.palette[PAL_BLCKTXT];
-
-	uint32_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint8_t *dstPtr = &video.frameBuffer[(y * SCREEN_W) + x];
 	for (y = 0; y < 33; y++)
 	{
-		if (*dstPtr != pixVal2)
-			*dstPtr = pixVal1;
+		if (*dstPtr != PAL_BLCKTXT)
+			*dstPtr = pal;
 
 		dstPtr += SCREEN_W*2;
 	}
@@ -2050,8 +2035,8 @@ static void drawPanEnvCoords(int16_t tick, int16_t val)
 		// outline
 		hLine(326, 287, 3, PAL_BCKGRND);
 		hLine(326, 289, 3, PAL_BCKGRND);
-		video.frameBuffer[(288 * SCREEN_W) + 325] = video.palette[PAL_BCKGRND];
-		video.frameBuffer[(288 * SCREEN_W) + 329] = video.palette[PAL_BCKGRND];
+		video.frameBuffer[(288 * SCREEN_W) + 325] = PAL_BCKGRND;
+		video.frameBuffer[(288 * SCREEN_W) + 329] = PAL_BCKGRND;
 
 		hLine(326, 288, 3, PAL_FORGRND);
 	}
@@ -3071,7 +3056,7 @@ static int32_t SDLCALL saveInstrThread(void *ptr)
 
 	fclose(f);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 	setMouseBusy(false);
 
 	return true;
@@ -3080,7 +3065,7 @@ saveError:
 	if (f != NULL)
 		fclose(f);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 	setMouseBusy(false);
 
 	return false;
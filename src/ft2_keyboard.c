@@ -26,6 +26,7 @@
 #include "ft2_sample_ed_features.h"
 #include "ft2_midi.h"
 #include "ft2_structs.h"
+#include "ft2_undo.h"
 
 keyb_t keyb; // globalized
 
@@ -1196,6 +1197,15 @@ static bool checkModifiedKeys(SDL_Keycode keycode)
 				jumpToChannel(5);
 				return true;
 			}
+			else if (keyb.leftCtrlPressed)
+			{
+				if (keyb.leftShiftPressed)
+					redoEdit();
+				else
+					undoEdit();
+
+				return true;
+			}
 		}
 		break;
 
@@ -1391,7 +1401,12 @@ static bool checkModifiedKeys(SDL_Keycode keycode)
 
 		case SDLK_LEFT:
 		{
-			if (keyb.leftShiftPressed)
+			if (keyb.leftShiftPressed && keyb.leftCtrlPressed)
+			{
+				seekSongTime(-10);
+				return true;
+			}
+			else if (keyb.leftShiftPressed)
 			{
 				decSongPos();
 				return true;
@@ -1411,7 +1426,12 @@ static bool checkModifiedKeys(SDL_Keycode keycode)
 
 		case SDLK_RIGHT:
 		{
-			if (keyb.leftShiftPressed)
+			if (keyb.leftShiftPressed && keyb.leftCtrlPressed)
+			{
+				seekSongTime(10);
+				return true;
+			}
+			else if (keyb.leftShiftPressed)
 			{
 				incSongPos();
 				return true;
@@ -35,9 +35,19 @@
 #include "ft2_bmp.h"
 #include "ft2_structs.h"
 #include "ft2_hpc.h"
+#include "ft2_module_probe.h"
+#include "ft2_undo.h"
+#include "ft2_render_test.h"
+#include "mixer/ft2_windowed_sinc.h"
 
 static void initializeVars(void);
 static void cleanUpAndExit(void); // never call this inside the main loop
+static bool takeFlagFromArgs(int *argc, char **argv, const char *flag);
+static const char *takeValueFromArgs(int *argc, char **argv, const char *flag);
+static bool profileStage(const char *stageName, bool stageOK);
+
+static bool profileStartup;
+static uint64_t profileStartTime64, profileStageTime64;
 #ifdef __APPLE__
 static void osxSetDirToProgramDirFromArgs(char **argv);
 #endif
@@ -57,6 +67,10 @@ int main(int argc, char *argv[])
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 
+	// batch module scanner (metadata to JSON/CSV), no GUI/audio needed
+	if (argc >= 2 && !strcmp(argv[1], "--scan"))
+		return scanModulesFromArgs(argc, argv);
+
 #if SDL_MAJOR_VERSION == 2 && SDL_MINOR_VERSION == 0 && SDL_PATCHLEVEL < 5
 #pragma message("WARNING: The SDL2 dev lib is older than ver 2.0.5. You'll get fullscreen mode issues and no audio input sampling.")
 #pragma message("At least version 2.0.7 is recommended.")
@@ -68,6 +82,31 @@ int main(int argc, char *argv[])
 	initializeVars();
 	setupCrashHandler();
 
+	// golden render test (hashes the rendered output of a set of modules), no GUI/audio device needed
+	if (argc >= 2 && !strcmp(argv[1], "--render-test"))
+		return renderTestFromArgs(argc, argv);
+
+	// "--high-refresh": present at the display's refresh rate instead of 60Hz
+	video.highRefreshRate = takeFlagFromArgs(&argc, argv, "--high-refresh");
+
+	// "--fadeout-voices <32..224>": size of the volume ramp fade-out voice pool (not the channel count)
+	const char *numVoicesStr = takeValueFromArgs(&argc, argv, "--fadeout-voices");
+	if (numVoicesStr != NULL)
+		setNumFadeOutVoices(atoi(numVoicesStr));
+
+	// "--profile-startup": print how long every startup stage takes (to stdout)
+	profileStartup = takeFlagFromArgs(&argc, argv, "--profile-startup");
+	profileStartTime64 = profileStageTime64 = SDL_GetPerformanceCounter();
+
+#ifdef __linux__
+	/* Allow only one instance, and send the file arguments to it. This is done
+	** before any initialization, so that opening a file in a running instance
+	** is instant.
+	*/
+	if (handleSingleInstancing(argc, argv))
+		return 0; // the main instance has the file(s) now
+#endif
+
 	// on Windows and macOS, test what version SDL2.DLL is (against library version used in compilation)
 #if defined _WIN32 || defined __APPLE__
 	SDL_GetVersion(&sdlVer);
@@ -132,6 +171,7 @@ int main(int argc, char *argv[])
 		showErrorMsgBox("Couldn't initialize SDL:\n%s", SDL_GetError());
 		return 1;
 	}
+	profileStage("SDL_Init()", true);
 
 	SDL_EventState(SDL_DROPFILE, SDL_ENABLE);
 
@@ -147,15 +187,19 @@ int main(int argc, char *argv[])
 #ifdef __APPLE__
 	osxSetDirToProgramDirFromArgs(argv);
 #endif
-	if (!setupExecutablePath() || !loadBMPs() || !setupCubicSplineTables() || !setupWindowedSincTables())
+	if (!profileStage("setupExecutablePath()", setupExecutablePath()) ||
+		!profileStage("loadBMPs()", loadBMPs()) ||
+		!profileStage("setupCubicSplineTables()", setupCubicSplineTables()) ||
+		!profileStage("setupWindowedSincTables()", setupWindowedSincTables()))
 	{
 		cleanUpAndExit();
 		return 1;
 	}
 
 	loadConfigOrSetDefaults(); // config must be loaded at this exact point
+	profileStage("loadConfigOrSetDefaults()", true);
 
-	if (!setupWindow() || !setupRenderer())
+	if (!profileStage("setupWindow()", setupWindow()) || !profileStage("setupRenderer()", setupRenderer()))
 	{
 		// error message was shown in the functions above
 		cleanUpAndExit();
@@ -171,12 +215,15 @@ int main(int argc, char *argv[])
 	}
 #endif
 
-	if (!setupDiskOp())
+	if (!profileStage("setupDiskOp()", setupDiskOp()))
 	{
 		cleanUpAndExit();
 		return 1;
 	}
 
+	waitForWindowedSincTables(); // generated in parallel with the setup above, the mixer needs them from here on
+	profileStage("waitForWindowedSincTables()", true);
+
 	audio.currOutputDevice = getAudioOutputDeviceFromConfig();
 	audio.currInputDevice = getAudioInputDeviceFromConfig();
 
@@ -199,8 +246,13 @@ int main(int argc, char *argv[])
 			}
 		}
 	}
+	profileStage("setupAudio()", true);
 
-	if (!setupReplayer() || !setupGUI() || !initScopes())
+	if (!profileStage("setupReplayer()", setupReplayer()) ||
+		!profileStage("setupGUI()", setupGUI()) ||
+		!profileStage("initScopes()", initScopes()) ||
+		!profileStage("initUndoJournal()", initUndoJournal()) ||
+		!profileStage("initSmpEdit()", initSmpEdit()))
 	{
 		cleanUpAndExit();
 		return 1;
@@ -208,7 +260,9 @@ int main(int argc, char *argv[])
 
 	pauseAudio();
 	resumeAudio();
-	rescanAudioDevices();
+	profileStage("pauseAudio()/resumeAudio()", true);
+
+	// the audio device lists are only needed in the audio config screen, scanned on first use
 
 #ifdef _WIN32 // on Windows we show the window at this point
 	SDL_ShowWindow(video.window);
@@ -218,11 +272,11 @@ int main(int argc, char *argv[])
 	{
 		video.fullscreen = true;
 		enterFullscreen();
+		profileStage("enterFullscreen()", true);
 	}
 
 #ifdef HAS_MIDI
-#ifdef __APPLE__
-	// MIDI init can take several seconds on Mac, use thread
+	// MIDI init (device enumeration) can take several seconds on some systems, use thread
 	midi.initMidiThread = SDL_CreateThread(initMidiFunc, NULL, NULL);
 	if (midi.initMidiThread == NULL)
 	{
@@ -230,13 +284,18 @@ int main(int argc, char *argv[])
 		cleanUpAndExit();
 		return 1;
 	}
-#else
-	initMidiFunc(NULL);
-#endif
+	profileStage("MIDI init (thread started)", true);
 #endif
 
 	hpc_ResetCounters(&video.vblankHpc); // quirk: this is needed for potential okBox() calls in handleModuleLoadFromArg()
 	handleModuleLoadFromArg(argc, argv);
+	profileStage("handleModuleLoadFromArg()", true);
+
+	if (profileStartup)
+	{
+		printf("%-32s %9.3f ms\n", "Total", (SDL_GetPerformanceCounter() - profileStartTime64) * (1000.0 / SDL_GetPerformanceFrequency()));
+		fflush(stdout);
+	}
 
 	editor.mainLoopOngoing = true;
 	hpc_ResetCounters(&video.vblankHpc); // this must be the last thing we do before entering the main loop
@@ -259,6 +318,59 @@ int main(int argc, char *argv[])
 	return 0;
 }
 
+// prints the time since the last stage if "--profile-startup" was passed, returns stageOK
+static bool profileStage(const char *stageName, bool stageOK)
+{
+	if (profileStartup)
+	{
+		const uint64_t time64 = SDL_GetPerformanceCounter();
+		printf("%-32s %9.3f ms%s\n", stageName, (time64 - profileStageTime64) * (1000.0 / SDL_GetPerformanceFrequency()), stageOK ? "" : " (failed)");
+
+		profileStageTime64 = time64;
+	}
+
+	return stageOK;
+}
+
+// removes the flag and its value from the arguments, returns the value (or NULL if the flag wasn't there)
+static const char *takeValueFromArgs(int *argc, char **argv, const char *flag)
+{
+	for (int i = 1; i < *argc-1; i++)
+	{
+		if (!strcmp(argv[i], flag))
+		{
+			const char *value = argv[i+1];
+
+			for (; i < *argc-2; i++)
+				argv[i] = argv[i+2];
+
+			*argc -= 2;
+			argv[*argc] = argv[*argc+1] = NULL;
+			return value;
+		}
+	}
+
+	return NULL;
+}
+
+// removes the flag from the arguments (so that it's not taken for a module filename), returns true if it was there
+static bool takeFlagFromArgs(int *argc, char **argv, const char *flag)
+{
+	for (int i = 1; i < *argc; i++)
+	{
+		if (!strcmp(argv[i], flag))
+		{
+			for (; i < *argc-1; i++)
+				argv[i] = argv[i+1];
+
+			argv[--(*argc)] = NULL;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 static void initializeVars(void)
 {
 	cpu.hasSSE = SDL_HasSSE();
@@ -328,14 +440,12 @@ static void initializeVars(void)
 static void cleanUpAndExit(void) // never call this inside the main loop!
 {
 #ifdef HAS_MIDI
-#ifdef __APPLE__
-	// on Mac we used a thread to init MIDI (as it could take several seconds)
+	// we used a thread to init MIDI (as it could take several seconds)
 	if (midi.initMidiThread != NULL)
 	{
 		SDL_WaitThread(midi.initMidiThread, NULL);
 		midi.initMidiThread = NULL;
 	}
-#endif
 	midi.enable = false; // stop MIDI callback from doing things
 	while (midi.callbackBusy) SDL_Delay(1); // wait for MIDI callback to finish
 
@@ -358,6 +468,8 @@ static void cleanUpAndExit(void) // never call this inside the main loop!
 
 	closeAudio();
 	closeReplayer();
+	freeUndoJournal();
+	freeSmpEdit();
 	closeVideo();
 	freeSprites();
 	freeDiskOp();
@@ -387,7 +499,7 @@ static void cleanUpAndExit(void) // never call this inside the main loop!
 		editor.binaryPathU = NULL;
 	}
 
-#ifdef _WIN32
+#if defined _WIN32 || defined __linux__
 	closeSingleInstancing();
 #endif
 
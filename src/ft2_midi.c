@@ -229,6 +229,7 @@ void recordMIDIEffect(uint8_t efx, uint8_t efxData)
 				{
 					p->efx = efx;
 					p->efxData = efxData;
+					pattUsageChanged(editor.editPattern);
 					setSongModifiedFlag();
 				}
 			}
@@ -245,6 +246,7 @@ void recordMIDIEffect(uint8_t efx, uint8_t efxData)
 
 		p->efx = efx;
 		p->efxData = efxData;
+		pattUsageChanged(editor.editPattern);
 	}
 }
 
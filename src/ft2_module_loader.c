@@ -25,6 +25,8 @@
 #include "ft2_video.h"
 #include "ft2_structs.h"
 #include "ft2_sysreqs.h"
+#include "ft2_undo.h"
+#include "ft2_module_loader.h"
 
 bool detectBEM(FILE *f);
 bool loadBEM(FILE *f, uint32_t filesize);
@@ -62,6 +64,7 @@ char *supportedModExtensions[] =
 
 // globals for module loaders
 volatile bool tmpLinearPeriodsFlag;
+bool tmpSkipSampleData; // used by the module probe (metadata only)
 int16_t patternNumRowsTmp[MAX_PATTERNS];
 note_t *patternTmp[MAX_PATTERNS];
 instr_t *instrTmp[1+256];
@@ -71,11 +74,11 @@ song_t songTmp;
 static volatile bool musicIsLoading, moduleLoaded, moduleFailedToLoad;
 static SDL_Thread *thread;
 static uint8_t oldPlayMode;
+static void installLoadedModule(void);
 static void setupLoadedModule(void);
-static void freeTmpModule(void);
 
 // Crude module detection routine. These aren't always accurate detections!
-static int8_t detectModule(FILE *f)
+int8_t detectModule(FILE *f)
 {
 	uint8_t D[256], I[4];
 
@@ -192,21 +195,7 @@ static bool doLoadMusic(bool externalThreadFlag)
 	uint32_t filesize = ftell(f);
 
 	rewind(f);
-	switch (format)
-	{
-		case FORMAT_XM: moduleLoaded = loadXM(f, filesize); break;
-		case FORMAT_S3M: moduleLoaded = loadS3M(f, filesize); break;
-		case FORMAT_STM: moduleLoaded = loadSTM(f, filesize); break;
-		case FORMAT_MOD: moduleLoaded = loadMOD(f, filesize); break;
-		case FORMAT_POSSIBLY_STK: moduleLoaded = loadSTK(f, filesize); break;
-		case FORMAT_DIGI: moduleLoaded = loadDIGI(f, filesize); break;
-		case FORMAT_BEM: moduleLoaded = loadBEM(f, filesize); break;
-		case FORMAT_IT: moduleLoaded = loadIT(f, filesize); break;
-
-		default:
-			loaderMsgBox("This file is not a supported module!");
-		break;
-	}
+	moduleLoaded = loadTmpModule(f, format, filesize);
 	fclose(f);
 
 	if (!moduleLoaded)
@@ -229,7 +218,44 @@ loadError:
 	return false;
 }
 
-static void clearTmpModule(void)
+const char *getModuleFormatName(int8_t format)
+{
+	switch (format)
+	{
+		case FORMAT_XM: return "XM";
+		case FORMAT_MOD: return "MOD";
+		case FORMAT_POSSIBLY_STK: return "STK";
+		case FORMAT_S3M: return "S3M";
+		case FORMAT_STM: return "STM";
+		case FORMAT_DIGI: return "DIGI";
+		case FORMAT_BEM: return "BEM";
+		case FORMAT_IT: return "IT";
+		default: return "Unknown";
+	}
+}
+
+bool loadTmpModule(FILE *f, int8_t format, uint32_t filesize)
+{
+	switch (format)
+	{
+		case FORMAT_XM: return loadXM(f, filesize);
+		case FORMAT_S3M: return loadS3M(f, filesize);
+		case FORMAT_STM: return loadSTM(f, filesize);
+		case FORMAT_MOD: return loadMOD(f, filesize);
+		case FORMAT_POSSIBLY_STK: return loadSTK(f, filesize);
+		case FORMAT_DIGI: return loadDIGI(f, filesize);
+		case FORMAT_BEM: return loadBEM(f, filesize);
+		case FORMAT_IT: return loadIT(f, filesize);
+
+		default:
+			loaderMsgBox("This file is not a supported module!");
+		break;
+	}
+
+	return false;
+}
+
+void clearTmpModule(void)
 {
 	memset(patternTmp, 0, sizeof (patternTmp));
 	memset(instrTmp, 0, sizeof (instrTmp));
@@ -294,6 +320,39 @@ bool loadMusicUnthreaded(UNICHAR *filenameU, bool autoPlay)
 	return false;
 }
 
+bool loadMusicHeadless(UNICHAR *filenameU)
+{
+	FILE *f = UNICHAR_FOPEN(filenameU, "rb");
+	if (f == NULL)
+		return false;
+
+	const bool loaded = loadMusicHeadlessFromFile(f);
+	fclose(f);
+
+	return loaded;
+}
+
+bool loadMusicHeadlessFromFile(FILE *f)
+{
+	clearTmpModule(); // clear stuff from last loading session (very important)
+
+	const int8_t format = detectModule(f);
+	fseek(f, 0, SEEK_END);
+	const uint32_t filesize = ftell(f);
+
+	rewind(f);
+	const bool loaded = loadTmpModule(f, format, filesize);
+
+	if (!loaded)
+	{
+		freeTmpModule();
+		return false;
+	}
+
+	installLoadedModule();
+	return true;
+}
+
 bool allocateTmpPatt(int32_t pattNum, uint16_t numRows)
 {
 	patternTmp[pattNum] = (note_t *)calloc((MAX_PATT_LEN * TRACK_WIDTH) + 16, 1);
@@ -324,7 +383,7 @@ bool allocateTmpInstr(int16_t insNum)
 	return true;
 }
 
-static void freeTmpModule(void) // called on module load error
+void freeTmpModule(void) // called on module load error
 {
 	// free all patterns
 	for (int32_t i = 0; i < MAX_PATTERNS; i++)
@@ -380,8 +439,8 @@ void clearUnusedChannels(note_t *pattPtr, int16_t numRows, int32_t numChannels)
 		memset(p, 0, width);
 }
 
-// called from input/video thread after the module was done loading
-static void setupLoadedModule(void)
+// replaces the song with the loaded module (no GUI updates)
+static void installLoadedModule(void)
 {
 	lockMixerCallback();
 
@@ -479,9 +538,6 @@ static void setupLoadedModule(void)
 		}
 	}
 
-	setScrollBarEnd(SB_POS_ED, (song.songLength - 1) + 5);
-	setScrollBarPos(SB_POS_ED, 0, false);
-
 	resetChannels();
 	setPos(0, 0, true);
 	setMixerBPM(song.BPM);
@@ -495,6 +551,17 @@ static void setupLoadedModule(void)
 	setLinearPeriods(tmpLinearPeriodsFlag);
 
 	unlockMixerCallback();
+}
+
+// called from input/video thread after the module was done loading
+static void setupLoadedModule(void)
+{
+	clearUndoJournal(); // the undo steps belong to the old song
+
+	installLoadedModule();
+
+	setScrollBarEnd(SB_POS_ED, (song.songLength - 1) + 5);
+	setScrollBarPos(SB_POS_ED, 0, false);
 
 	editor.currVolEnvPoint = 0;
 	editor.currPanEnvPoint = 0;
@@ -731,6 +798,69 @@ void loadDroppedFile(char *fullPathUTF8, bool songModifiedCheck)
 	free(fullPathU);
 }
 
+void loadDroppedFiles(char **fullPathsUTF8, int32_t numFiles)
+{
+	int32_t i;
+
+	if (ui.sysReqShown || fullPathsUTF8 == NULL || numFiles <= 0)
+		return;
+
+	if (numFiles == 1)
+	{
+		loadDroppedFile(fullPathsUTF8[0], true);
+		return;
+	}
+
+	UNICHAR **fullPathsU = (UNICHAR **)calloc(numFiles, sizeof (UNICHAR *));
+	if (fullPathsU == NULL)
+	{
+		okBox(0, "System message", "Not enough memory!", NULL);
+		return;
+	}
+
+	// several samples can be imported in one go, anything else only loads the first file (like before)
+	bool allSamples = true;
+	for (i = 0; i < numFiles; i++)
+	{
+		const int32_t fullPathLen = (const int32_t)strlen(fullPathsUTF8[i]);
+
+		fullPathsU[i] = (UNICHAR *)malloc((fullPathLen + 1) * sizeof (UNICHAR));
+		if (fullPathsU[i] == NULL)
+		{
+			okBox(0, "System message", "Not enough memory!", NULL);
+			goto freeMem;
+		}
+
+#ifdef _WIN32
+		MultiByteToWideChar(CP_UTF8, 0, fullPathsUTF8[i], -1, fullPathsU[i], fullPathLen+1);
+#else
+		strcpy(fullPathsU[i], fullPathsUTF8[i]);
+#endif
+		if (fileIsInstr(fullPathsU[i]) || fileIsModule(fullPathsU[i]))
+			allSamples = false;
+	}
+
+	if (!allSamples)
+	{
+		loadDroppedFile(fullPathsUTF8[0], true);
+		goto freeMem;
+	}
+
+	exitTextEditing();
+
+	const int16_t answer = okBox(6, "System request", "Import the samples into consecutive samples or instruments?", NULL);
+	if (answer == 1 || answer == 2)
+		loadSamples(fullPathsU, numFiles, answer == 2);
+
+freeMem:
+	for (i = 0; i < numFiles; i++)
+	{
+		if (fullPathsU[i] != NULL)
+			free(fullPathsU[i]);
+	}
+	free(fullPathsU);
+}
+
 static void handleOldPlayMode(void)
 {
 	playMode = oldPlayMode;
@@ -1,24 +1,38 @@
 #pragma once
 
+#include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include "ft2_header.h"
 #include "ft2_unicode.h"
 
+int8_t detectModule(FILE *f);
+const char *getModuleFormatName(int8_t format);
+bool loadTmpModule(FILE *f, int8_t format, uint32_t filesize); // loads into songTmp/patternTmp/instrTmp
+void clearTmpModule(void);
+void freeTmpModule(void);
 bool tmpPatternEmpty(uint16_t pattNum);
 void clearUnusedChannels(note_t *p, int16_t numRows, int32_t numChannels);
 bool allocateTmpInstr(int16_t insNum);
 bool allocateTmpPatt(int32_t pattNum, uint16_t numRows);
 void loadMusic(UNICHAR *filenameU);
 bool loadMusicUnthreaded(UNICHAR *filenameU, bool autoPlay);
+
+/* Loads a module into the song without touching the GUI (for the render test).
+** Set loaderMsgBox/loaderSysReq first, the loaders may use them.
+*/
+bool loadMusicHeadless(UNICHAR *filenameU);
+bool loadMusicHeadlessFromFile(FILE *f); // the file is left open
 bool handleModuleLoadFromArg(int argc, char **argv);
 void loadDroppedFile(char *fullPathUTF8, bool songModifiedCheck);
+void loadDroppedFiles(char **fullPathsUTF8, int32_t numFiles); // batch imports samples if there are several
 void handleLoadMusicEvents(void);
 
 // file extensions accepted by Disk Op. in module mode
 extern char *supportedModExtensions[];
 
 extern volatile bool tmpLinearPeriodsFlag;
+extern bool tmpSkipSampleData;
 extern int16_t patternNumRowsTmp[MAX_PATTERNS];
 extern note_t *patternTmp[MAX_PATTERNS];
 extern instr_t *instrTmp[1+256];
@@ -0,0 +1,742 @@
+// for finding memory leaks in debug mode with Visual Studio
+#if defined _DEBUG && defined _MSC_VER
+#include <crtdbg.h>
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+#include "ft2_header.h"
+#include "ft2_module_loader.h"
+#include "ft2_module_probe.h"
+#include "ft2_sysreqs.h"
+
+#define PROBE_MAX_FILESIZE (512UL*1024*1024) // same limit as handleModuleLoadFromArg()
+
+typedef struct probeSong_t // the bits of a song needed to calculate its duration (see walkSongFlow())
+{
+	song_t song;
+	note_t *pattern[MAX_PATTERNS];
+	int16_t numRows[MAX_PATTERNS];
+} probeSong_t;
+
+typedef struct strBuf_t
+{
+	char *data;
+	size_t len, size;
+} strBuf_t;
+
+typedef struct scanJob_t
+{
+	bool csvFlag;
+	int32_t numFiles;
+	UNICHAR **filesU;
+	char **filesUTF8;
+	void *volatile *records; // formatted output per file, set by the workers
+	SDL_atomic_t nextFile, numLoaded;
+} scanJob_t;
+
+static SDL_mutex *loaderMutex; // the module loaders share global state, only one may run at a time
+
+// the loaders may want to show message boxes, don't do that while probing
+static void probeMsgBox(const char *text, ...)
+{
+	(void)text;
+}
+
+static int16_t probeSysReq(int16_t type, const char *headline, const char *text, void (*checkBoxCallback)(void))
+{
+	(void)type;
+	(void)headline;
+	(void)text;
+	(void)checkBoxCallback;
+
+	return 1; // "OK"
+}
+
+bool probeModule(UNICHAR *filenameU, moduleInfo_t *info)
+{
+	memset(info, 0, sizeof (moduleInfo_t));
+
+	FILE *f = UNICHAR_FOPEN(filenameU, "rb");
+	if (f == NULL)
+		return false;
+
+	fseek(f, 0, SEEK_END);
+	const long filesize = ftell(f);
+	if (filesize <= 0 || (unsigned long)filesize >= PROBE_MAX_FILESIZE)
+	{
+		fclose(f);
+		return false;
+	}
+
+	probeSong_t *s = (probeSong_t *)calloc(1, sizeof (probeSong_t));
+	if (s == NULL)
+	{
+		fclose(f);
+		return false;
+	}
+
+	if (loaderMutex != NULL)
+		SDL_LockMutex(loaderMutex);
+
+	// restored below, probing must not change where the tracker's own loads report to
+	void (*oldLoaderMsgBox)(const char *, ...) = loaderMsgBox;
+	int16_t (*oldLoaderSysReq)(int16_t, const char *, const char *, void (*)(void)) = loaderSysReq;
+
+	loaderMsgBox = probeMsgBox;
+	loaderSysReq = probeSysReq;
+	tmpSkipSampleData = true;
+
+	clearTmpModule();
+
+	rewind(f);
+	const int8_t format = detectModule(f);
+	rewind(f);
+
+	const bool loaded = loadTmpModule(f, format, (uint32_t)filesize);
+	fclose(f);
+
+	if (loaded)
+	{
+		info->format = format;
+		info->filesize = (uint32_t)filesize;
+		info->linearPeriods = tmpLinearPeriodsFlag;
+
+		memcpy(info->name, songTmp.name, sizeof (info->name));
+		memcpy(info->instrName, songTmp.instrName, sizeof (info->instrName));
+		fixString(info->name, 19);
+		for (int32_t i = 1; i <= MAX_INST; i++)
+			fixString(info->instrName[i], 21);
+
+		// same sanitation as setupLoadedModule()
+		info->numChannels = songTmp.numChannels;
+		if (info->numChannels & 1)
+			info->numChannels++;
+
+		info->numChannels = CLAMP(info->numChannels, 2, MAX_CHANNELS);
+		info->songLength = CLAMP(songTmp.songLength, 1, MAX_ORDERS);
+		info->BPM = CLAMP(songTmp.BPM, MIN_BPM, MAX_BPM);
+		info->speed = CLAMP(songTmp.speed, 1, MAX_SPEED);
+		info->songLoopStart = (songTmp.songLoopStart < info->songLength) ? songTmp.songLoopStart : 0;
+
+		for (int32_t i = 1; i <= MAX_INST; i++)
+		{
+			if (instrTmp[i] == NULL)
+				continue;
+
+			info->numInstr++;
+			for (int32_t j = 0; j < MAX_SMP_PER_INST; j++)
+			{
+				if (instrTmp[i]->smp[j].length > 0)
+					info->numSamples++;
+			}
+		}
+
+		// take over the pattern data so that the duration can be calculated outside of the lock
+		for (int32_t i = 0; i < MAX_PATTERNS; i++)
+		{
+			s->pattern[i] = patternTmp[i];
+			s->numRows[i] = CLAMP(patternNumRowsTmp[i], 1, MAX_PATT_LEN);
+			patternTmp[i] = NULL;
+
+			if (s->pattern[i] != NULL)
+				info->numPatterns++;
+		}
+
+		memcpy(s->song.orders, songTmp.orders, sizeof (s->song.orders));
+		s->song.songLength = info->songLength;
+		s->song.songLoopStart = info->songLoopStart;
+		s->song.BPM = info->BPM;
+		s->song.speed = info->speed;
+		s->song.numChannels = info->numChannels;
+	}
+
+	freeTmpModule();
+	tmpSkipSampleData = false;
+
+	loaderMsgBox = oldLoaderMsgBox;
+	loaderSysReq = oldLoaderSysReq;
+
+	if (loaderMutex != NULL)
+		SDL_UnlockMutex(loaderMutex);
+
+	if (loaded)
+	{
+		walkSongFlow(&s->song, s->pattern, s->numRows, NULL, NULL, &info->dDurationSecs, NULL);
+
+		for (int32_t i = 0; i < MAX_PATTERNS; i++)
+		{
+			if (s->pattern[i] != NULL)
+				free(s->pattern[i]);
+		}
+	}
+
+	free(s);
+	return loaded;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+static bool strBufAppend(strBuf_t *b, const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	int32_t len = vsnprintf(NULL, 0, fmt, args);
+	va_end(args);
+
+	if (len < 0)
+		return false;
+
+	if (b->len+len+1 > b->size)
+	{
+		size_t newSize = (b->size == 0) ? 1024 : b->size;
+		while (b->len+len+1 > newSize)
+			newSize *= 2;
+
+		char *newData = (char *)realloc(b->data, newSize);
+		if (newData == NULL)
+			return false;
+
+		b->data = newData;
+		b->size = newSize;
+	}
+
+	va_start(args, fmt);
+	vsnprintf(&b->data[b->len], len+1, fmt, args);
+	va_end(args);
+
+	b->len += len;
+	return true;
+}
+
+// appends a quoted string, 'src' is UTF-8
+static void strBufAppendQuoted(strBuf_t *b, const char *src, bool csvFlag)
+{
+	strBufAppend(b, "\"");
+
+	if (src != NULL)
+	{
+		for (const uint8_t *p = (const uint8_t *)src; *p != '\0'; p++)
+		{
+			const uint8_t chr = *p;
+
+			if (csvFlag)
+			{
+				if (chr == '"')
+					strBufAppend(b, "\"\"");
+				else
+					strBufAppend(b, "%c", chr);
+			}
+			else
+			{
+				     if (chr == '"')  strBufAppend(b, "\\\"");
+				else if (chr == '\\') strBufAppend(b, "\\\\");
+				else if (chr < 0x20)  strBufAppend(b, "\\u%04X", chr);
+				else                  strBufAppend(b, "%c", chr);
+			}
+		}
+	}
+
+	strBufAppend(b, "\"");
+}
+
+static void strBufAppendCP850(strBuf_t *b, char *src, bool csvFlag)
+{
+	char *utf8 = cp850ToUtf8(src); // returns NULL on empty strings
+	strBufAppendQuoted(b, utf8, csvFlag);
+
+	if (utf8 != NULL)
+		free(utf8);
+}
+
+static char *formatRecord(const char *filenameUTF8, bool loaded, moduleInfo_t *info, bool csvFlag)
+{
+	strBuf_t b;
+	memset(&b, 0, sizeof (b));
+
+	if (csvFlag)
+	{
+		strBufAppendQuoted(&b, filenameUTF8, true);
+		if (loaded)
+		{
+			strBufAppend(&b, ",%s,", getModuleFormatName(info->format));
+			strBufAppendCP850(&b, info->name, true);
+			strBufAppend(&b, ",%d,%d,%d,%d,%d,%d,%d,%d,%d,%u,%.3f,", info->numChannels, info->numPatterns,
+				info->numInstr, info->numSamples, info->songLength, info->songLoopStart,
+				info->BPM, info->speed, info->linearPeriods, info->filesize, info->dDurationSecs);
+
+			// instrument names are joined with '|' (CSV has no lists)
+			strBuf_t names;
+			memset(&names, 0, sizeof (names));
+			strBufAppend(&names, "");
+
+			int32_t lastInstr = MAX_INST;
+			while (lastInstr > 0 && info->instrName[lastInstr][0] == '\0')
+				lastInstr--;
+
+			for (int32_t i = 1; i <= lastInstr; i++)
+			{
+				char *utf8 = cp850ToUtf8(info->instrName[i]);
+				strBufAppend(&names, "%s%s", (i > 1) ? "|" : "", (utf8 != NULL) ? utf8 : "");
+				if (utf8 != NULL)
+					free(utf8);
+			}
+
+			strBufAppendQuoted(&b, names.data, true);
+			free(names.data);
+
+			strBufAppend(&b, ",\n");
+		}
+		else
+		{
+			strBufAppend(&b, ",,,,,,,,,,,,,,,\"not a supported module (or corrupt)\"\n");
+		}
+	}
+	else
+	{
+		strBufAppend(&b, "  {\n    \"file\": ");
+		strBufAppendQuoted(&b, filenameUTF8, false);
+
+		if (loaded)
+		{
+			strBufAppend(&b, ",\n    \"format\": \"%s\",\n    \"name\": ", getModuleFormatName(info->format));
+			strBufAppendCP850(&b, info->name, false);
+			strBufAppend(&b, ",\n    \"channels\": %d,\n    \"patterns\": %d,\n    \"instruments\": %d,\n"
+				"    \"samples\": %d,\n    \"songLength\": %d,\n    \"restartPos\": %d,\n    \"bpm\": %d,\n"
+				"    \"speed\": %d,\n    \"linearPeriods\": %s,\n    \"filesize\": %u,\n    \"duration\": %.3f,\n"
+				"    \"instrumentNames\": [", info->numChannels, info->numPatterns, info->numInstr,
+				info->numSamples, info->songLength, info->songLoopStart, info->BPM, info->speed,
+				info->linearPeriods ? "true" : "false", info->filesize, info->dDurationSecs);
+
+			int32_t lastInstr = MAX_INST;
+			while (lastInstr > 0 && info->instrName[lastInstr][0] == '\0')
+				lastInstr--;
+
+			for (int32_t i = 1; i <= lastInstr; i++)
+			{
+				if (i > 1)
+					strBufAppend(&b, ", ");
+
+				strBufAppendCP850(&b, info->instrName[i], false);
+			}
+
+			strBufAppend(&b, "]\n  }");
+		}
+		else
+		{
+			strBufAppend(&b, ",\n    \"error\": \"not a supported module (or corrupt)\"\n  }");
+		}
+	}
+
+	if (b.data == NULL) // out of memory, make sure that the printing loop doesn't stall
+		b.data = strdup("");
+
+	return b.data;
+}
+
+static int32_t SDLCALL scanThread(void *ptr)
+{
+	scanJob_t *job = (scanJob_t *)ptr;
+	moduleInfo_t *info = (moduleInfo_t *)malloc(sizeof (moduleInfo_t));
+
+	while (true)
+	{
+		const int32_t i = SDL_AtomicAdd(&job->nextFile, 1);
+		if (i >= job->numFiles)
+			break;
+
+		char *record;
+		if (info == NULL)
+		{
+			record = formatRecord(job->filesUTF8[i], false, NULL, job->csvFlag);
+		}
+		else
+		{
+			const bool loaded = probeModule(job->filesU[i], info);
+			if (loaded)
+				SDL_AtomicAdd(&job->numLoaded, 1);
+
+			record = formatRecord(job->filesUTF8[i], loaded, info, job->csvFlag);
+		}
+
+		SDL_AtomicSetPtr((void **)&job->records[i], record);
+	}
+
+	if (info != NULL)
+		free(info);
+
+	return true;
+}
+
+static bool isModuleFilename(const char *filenameUTF8)
+{
+	const char *name = strrchr(filenameUTF8, DIR_DELIMITER);
+	name = (name == NULL) ? filenameUTF8 : name+1;
+
+	// Amiga-style prefixes ("mod.song", "stk.song")
+	if (!_strnicmp(name, "mod.", 4) || !_strnicmp(name, "stk.", 4))
+		return true;
+
+	const char *ext = strrchr(name, '.');
+	if (ext == NULL)
+		return false;
+
+	ext++;
+	for (int32_t i = 0; strcmp(supportedModExtensions[i], "END_OF_LIST"); i++)
+	{
+		if (!_stricmp(ext, supportedModExtensions[i]))
+			return true;
+	}
+
+	return false;
+}
+
+static bool addFile(scanJob_t *job, int32_t *listSize, UNICHAR *pathU, char *pathUTF8)
+{
+	if (job->numFiles >= *listSize)
+	{
+		const int32_t newSize = (*listSize == 0) ? 256 : *listSize * 2;
+
+		UNICHAR **newFilesU = (UNICHAR **)realloc(job->filesU, newSize * sizeof (UNICHAR *));
+		if (newFilesU == NULL)
+			return false;
+		job->filesU = newFilesU;
+
+		char **newFilesUTF8 = (char **)realloc(job->filesUTF8, newSize * sizeof (char *));
+		if (newFilesUTF8 == NULL)
+			return false;
+		job->filesUTF8 = newFilesUTF8;
+
+		*listSize = newSize;
+	}
+
+	job->filesU[job->numFiles] = pathU;
+	job->filesUTF8[job->numFiles] = pathUTF8;
+	job->numFiles++;
+
+	return true;
+}
+
+#ifdef _WIN32
+static char *unicharToUtf8(const UNICHAR *src)
+{
+	const int32_t reqSize = WideCharToMultiByte(CP_UTF8, 0, src, -1, NULL, 0, NULL, NULL);
+	if (reqSize <= 0)
+		return NULL;
+
+	char *dst = (char *)malloc(reqSize);
+	if (dst == NULL)
+		return NULL;
+
+	WideCharToMultiByte(CP_UTF8, 0, src, -1, dst, reqSize, NULL, NULL);
+	return dst;
+}
+
+static void collectFiles(scanJob_t *job, int32_t *listSize, const UNICHAR *dirU)
+{
+	WIN32_FIND_DATAW fData;
+
+	const size_t dirLen = wcslen(dirU);
+	UNICHAR *searchU = (UNICHAR *)malloc((dirLen + 3) * sizeof (UNICHAR));
+	if (searchU == NULL)
+		return;
+
+	wcscpy(searchU, dirU);
+	wcscat(searchU, L"\\*");
+
+	HANDLE hFind = FindFirstFileW(searchU, &fData);
+	free(searchU);
+
+	if (hFind == INVALID_HANDLE_VALUE)
+		return;
+
+	do
+	{
+		if (!wcscmp(fData.cFileName, L".") || !wcscmp(fData.cFileName, L".."))
+			continue;
+
+		UNICHAR *pathU = (UNICHAR *)malloc((dirLen + wcslen(fData.cFileName) + 2) * sizeof (UNICHAR));
+		if (pathU == NULL)
+			break;
+
+		wcscpy(pathU, dirU);
+		wcscat(pathU, L"\\");
+		wcscat(pathU, fData.cFileName);
+
+		if (fData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+		{
+			if (!(fData.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)) // don't follow junctions
+				collectFiles(job, listSize, pathU);
+
+			free(pathU);
+			continue;
+		}
+
+		char *pathUTF8 = unicharToUtf8(pathU);
+		if (pathUTF8 == NULL || !isModuleFilename(pathUTF8) || !addFile(job, listSize, pathU, pathUTF8))
+		{
+			if (pathUTF8 != NULL)
+				free(pathUTF8);
+
+			free(pathU);
+		}
+	}
+	while (FindNextFileW(hFind, &fData));
+
+	FindClose(hFind);
+}
+#else
+static void collectFiles(scanJob_t *job, int32_t *listSize, const char *dir)
+{
+	struct stat st;
+
+	DIR *hDir = opendir(dir);
+	if (hDir == NULL)
+		return;
+
+	const size_t dirLen = strlen(dir);
+
+	struct dirent *fData;
+	while ((fData = readdir(hDir)) != NULL)
+	{
+		if (!strcmp(fData->d_name, ".") || !strcmp(fData->d_name, ".."))
+			continue;
+
+		char *path = (char *)malloc(dirLen + strlen(fData->d_name) + 2);
+		if (path == NULL)
+			break;
+
+		strcpy(path, dir);
+		if (dirLen > 0 && dir[dirLen-1] != '/')
+			strcat(path, "/");
+		strcat(path, fData->d_name);
+
+		if (lstat(path, &st) != 0 || S_ISLNK(st.st_mode)) // don't follow symlinks (loops)
+		{
+			free(path);
+			continue;
+		}
+
+		if (S_ISDIR(st.st_mode))
+		{
+			collectFiles(job, listSize, path);
+			free(path);
+			continue;
+		}
+
+		if (!S_ISREG(st.st_mode) || !isModuleFilename(path))
+		{
+			free(path);
+			continue;
+		}
+
+		char *pathUTF8 = strdup(path);
+		if (pathUTF8 == NULL || !addFile(job, listSize, path, pathUTF8))
+		{
+			if (pathUTF8 != NULL)
+				free(pathUTF8);
+
+			free(path);
+		}
+	}
+
+	closedir(hDir);
+}
+#endif
+
+typedef struct fileListEntry_t
+{
+	UNICHAR *pathU;
+	char *pathUTF8;
+} fileListEntry_t;
+
+static int fileListCompare(const void *a, const void *b)
+{
+	return strcmp(((const fileListEntry_t *)a)->pathUTF8, ((const fileListEntry_t *)b)->pathUTF8);
+}
+
+int32_t listModuleFiles(const char *dirUTF8, UNICHAR ***filesU, char ***filesUTF8)
+{
+	scanJob_t job;
+	memset(&job, 0, sizeof (job));
+
+	int32_t listSize = 0;
+#ifdef _WIN32
+	const int32_t dirLen = (int32_t)strlen(dirUTF8);
+	UNICHAR *dirU = (UNICHAR *)malloc((dirLen + 1) * sizeof (UNICHAR));
+	if (dirU == NULL)
+		return -1;
+
+	MultiByteToWideChar(CP_UTF8, 0, dirUTF8, -1, dirU, dirLen+1);
+	collectFiles(&job, &listSize, dirU);
+	free(dirU);
+#else
+	collectFiles(&job, &listSize, dirUTF8);
+#endif
+
+	// sort by path, so that the output doesn't depend on the directory order
+	if (job.numFiles > 1)
+	{
+		fileListEntry_t *entries = (fileListEntry_t *)malloc(job.numFiles * sizeof (fileListEntry_t));
+		if (entries != NULL)
+		{
+			for (int32_t i = 0; i < job.numFiles; i++)
+			{
+				entries[i].pathU = job.filesU[i];
+				entries[i].pathUTF8 = job.filesUTF8[i];
+			}
+
+			qsort(entries, job.numFiles, sizeof (fileListEntry_t), fileListCompare);
+
+			for (int32_t i = 0; i < job.numFiles; i++)
+			{
+				job.filesU[i] = entries[i].pathU;
+				job.filesUTF8[i] = entries[i].pathUTF8;
+			}
+
+			free(entries);
+		}
+	}
+
+	*filesU = job.filesU;
+	*filesUTF8 = job.filesUTF8;
+	return job.numFiles;
+}
+
+void freeModuleFileList(int32_t numFiles, UNICHAR **filesU, char **filesUTF8)
+{
+	for (int32_t i = 0; i < numFiles; i++)
+	{
+		if (filesU != NULL && filesU[i] != NULL) free(filesU[i]);
+		if (filesUTF8 != NULL && filesUTF8[i] != NULL) free(filesUTF8[i]);
+	}
+
+	if (filesU != NULL) free(filesU);
+	if (filesUTF8 != NULL) free(filesUTF8);
+}
+
+int32_t scanModulesFromArgs(int argc, char **argv)
+{
+	bool csvFlag = false;
+	const char *dirUTF8 = NULL, *outFilename = NULL;
+
+	for (int32_t i = 2; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "--csv"))
+			csvFlag = true;
+		else if (!strcmp(argv[i], "--output") && i+1 < argc)
+			outFilename = argv[++i];
+		else if (dirUTF8 == NULL)
+			dirUTF8 = argv[i];
+	}
+
+	if (dirUTF8 == NULL)
+	{
+		fprintf(stderr, "Usage: ft2-clone --scan <directory> [--csv] [--output <file>]\n");
+		return 1;
+	}
+
+	scanJob_t job;
+	memset(&job, 0, sizeof (job));
+	job.csvFlag = csvFlag;
+
+	job.numFiles = listModuleFiles(dirUTF8, &job.filesU, &job.filesUTF8);
+	if (job.numFiles < 0)
+	{
+		fprintf(stderr, "Error: Out of memory!\n");
+		return 1;
+	}
+
+	FILE *out = stdout;
+	if (outFilename != NULL)
+	{
+		out = fopen(outFilename, "w");
+		if (out == NULL)
+		{
+			fprintf(stderr, "Error: Couldn't open \"%s\" for writing!\n", outFilename);
+			freeModuleFileList(job.numFiles, job.filesU, job.filesUTF8);
+			return 1;
+		}
+	}
+
+	if (job.numFiles > 0)
+	{
+		job.records = (void *volatile *)calloc(job.numFiles, sizeof (void *));
+		if (job.records == NULL)
+		{
+			fprintf(stderr, "Error: Out of memory!\n");
+
+			if (out != stdout)
+				fclose(out);
+
+			freeModuleFileList(job.numFiles, job.filesU, job.filesUTF8);
+			return 1;
+		}
+	}
+
+	loaderMutex = SDL_CreateMutex();
+
+	int32_t numThreads = CLAMP(SDL_GetCPUCount(), 1, 64);
+	if (numThreads > job.numFiles)
+		numThreads = job.numFiles;
+
+	SDL_Thread *threads[64];
+	int32_t threadsStarted = 0;
+	for (int32_t i = 0; i < numThreads; i++)
+	{
+		threads[threadsStarted] = SDL_CreateThread(scanThread, NULL, &job);
+		if (threads[threadsStarted] != NULL)
+			threadsStarted++;
+	}
+
+	if (threadsStarted == 0 && job.numFiles > 0)
+		scanThread(&job); // couldn't create threads, do it here instead
+
+	// print the records in file list order as they get ready
+	if (csvFlag)
+		fprintf(out, "file,format,name,channels,patterns,instruments,samples,song_length,restart_pos,bpm,speed,linear_periods,filesize,duration_secs,instrument_names,error\n");
+	else
+		fprintf(out, "[\n");
+
+	for (int32_t i = 0; i < job.numFiles; i++)
+	{
+		char *record;
+		while ((record = (char *)SDL_AtomicGetPtr((void **)&job.records[i])) == NULL)
+			SDL_Delay(1);
+
+		if (!csvFlag && i > 0)
+			fprintf(out, ",\n");
+
+		fputs(record, out);
+		free(record);
+		free(job.filesU[i]);
+		free(job.filesUTF8[i]);
+	}
+
+	if (!csvFlag)
+		fprintf(out, "%s]\n", (job.numFiles > 0) ? "\n" : "");
+
+	for (int32_t i = 0; i < threadsStarted; i++)
+		SDL_WaitThread(threads[i], NULL);
+
+	if (out != stdout)
+		fclose(out);
+
+	SDL_DestroyMutex(loaderMutex);
+	loaderMutex = NULL;
+
+	if (job.filesU != NULL) free(job.filesU);
+	if (job.filesUTF8 != NULL) free(job.filesUTF8);
+	if (job.records != NULL) free((void *)job.records);
+
+	fprintf(stderr, "Scanned %d file(s), %d module(s) parsed.\n", job.numFiles, SDL_AtomicGet(&job.numLoaded));
+	return 0;
+}
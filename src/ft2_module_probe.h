@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ft2_header.h"
+#include "ft2_unicode.h"
+
+typedef struct moduleInfo_t
+{
+	bool linearPeriods;
+	int8_t format;
+	char name[20+1], instrName[1+MAX_INST][22+1]; // CP850 (like song_t)
+	uint16_t songLength, songLoopStart, numPatterns, numInstr, numSamples, BPM, speed;
+	int32_t numChannels;
+	uint32_t filesize;
+	double dDurationSecs;
+} moduleInfo_t;
+
+/* Parses a module's headers and pattern data (sample data is skipped),
+** and calculates the song duration. Does not touch the loaded song.
+** Can be called from several threads (the loader state is guarded),
+** but not while the tracker itself is loading a module.
+*/
+bool probeModule(UNICHAR *filenameU, moduleInfo_t *info);
+
+/* Lists the module files (by extension or Amiga-style prefix) in a directory and
+** its subdirectories, sorted by path. Returns the number of files (-1 = out of memory).
+*/
+int32_t listModuleFiles(const char *dirUTF8, UNICHAR ***filesU, char ***filesUTF8);
+void freeModuleFileList(int32_t numFiles, UNICHAR **filesU, char **filesUTF8);
+
+// "--scan <dir> [--csv] [--output <file>]", returns program exit code
+int32_t scanModulesFromArgs(int argc, char **argv);
@@ -11,11 +11,27 @@
 #include "ft2_mouse.h"
 #include "ft2_sample_ed.h"
 #include "ft2_module_loader.h"
+#include "ft2_pattern_ed.h"
 #include "ft2_tables.h"
 #include "ft2_structs.h"
+#include "ft2_diskop.h"
+#include "mixer/ft2_mix.h"
+
+#define PACK_MAX_THREADS 8
+#define PACK_MIN_PATTS_PER_THREAD 16
+#define DELTA_BUF_LEN 65536
+
+typedef struct pattPackJob_t
+{
+	SDL_atomic_t nextPatt;
+	int16_t numPatterns;
+	uint8_t *buffer;
+	uint32_t offsets[MAX_PATTERNS], sizes[MAX_PATTERNS];
+} pattPackJob_t;
 
 static int8_t smpChunkBuf[1024];
-static uint8_t packedPattData[65536], modPattData[64*32*4];
+static uint8_t modPattData[64*32*4], deltaBuf[DELTA_BUF_LEN];
+static pattPackJob_t packJob;
 static SDL_Thread *thread;
 
 static const char modIDs[32][5] =
@@ -28,12 +44,167 @@ static const char modIDs[32][5] =
 
 static uint16_t packPatt(uint8_t *writePtr, uint8_t *pattPtr, uint16_t numRows);
 
+// packs pattern (with header) into its slot in the job buffer
+static void packPattToJob(pattPackJob_t *job, int16_t pattNum)
+{
+	xmPatHdr_t ph;
+
+	uint8_t *slotPtr = &job->buffer[job->offsets[pattNum]];
+
+	ph.headerSize = sizeof (xmPatHdr_t);
+	ph.numRows = patternNumRows[pattNum];
+	ph.type = 0;
+	ph.dataSize = packPatt(slotPtr + sizeof (xmPatHdr_t), (uint8_t *)pattern[pattNum], patternNumRows[pattNum]);
+
+	memcpy(slotPtr, &ph, sizeof (xmPatHdr_t));
+	job->sizes[pattNum] = sizeof (xmPatHdr_t) + ph.dataSize;
+}
+
+static int32_t SDLCALL packPattThread(void *ptr)
+{
+	pattPackJob_t *job = (pattPackJob_t *)ptr;
+
+	while (true)
+	{
+		const int32_t pattNum = SDL_AtomicAdd(&job->nextPatt, 1);
+		if (pattNum >= job->numPatterns)
+			break;
+
+		packPattToJob(job, (int16_t)pattNum);
+	}
+
+	return true;
+}
+
+/* Packs all patterns (in parallel if there are many of them) and returns
+** one contiguous block with the pattern headers and data, ready for writing.
+** Returns NULL if out of memory.
+*/
+static uint8_t *packAllPatterns(int16_t numPatterns, uint32_t *length)
+{
+	pattPackJob_t *job = &packJob;
+
+	// give every pattern a worst-case slot, so that the patterns can be packed in any order
+	uint32_t bufLen = 0;
+	for (int16_t i = 0; i < numPatterns; i++)
+	{
+		job->offsets[i] = bufLen;
+
+		bufLen += sizeof (xmPatHdr_t);
+		if (pattern[i] != NULL)
+			bufLen += patternNumRows[i] * song.numChannels * sizeof (note_t);
+	}
+
+	job->buffer = (uint8_t *)malloc(bufLen + 1);
+	if (job->buffer == NULL)
+		return NULL;
+
+	job->numPatterns = numPatterns;
+	SDL_AtomicSet(&job->nextPatt, 0);
+
+	int32_t numThreads = CLAMP(SDL_GetCPUCount(), 1, PACK_MAX_THREADS);
+	if (numThreads > numPatterns / PACK_MIN_PATTS_PER_THREAD)
+		numThreads = numPatterns / PACK_MIN_PATTS_PER_THREAD;
+
+	SDL_Thread *threads[PACK_MAX_THREADS];
+	int32_t threadsStarted = 0;
+	for (int32_t i = 0; i < numThreads-1; i++) // this thread is also packing
+	{
+		threads[threadsStarted] = SDL_CreateThread(packPattThread, NULL, job);
+		if (threads[threadsStarted] != NULL)
+			threadsStarted++;
+	}
+
+	packPattThread(job);
+
+	for (int32_t i = 0; i < threadsStarted; i++)
+		SDL_WaitThread(threads[i], NULL);
+
+	// close the gaps between the slots
+	uint32_t writeOffset = 0;
+	for (int16_t i = 0; i < numPatterns; i++)
+	{
+		if (writeOffset != job->offsets[i])
+			memmove(&job->buffer[writeOffset], &job->buffer[job->offsets[i]], job->sizes[i]);
+
+		writeOffset += job->sizes[i];
+	}
+
+	*length = writeOffset;
+	return job->buffer;
+}
+
+/* Delta-encodes the sample data into a separate buffer and writes it.
+** The sample itself is left untouched, so it can keep playing while saving.
+*/
+static bool writeDeltaSample(FILE *f, const sample_t *s)
+{
+	const int32_t length = s->length;
+
+	// the interpolation taps after the loop end are stored in the sample data, write the real sample points
+	const int32_t fixedPos = s->isFixed ? s->fixedPos : -MAX_RIGHT_TAPS;
+
+	if (s->flags & SAMPLE_16BIT)
+	{
+		const int16_t *src16 = (const int16_t *)s->dataPtr;
+		int16_t *dst16 = (int16_t *)deltaBuf;
+
+		int16_t oldS16 = 0;
+		for (int32_t pos = 0; pos < length;)
+		{
+			int32_t samplesToWrite = DELTA_BUF_LEN / 2;
+			if (samplesToWrite > length-pos)
+				samplesToWrite = length-pos;
+
+			for (int32_t i = 0; i < samplesToWrite; i++, pos++)
+			{
+				int16_t smp16 = src16[pos];
+				if ((uint32_t)(pos - fixedPos) < MAX_RIGHT_TAPS)
+					smp16 = s->fixedSmp[pos - fixedPos];
+
+				dst16[i] = smp16 - oldS16;
+				oldS16 = smp16;
+			}
+
+			if (fwrite(dst16, 2, samplesToWrite, f) != (size_t)samplesToWrite)
+				return false;
+		}
+	}
+	else // 8-bit
+	{
+		const int8_t *src8 = s->dataPtr;
+		int8_t *dst8 = (int8_t *)deltaBuf;
+
+		int8_t oldS8 = 0;
+		for (int32_t pos = 0; pos < length;)
+		{
+			int32_t samplesToWrite = DELTA_BUF_LEN;
+			if (samplesToWrite > length-pos)
+				samplesToWrite = length-pos;
+
+			for (int32_t i = 0; i < samplesToWrite; i++, pos++)
+			{
+				int8_t smp8 = src8[pos];
+				if ((uint32_t)(pos - fixedPos) < MAX_RIGHT_TAPS)
+					smp8 = (int8_t)s->fixedSmp[pos - fixedPos];
+
+				dst8[i] = smp8 - oldS8;
+				oldS8 = smp8;
+			}
+
+			if (fwrite(dst8, 1, samplesToWrite, f) != (size_t)samplesToWrite)
+				return false;
+		}
+	}
+
+	return true;
+}
+
 bool saveXM(UNICHAR *filenameU)
 {
 	int16_t i, j, k, a;
-	size_t result;
+	bool emptyPatt[MAX_PATTERNS];
 	xmHdr_t h;
-	xmPatHdr_t ph;
 	instr_t *ins;
 	xmInsHdr_t ih;
 	sample_t *s;
@@ -97,17 +268,23 @@ bool saveXM(UNICHAR *filenameU)
 	h.flags = audio.linearPeriodsFlag;
 	memcpy(h.orders, song.orders, 256);
 
-	if (fwrite(&h, sizeof (h), 1, f) != 1)
+	// empty patterns are freed and saved with the default length (like FT2)
+	bool hasEmptyPatts = false;
+	for (i = 0; i < h.numPatterns; i++)
 	{
-		fclose(f);
-		okBoxThreadSafe(0, "System message", "Error saving module: general I/O error!", NULL);
-		return false;
+		emptyPatt[i] = patternEmpty(i);
+		if (emptyPatt[i])
+			hasEmptyPatts = true;
 	}
 
-	for (i = 0; i < h.numPatterns; i++)
+	if (hasEmptyPatts)
 	{
-		if (patternEmpty(i))
+		lockAudio();
+		for (i = 0; i < h.numPatterns; i++)
 		{
+			if (!emptyPatt[i])
+				continue;
+
 			if (pattern[i] != NULL)
 			{
 				free(pattern[i]);
@@ -115,36 +292,34 @@ bool saveXM(UNICHAR *filenameU)
 			}
 
 			patternNumRows[i] = 64;
+			pattUsageChanged(i);
 		}
+		unlockAudio();
+	}
 
-		ph.headerSize = sizeof (xmPatHdr_t);
-		ph.numRows = patternNumRows[i];
-		ph.type = 0;
+	uint32_t pattDataLen;
+	uint8_t *pattData = packAllPatterns(h.numPatterns, &pattDataLen);
+	if (pattData == NULL)
+	{
+		fclose(f);
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		return false;
+	}
 
-		if (pattern[i] == NULL)
-		{
-			ph.dataSize = 0;
-			if (fwrite(&ph, ph.headerSize, 1, f) != 1)
-			{
-				fclose(f);
-				okBoxThreadSafe(0, "System message", "Error saving module: general I/O error!", NULL);
-				return false;
-			}
-		}
-		else
-		{
-			ph.dataSize = packPatt(packedPattData, (uint8_t *)pattern[i], patternNumRows[i]);
+	// write header and all patterns in one go
+	size_t result = fwrite(&h, sizeof (h), 1, f);
+	if (pattDataLen > 0)
+		result += fwrite(pattData, pattDataLen, 1, f);
+	else
+		result++;
 
-			result = fwrite(&ph, ph.headerSize, 1, f);
-			result += fwrite(packedPattData, ph.dataSize, 1, f);
+	free(pattData);
 
-			if (result != 2) // write was not OK
-			{
-				fclose(f);
-				okBoxThreadSafe(0, "System message", "Error saving module: general I/O error!", NULL);
-				return false;
-			}
-		}
+	if (result != 2) // write was not OK
+	{
+		fclose(f);
+		okBoxThreadSafe(0, "System message", "Error saving module: general I/O error!", NULL);
+		return false;
 	}
 
 	memset(&ih, 0, sizeof (ih)); // important, clears reserved stuff
@@ -254,15 +429,7 @@ bool saveXM(UNICHAR *filenameU)
 			s = &instr[j]->smp[k-1];
 			if (s->dataPtr != NULL)
 			{
-				unfixSample(s);
-				samp2Delta(s->dataPtr, s->length, s->flags);
-
-				result = fwrite(s->dataPtr, 1, SAMPLE_LENGTH_BYTES(s), f);
-
-				delta2Samp(s->dataPtr, s->length, s->flags);
-				fixSample(s);
-
-				if (result != (size_t)SAMPLE_LENGTH_BYTES(s)) // write not OK
+				if (!writeDeltaSample(f, s)) // write not OK
 				{
 					fclose(f);
 					okBoxThreadSafe(0, "System message", "Error saving module: general I/O error!", NULL);
@@ -276,7 +443,7 @@ bool saveXM(UNICHAR *filenameU)
 
 	fclose(f);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 
 	setMouseBusy(false);
 	return true;
@@ -635,7 +802,7 @@ static bool saveMOD(UNICHAR *filenameU)
 	fclose(f);
 	removeSongModifiedFlag();
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 
 	setMouseBusy(false);
 	return true;
@@ -651,14 +818,17 @@ static int32_t SDLCALL saveMusicThread(void *ptr)
 	if (editor.tmpFilenameU == NULL)
 		return false;
 
-	pauseAudio();
-
 	if (editor.moduleSaveMode == 1)
-		saveXM(editor.tmpFilenameU);
+	{
+		saveXM(editor.tmpFilenameU); // doesn't modify the samples, so no need to pause audio
+	}
 	else
+	{
+		pauseAudio();
 		saveMOD(editor.tmpFilenameU);
+		resumeAudio();
+	}
 
-	resumeAudio();
 	return true;
 
 	(void)ptr;
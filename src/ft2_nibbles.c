@@ -105,17 +105,8 @@ static void drawNibblesFoodNumber(int32_t xOut, int32_t yOut, int32_t number)
 	if (number > 9)
 		return;
 
-	uint32_t *dstPtr = &video.frameBuffer[(yOut * SCREEN_W) + xOut];
-	uint8_t *srcPtr = &bmp.font8[number * FONT8_CHAR_W];
-
-	for (int32_t y = 0; y < FONT8_CHAR_H; y++, srcPtr += FONT8_WIDTH, dstPtr += SCREEN_W)
-	{
-		for (int32_t x = 0; x < FONT8_CHAR_W; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = video.palette[PAL_FORGRND];
-		}
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yOut * SCREEN_W) + xOut];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font8[number * FONT8_CHAR_W], FONT8_WIDTH, FONT8_CHAR_W, FONT8_CHAR_H, PAL_FORGRND);
 }
 
 static void redrawNibblesScreen(void)
@@ -276,20 +267,20 @@ static void nibbleWriteLevelSprite(int16_t xOut, int16_t yOut, int16_t levelNum)
 	const int32_t readY = (23 + 2) * (levelNum / 10);
 
 	const uint8_t *src = (const uint8_t *)&bmp.nibblesStages[(readY * 530) + readX];
-	uint32_t *dst = &video.frameBuffer[(yOut * SCREEN_W) + xOut];
+	uint8_t *dst = &video.frameBuffer[(yOut * SCREEN_W) + xOut];
 
 	for (int32_t y = 0; y < 23+2; y++)
 	{
 		for (int32_t x = 0; x < 51+2; x++)
-			dst[x] = video.palette[src[x]];
+			dst[x] = src[x];
 
 		src += 530;
 		dst += SCREEN_W;
 	}
 
 	// overwrite start position pixels
-	video.frameBuffer[(yOut * SCREEN_W) + (xOut + 0)] = video.palette[PAL_FORGRND];
-	video.frameBuffer[(yOut * SCREEN_W) + (xOut + 1)] = video.palette[PAL_FORGRND];
+	video.frameBuffer[(yOut * SCREEN_W) + (xOut + 0)] = PAL_FORGRND;
+	video.frameBuffer[(yOut * SCREEN_W) + (xOut + 1)] = PAL_FORGRND;
 }
 
 static void highScoreTextOutClipX(uint16_t x, uint16_t y, uint8_t paletteIndex, uint8_t shadowPaletteIndex, const char *textPtr, uint16_t clipX)
@@ -736,6 +727,12 @@ NoMove:
 
 void showNibblesScreen(void)
 {
+	if (!loadNibblesBMPs()) // not needed at startup, decoded on first use
+	{
+		okBox(0, "System message", "Not enough memory!", NULL);
+		return;
+	}
+
 	if (ui.extendedPatternEditor)
 		exitPatternEditorExtended();
 
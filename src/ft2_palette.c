@@ -26,7 +26,7 @@ void setCustomPalColor(uint32_t color)
 	video.palette[PAL_CUSTOM] = (PAL_CUSTOM << 24) | color;
 }
 
-void setPal16(pal16 *p, bool redrawScreen)
+void setPal16(pal16 *p)
 {
 #define LOOP_PIN_COL_SUB 96
 #define TEXT_MARK_COLOR 0x0078D7
@@ -48,6 +48,9 @@ void setPal16(pal16 *p, bool redrawScreen)
 
 	video.palette[PAL_TEXTMRK] = (PAL_TEXTMRK << 24) | TEXT_MARK_COLOR;
 	video.palette[PAL_BOXSLCT] = (PAL_BOXSLCT << 24) | BOX_SELECT_COLOR;
+	video.palette[PAL_TEXTPTR1] = (PAL_TEXTPTR1 << 24) | 0xB3DBF6;
+	video.palette[PAL_TEXTPTR2] = (PAL_TEXTPTR2 << 24) | 0x004ECE;
+	video.palette[PAL_TRUECOL] = (PAL_TRUECOL << 24) | 0x000000;
 
 	r = RGB32_R(video.palette[PAL_PATTEXT]);
 	g = RGB32_G(video.palette[PAL_PATTEXT]);
@@ -59,12 +62,7 @@ void setPal16(pal16 *p, bool redrawScreen)
 
 	video.palette[PAL_LOOPPIN] = (PAL_LOOPPIN << 24) | RGB32(r, g, b);
 
-	// update framebuffer pixels with new palette
-	if (redrawScreen && video.frameBuffer != NULL)
-	{
-		for (int32_t i = 0; i < SCREEN_W*SCREEN_H; i++)
-			video.frameBuffer[i] = video.palette[(video.frameBuffer[i] >> 24) & 15]; // ARGB alpha channel = palette index
-	}
+	// the framebuffer holds palette indices, so the new colors show up on the next frame
 }
 
 static void showColorErrorMsg(void)
@@ -187,7 +185,7 @@ static void paletteDragMoved(void)
 
 	setScrollBarPos(SB_PAL_CONTRAST, cfg_Contrast, false);
 
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	drawCurrentPaletteColor();
 }
 
@@ -379,7 +377,7 @@ void rbConfigPalArctic(void)
 {
 	config.cfg_StdPalNum = PAL_ARCTIC;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_ARCTIC);
 }
 
@@ -387,7 +385,7 @@ void rbConfigPalLitheDark(void)
 {
 	config.cfg_StdPalNum = PAL_LITHE_DARK;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_LITHE_DARK);
 }
 
@@ -395,7 +393,7 @@ void rbConfigPalAuroraBorealis(void)
 {
 	config.cfg_StdPalNum = PAL_AURORA_BOREALIS;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_AURORA_BOREALIS);
 }
 
@@ -403,7 +401,7 @@ void rbConfigPalRose(void)
 {
 	config.cfg_StdPalNum = PAL_ROSE;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_ROSE);
 }
 
@@ -411,7 +409,7 @@ void rbConfigPalBlues(void)
 {
 	config.cfg_StdPalNum = PAL_BLUES;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_BLUES);
 }
 
@@ -419,7 +417,7 @@ void rbConfigPalDarkMode(void)
 {
 	config.cfg_StdPalNum = PAL_DARK_MODE;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_DARK_MODE);
 }
 
@@ -427,7 +425,7 @@ void rbConfigPalGold(void)
 {
 	config.cfg_StdPalNum = PAL_GOLD;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_GOLD);
 }
 
@@ -435,7 +433,7 @@ void rbConfigPalViolent(void)
 {
 	config.cfg_StdPalNum = PAL_VIOLENT;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_VIOLENT);
 }
 
@@ -443,7 +441,7 @@ void rbConfigPalHeavyMetal(void)
 {
 	config.cfg_StdPalNum = PAL_HEAVY_METAL;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_HEAVY_METAL);
 }
 
@@ -451,7 +449,7 @@ void rbConfigPalWhyColors(void)
 {
 	config.cfg_StdPalNum = PAL_WHY_COLORS;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_WHY_COLORS);
 }
 
@@ -459,7 +457,7 @@ void rbConfigPalJungle(void)
 {
 	config.cfg_StdPalNum = PAL_JUNGLE;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_JUNGLE);
 }
 
@@ -467,6 +465,6 @@ void rbConfigPalUserDefined(void)
 {
 	config.cfg_StdPalNum = PAL_USER_DEFINED;
 	updatePaletteEditor();
-	setPal16(palTable[config.cfg_StdPalNum], true);
+	setPal16(palTable[config.cfg_StdPalNum]);
 	checkRadioButton(RB_CONFIG_PAL_USER_DEFINED);
 }
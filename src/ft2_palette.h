@@ -41,6 +41,13 @@ enum
 	// modifiable with setCustomPalColor()
 	PAL_CUSTOM = 19,
 
+	// text edit mouse pointer (on light/dark pixels)
+	PAL_TEXTPTR1 = 20,
+	PAL_TEXTPTR2 = 21,
+
+	// framebuffer pixels with this index show the true-color layer (see setTrueColorLayer())
+	PAL_TRUECOL = 22,
+
 	PAL_NUM
 };
 
@@ -63,7 +70,7 @@ pal16;
 void setCustomPalColor(uint32_t color);
 
 uint8_t palMax(int32_t c);
-void setPal16(pal16 *p, bool redrawScreen);
+void setPal16(pal16 *p);
 
 void sbPalRPos(uint32_t pos);
 void sbPalGPos(uint32_t pos);
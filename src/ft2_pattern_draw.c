@@ -33,16 +33,16 @@ static const uint16_t sharpNote2Char_big[12] = { 36*16, 37*16, 36*16, 37*16, 36*
 static const uint16_t flatNote1Char_big[12] = { 12*16, 13*16, 13*16, 14*16, 14*16, 15*16, 16*16, 16*16, 10*16, 10*16, 11*16, 11*16 };
 static const uint16_t flatNote2Char_big[12] = { 36*16, 38*16, 36*16, 38*16, 36*16, 36*16, 38*16, 36*16, 38*16, 36*16, 38*16, 36*16 };
 
-static void pattCharOut(uint32_t xPos, uint32_t yPos, uint8_t chr, uint8_t fontType, uint32_t color);
-static void drawEmptyNoteSmall(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawKeyOffSmall(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawNoteSmall(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color);
-static void drawEmptyNoteMedium(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawKeyOffMedium(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawNoteMedium(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color);
-static void drawEmptyNoteBig(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawKeyOffBig(uint32_t xPos, uint32_t yPos, uint32_t color);
-static void drawNoteBig(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color);
+static void pattCharOut(uint32_t xPos, uint32_t yPos, uint8_t chr, uint8_t fontType, uint8_t color);
+static void drawEmptyNoteSmall(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawKeyOffSmall(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawNoteSmall(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color);
+static void drawEmptyNoteMedium(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawKeyOffMedium(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawNoteMedium(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color);
+static void drawEmptyNoteBig(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawKeyOffBig(uint32_t xPos, uint32_t yPos, uint8_t color);
+static void drawNoteBig(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color);
 
 void updatePattFontPtrs(void)
 {
@@ -147,13 +147,13 @@ void drawPatternBorders(void)
 
 		if (ui.extendedPatternEditor)
 		{
-			const int32_t clearSize = ui.pattChanScrollShown ? (SCREEN_W * sizeof (int32_t) * 315) : (SCREEN_W * sizeof (int32_t) * 332);
-			memset(&video.frameBuffer[68 * SCREEN_W], 0, clearSize);
+			const int32_t clearSize = ui.pattChanScrollShown ? (SCREEN_W * 315) : (SCREEN_W * 332);
+			memset(&video.frameBuffer[68 * SCREEN_W], PAL_BCKGRND, clearSize);
 		}
 		else
 		{
-			const int32_t clearSize = ui.pattChanScrollShown ? (SCREEN_W * sizeof(int32_t) * 210) : (SCREEN_W * sizeof(int32_t) * 227);
-			memset(&video.frameBuffer[173 * SCREEN_W], 0, clearSize);
+			const int32_t clearSize = ui.pattChanScrollShown ? (SCREEN_W * 210) : (SCREEN_W * 227);
+			memset(&video.frameBuffer[173 * SCREEN_W], PAL_BCKGRND, clearSize);
 		}
 
 		drawFramework(0, pattCoord->lowerRowsY - 10, SCREEN_W, 11, FRAMEWORK_TYPE1);
@@ -185,11 +185,11 @@ static void writeCursor(void)
 	assert(editor.ptnCursorY > 0 && xPos > 0 && width > 0);
 	xPos += ((cursor.ch - ui.channelOffset) * ui.patternChannelWidth);
 
-	uint32_t *dstPtr = &video.frameBuffer[(editor.ptnCursorY * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(editor.ptnCursorY * SCREEN_W) + xPos];
 	for (int32_t y = 0; y < 9; y++)
 	{
 		for (int32_t x = 0; x < width; x++)
-			dstPtr[x] = video.palette[(dstPtr[x] >> 24) ^ 4]; // ">> 24" to get palette, XOR 4 to change to cursor palette
+			dstPtr[x] ^= 4; // XOR 4 to change to cursor palette
 
 		dstPtr += SCREEN_W;
 	}
@@ -287,13 +287,13 @@ static void writePatternBlockMark(int32_t currRow, uint32_t rowHeight, const pat
 
 	assert(x1+w <= SCREEN_W && y1+h <= SCREEN_H);
 
-	uint32_t *ptr32 = &video.frameBuffer[(y1 * SCREEN_W) + x1];
+	uint8_t *ptr8 = &video.frameBuffer[(y1 * SCREEN_W) + x1];
 	for (int32_t y = 0; y < h; y++)
 	{
 		for (int32_t x = 0; x < w; x++)
-			ptr32[x] = video.palette[(ptr32[x] >> 24) ^ 2]; // ">> 24" to get palette of pixel, XOR 2 to change to mark palette
+			ptr8[x] ^= 2; // XOR 2 to change to mark palette
 
-		ptr32 += SCREEN_W;
+		ptr8 += SCREEN_W;
 	}
 }
 
@@ -324,51 +324,36 @@ static void drawRowNums(int32_t yPos, uint8_t row, bool selectedRowFlag)
 #define LEFT_ROW_XPOS 8
 #define RIGHT_ROW_XPOS 608
 
-	uint32_t pixVal;
+	uint8_t pixVal;
 
 	// set color based on some conditions
 	if (selectedRowFlag)
-		pixVal = video.palette[PAL_FORGRND];
+		pixVal = PAL_FORGRND;
 	else if (config.ptnLineLight && !(row & 3))
-		pixVal = video.palette[PAL_BLCKTXT];
+		pixVal = PAL_BLCKTXT;
 	else
-		pixVal = video.palette[PAL_PATTEXT];
+		pixVal = PAL_PATTEXT;
 
 	if (!config.ptnHex)
 		row = hex2Dec[row];
 
 	const uint8_t *src1Ptr = &font4Ptr[(row   >> 4) * FONT4_CHAR_W];
 	const uint8_t *src2Ptr = &font4Ptr[(row & 0x0F) * FONT4_CHAR_W];
-	uint32_t *dst1Ptr = &video.frameBuffer[(yPos * SCREEN_W) + LEFT_ROW_XPOS];
-	uint32_t *dst2Ptr = dst1Ptr + (RIGHT_ROW_XPOS - LEFT_ROW_XPOS);
+	uint8_t *dst1Ptr = &video.frameBuffer[(yPos * SCREEN_W) + LEFT_ROW_XPOS];
+	uint8_t *dst2Ptr = dst1Ptr + (RIGHT_ROW_XPOS - LEFT_ROW_XPOS);
 
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W; x++)
-		{
-			if (src1Ptr[x])
-			{
-				dst1Ptr[x] = pixVal; // left side
-				dst2Ptr[x] = pixVal; // right side
-			}
+	// left side
+	glyphBlit(dst1Ptr, SCREEN_W, src1Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, pixVal);
+	glyphBlit(dst1Ptr + FONT4_CHAR_W, SCREEN_W, src2Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, pixVal);
 
-			if (src2Ptr[x])
-			{
-				dst1Ptr[FONT4_CHAR_W+x] = pixVal; // left side
-				dst2Ptr[FONT4_CHAR_W+x] = pixVal; // right side
-			}
-		}
-
-		src1Ptr += FONT4_WIDTH;
-		src2Ptr += FONT4_WIDTH;
-		dst1Ptr += SCREEN_W;
-		dst2Ptr += SCREEN_W;
-	}
+	// right side
+	glyphBlit(dst2Ptr, SCREEN_W, src1Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, pixVal);
+	glyphBlit(dst2Ptr + FONT4_CHAR_W, SCREEN_W, src2Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, pixVal);
 }
 
 // DRAWING ROUTINES (WITH VOLUME COLUMN)
 
-static void showNoteNum(uint32_t xPos, uint32_t yPos, int16_t note, uint32_t color)
+static void showNoteNum(uint32_t xPos, uint32_t yPos, int16_t note, uint8_t color)
 {
 	xPos += 3;
 
@@ -394,7 +379,7 @@ static void showNoteNum(uint32_t xPos, uint32_t yPos, int16_t note, uint32_t col
 	}
 }
 
-static void showInstrNum(uint32_t xPos, uint32_t yPos, uint8_t ins, uint32_t color)
+static void showInstrNum(uint32_t xPos, uint32_t yPos, uint8_t ins, uint8_t color)
 {
 	uint8_t charW, fontType;
 
@@ -435,7 +420,7 @@ static void showInstrNum(uint32_t xPos, uint32_t yPos, uint8_t ins, uint32_t col
 	}
 }
 
-static void showVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint32_t color)
+static void showVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint8_t color)
 {
 	uint8_t char1, char2, fontType, charW;
 
@@ -480,7 +465,7 @@ static void showVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint32_t color
 	pattCharOut(xPos + charW, yPos, char2, fontType, color);
 }
 
-static void showEfx(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_t efxData, uint32_t color)
+static void showEfx(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_t efxData, uint8_t color)
 {
 	uint8_t fontType, charW;
 
@@ -510,7 +495,7 @@ static void showEfx(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_t efxData,
 
 // DRAWING ROUTINES (WITHOUT VOLUME COLUMN)
 
-static void showNoteNumNoVolColumn(uint32_t xPos, uint32_t yPos, int16_t note, uint32_t color)
+static void showNoteNumNoVolColumn(uint32_t xPos, uint32_t yPos, int16_t note, uint8_t color)
 {
 	xPos += 3;
 
@@ -545,7 +530,7 @@ static void showNoteNumNoVolColumn(uint32_t xPos, uint32_t yPos, int16_t note, u
 	}
 }
 
-static void showInstrNumNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t ins, uint32_t color)
+static void showInstrNumNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t ins, uint8_t color)
 {
 	uint8_t charW, fontType;
 
@@ -592,7 +577,7 @@ static void showInstrNumNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t ins, u
 	}
 }
 
-static void showNoVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint32_t color)
+static void showNoVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint8_t color)
 {
 	(void)xPos;
 	(void)yPos;
@@ -600,7 +585,7 @@ static void showNoVolEfx(uint32_t xPos, uint32_t yPos, uint8_t vol, uint32_t col
 	(void)color;
 }
 
-static void showEfxNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_t efxData, uint32_t color)
+static void showEfxNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_t efxData, uint8_t color)
 {
 	uint8_t charW, fontType;
 
@@ -636,12 +621,12 @@ static void showEfxNoVolColumn(uint32_t xPos, uint32_t yPos, uint8_t efx, uint8_
 
 void writePattern(int32_t currRow, int32_t currPattern)
 {
-	uint32_t noteTextColors[2];
+	uint8_t noteTextColors[2];
 
-	void (*drawNote)(uint32_t, uint32_t, int16_t, uint32_t);
-	void (*drawInst)(uint32_t, uint32_t, uint8_t, uint32_t);
-	void (*drawVolEfx)(uint32_t, uint32_t, uint8_t, uint32_t);
-	void (*drawEfx)(uint32_t, uint32_t, uint8_t, uint8_t, uint32_t);
+	void (*drawNote)(uint32_t, uint32_t, int16_t, uint8_t);
+	void (*drawInst)(uint32_t, uint32_t, uint8_t, uint8_t);
+	void (*drawVolEfx)(uint32_t, uint32_t, uint8_t, uint8_t);
+	void (*drawEfx)(uint32_t, uint32_t, uint8_t, uint8_t, uint8_t);
 
 	/* Draw pattern framework every time (erasing existing content).
 	** FT2 doesn't do this. This is quite lazy and consumes more CPU
@@ -696,8 +681,8 @@ void writePattern(int32_t currRow, int32_t currPattern)
 		drawEfx = showEfxNoVolColumn;
 	}
 
-	noteTextColors[0] = video.palette[PAL_PATTEXT]; // not selected
-	noteTextColors[1] = video.palette[PAL_FORGRND]; // selected
+	noteTextColors[0] = PAL_PATTEXT; // not selected
+	noteTextColors[1] = PAL_FORGRND; // selected
 
 	// draw pattern data
 	for (int32_t i = 0; i < rowsOnScreen; i++)
@@ -710,7 +695,7 @@ void writePattern(int32_t currRow, int32_t currPattern)
 
 			const note_t *p = (pattPtr == NULL) ? emptyPattern : &pattPtr[(uint32_t)row * MAX_CHANNELS];
 			const int32_t xWidth = ui.patternChannelWidth;
-			const uint32_t color = noteTextColors[selectedRowFlag];
+			const uint8_t color = noteTextColors[selectedRowFlag];
 
 			int32_t xPos = 29;
 			for (int32_t j = 0; j < numChannels; j++, p++, xPos += xWidth)
@@ -748,132 +733,43 @@ void writePattern(int32_t currRow, int32_t currPattern)
 
 // ========== CHARACTER DRAWING ROUTINES FOR PATTERN EDITOR ==========
 
-void pattTwoHexOut(uint32_t xPos, uint32_t yPos, uint8_t val, uint32_t color)
+void pattTwoHexOut(uint32_t xPos, uint32_t yPos, uint8_t val, uint8_t color)
 {
 	const uint8_t *ch1Ptr = &font4Ptr[(val   >> 4) * FONT4_CHAR_W];
 	const uint8_t *ch2Ptr = &font4Ptr[(val & 0x0F) * FONT4_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W; x++)
-		{
-			if (ch1Ptr[x] != 0) dstPtr[x] = color;
-			if (ch2Ptr[x] != 0) dstPtr[FONT4_CHAR_W+x] = color;
-		}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-		ch1Ptr += FONT4_WIDTH;
-		ch2Ptr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	glyphBlit(dstPtr, SCREEN_W, ch1Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
+	glyphBlit(dstPtr + FONT4_CHAR_W, SCREEN_W, ch2Ptr, FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
 }
 
-static void pattCharOut(uint32_t xPos, uint32_t yPos, uint8_t chr, uint8_t fontType, uint32_t color)
+static void pattCharOut(uint32_t xPos, uint32_t yPos, uint8_t chr, uint8_t fontType, uint8_t color)
 {
-	const uint8_t *srcPtr;
-	int32_t x, y;
-
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
 	if (fontType == FONT_TYPE3)
-	{
-		srcPtr = &bmp.font3[chr * FONT3_CHAR_W];
-		for (y = 0; y < FONT3_CHAR_H; y++)
-		{
-			for (x = 0; x < FONT3_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = color;
-			}
-
-			srcPtr += FONT3_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-	}
+		glyphBlit(dstPtr, SCREEN_W, &bmp.font3[chr * FONT3_CHAR_W], FONT3_WIDTH, FONT3_CHAR_W, FONT3_CHAR_H, color);
 	else if (fontType == FONT_TYPE4)
-	{
-		srcPtr = &font4Ptr[chr * FONT4_CHAR_W];
-		for (y = 0; y < FONT4_CHAR_H; y++)
-		{
-			for (x = 0; x < FONT4_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = color;
-			}
-
-			srcPtr += FONT4_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-	}
+		glyphBlit(dstPtr, SCREEN_W, &font4Ptr[chr * FONT4_CHAR_W], FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
 	else if (fontType == FONT_TYPE5)
-	{
-		srcPtr = &font5Ptr[chr * FONT5_CHAR_W];
-		for (y = 0; y < FONT5_CHAR_H; y++)
-		{
-			for (x = 0; x < FONT5_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = color;
-			}
-
-			srcPtr += FONT5_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-	}
+		glyphBlit(dstPtr, SCREEN_W, &font5Ptr[chr * FONT5_CHAR_W], FONT5_WIDTH, FONT5_CHAR_W, FONT5_CHAR_H, color);
 	else
-	{
-		srcPtr = &bmp.font7[chr * FONT7_CHAR_W];
-		for (y = 0; y < FONT7_CHAR_H; y++)
-		{
-			for (x = 0; x < FONT7_CHAR_W; x++)
-			{
-				if (srcPtr[x] != 0)
-					dstPtr[x] = color;
-			}
-
-			srcPtr += FONT7_WIDTH;
-			dstPtr += SCREEN_W;
-		}
-	}
+		glyphBlit(dstPtr, SCREEN_W, &bmp.font7[chr * FONT7_CHAR_W], FONT7_WIDTH, FONT7_CHAR_W, FONT7_CHAR_H, color);
 }
 
-static void drawEmptyNoteSmall(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawEmptyNoteSmall(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	const uint8_t *srcPtr = &bmp.font7[18 * FONT7_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT7_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT7_CHAR_W*3; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT7_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font7[18 * FONT7_CHAR_W], FONT7_WIDTH, FONT7_CHAR_W*3, FONT7_CHAR_H, color);
 }
 
-static void drawKeyOffSmall(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawKeyOffSmall(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	const uint8_t *srcPtr = &bmp.font7[21 * FONT7_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + (xPos + 2)];
-
-	for (int32_t y = 0; y < FONT7_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT7_CHAR_W*2; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT7_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + (xPos + 2)];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font7[21 * FONT7_CHAR_W], FONT7_WIDTH, FONT7_CHAR_W*2, FONT7_CHAR_H, color);
 }
 
-static void drawNoteSmall(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color)
+static void drawNoteSmall(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color)
 {
 	uint32_t char1, char2;
 
@@ -893,64 +789,26 @@ static void drawNoteSmall(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_
 		char2 = flatNote2Char_small[note];
 	}
 
-	const uint8_t *ch1Ptr = &bmp.font7[char1];
-	const uint8_t *ch2Ptr = &bmp.font7[char2];
-	const uint8_t *ch3Ptr = &bmp.font7[char3];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t y = 0; y < FONT7_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT7_CHAR_W; x++)
-		{
-			if (ch1Ptr[x] != 0) dstPtr[x] = color;
-			if (ch2Ptr[x] != 0) dstPtr[FONT7_CHAR_W+x] = color;
-			if (ch3Ptr[x] != 0) dstPtr[((FONT7_CHAR_W*2)-2)+x] = color;
-		}
-
-		ch1Ptr += FONT7_WIDTH;
-		ch2Ptr += FONT7_WIDTH;
-		ch3Ptr += FONT7_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font7[char1], FONT7_WIDTH, FONT7_CHAR_W, FONT7_CHAR_H, color);
+	glyphBlit(dstPtr + FONT7_CHAR_W, SCREEN_W, &bmp.font7[char2], FONT7_WIDTH, FONT7_CHAR_W, FONT7_CHAR_H, color);
+	glyphBlit(dstPtr + ((FONT7_CHAR_W*2)-2), SCREEN_W, &bmp.font7[char3], FONT7_WIDTH, FONT7_CHAR_W, FONT7_CHAR_H, color);
 }
 
-static void drawEmptyNoteMedium(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawEmptyNoteMedium(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-	const uint8_t *srcPtr = &font4Ptr[43 * FONT4_CHAR_W];
-
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W*3; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &font4Ptr[43 * FONT4_CHAR_W], FONT4_WIDTH, FONT4_CHAR_W*3, FONT4_CHAR_H, color);
 }
 
-static void drawKeyOffMedium(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawKeyOffMedium(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	const uint8_t *srcPtr = &font4Ptr[40 * FONT4_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W*3; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &font4Ptr[40 * FONT4_CHAR_W], FONT4_WIDTH, FONT4_CHAR_W*3, FONT4_CHAR_H, color);
 }
 
-static void drawNoteMedium(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color)
+static void drawNoteMedium(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color)
 {
 	uint32_t char1, char2;
 
@@ -970,64 +828,26 @@ static void drawNoteMedium(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32
 		char2 = flatNote2Char_med[note];
 	}
 
-	const uint8_t *ch1Ptr = &font4Ptr[char1];
-	const uint8_t *ch2Ptr = &font4Ptr[char2];
-	const uint8_t *ch3Ptr = &font4Ptr[char3];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W; x++)
-		{
-			if (ch1Ptr[x] != 0) dstPtr[x] = color;
-			if (ch2Ptr[x] != 0) dstPtr[FONT4_CHAR_W+x] = color;
-			if (ch3Ptr[x] != 0) dstPtr[(FONT4_CHAR_W*2)+x] = color;
-		}
-
-		ch1Ptr += FONT4_WIDTH;
-		ch2Ptr += FONT4_WIDTH;
-		ch3Ptr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	glyphBlit(dstPtr, SCREEN_W, &font4Ptr[char1], FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
+	glyphBlit(dstPtr + FONT4_CHAR_W, SCREEN_W, &font4Ptr[char2], FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
+	glyphBlit(dstPtr + (FONT4_CHAR_W*2), SCREEN_W, &font4Ptr[char3], FONT4_WIDTH, FONT4_CHAR_W, FONT4_CHAR_H, color);
 }
 
-static void drawEmptyNoteBig(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawEmptyNoteBig(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	const uint8_t *srcPtr = &font4Ptr[67 * FONT4_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W*6; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &font4Ptr[67 * FONT4_CHAR_W], FONT4_WIDTH, FONT4_CHAR_W*6, FONT4_CHAR_H, color);
 }
 
-static void drawKeyOffBig(uint32_t xPos, uint32_t yPos, uint32_t color)
+static void drawKeyOffBig(uint32_t xPos, uint32_t yPos, uint8_t color)
 {
-	const uint8_t *srcPtr = &bmp.font4[61 * FONT4_CHAR_W];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
-
-	for (int32_t y = 0; y < FONT4_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT4_CHAR_W*6; x++)
-		{
-			if (srcPtr[x] != 0)
-				dstPtr[x] = color;
-		}
-
-		srcPtr += FONT4_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	glyphBlit(dstPtr, SCREEN_W, &bmp.font4[61 * FONT4_CHAR_W], FONT4_WIDTH, FONT4_CHAR_W*6, FONT4_CHAR_H, color);
 }
 
-static void drawNoteBig(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t color)
+static void drawNoteBig(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint8_t color)
 {
 	uint32_t char1, char2;
 
@@ -1047,23 +867,9 @@ static void drawNoteBig(uint32_t xPos, uint32_t yPos, int32_t noteNum, uint32_t
 		char2 = flatNote2Char_big[note];
 	}
 
-	const uint8_t *ch1Ptr = &font5Ptr[char1];
-	const uint8_t *ch2Ptr = &font5Ptr[char2];
-	const uint8_t *ch3Ptr = &font5Ptr[char3];
-	uint32_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
+	uint8_t *dstPtr = &video.frameBuffer[(yPos * SCREEN_W) + xPos];
 
-	for (int32_t y = 0; y < FONT5_CHAR_H; y++)
-	{
-		for (int32_t x = 0; x < FONT5_CHAR_W; x++)
-		{
-			if (ch1Ptr[x] != 0) dstPtr[x] = color;
-			if (ch2Ptr[x] != 0) dstPtr[FONT5_CHAR_W+x] = color;
-			if (ch3Ptr[x] != 0) dstPtr[(FONT5_CHAR_W*2)+x] = color;
-		}
-
-		ch1Ptr += FONT5_WIDTH;
-		ch2Ptr += FONT5_WIDTH;
-		ch3Ptr += FONT5_WIDTH;
-		dstPtr += SCREEN_W;
-	}
+	glyphBlit(dstPtr, SCREEN_W, &font5Ptr[char1], FONT5_WIDTH, FONT5_CHAR_W, FONT5_CHAR_H, color);
+	glyphBlit(dstPtr + FONT5_CHAR_W, SCREEN_W, &font5Ptr[char2], FONT5_WIDTH, FONT5_CHAR_W, FONT5_CHAR_H, color);
+	glyphBlit(dstPtr + (FONT5_CHAR_W*2), SCREEN_W, &font5Ptr[char3], FONT5_WIDTH, FONT5_CHAR_W, FONT5_CHAR_H, color);
 }
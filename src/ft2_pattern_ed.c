@@ -22,6 +22,7 @@
 #include "ft2_tables.h"
 #include "ft2_bmp.h"
 #include "ft2_structs.h"
+#include "ft2_undo.h"
 
 // for pattern marking w/ keyboard
 static int8_t lastChMark;
@@ -41,6 +42,7 @@ static int32_t lastMouseX, lastMouseY;
 static int32_t last_TimeH, last_TimeM, last_TimeS;
 
 static note_t tmpPattern[MAX_CHANNELS * MAX_PATT_LEN];
+static pattUsage_t pattUsage[MAX_PATTERNS];
 
 volatile pattMark_t pattMark; // globalized
 
@@ -94,6 +96,70 @@ void killPatternIfUnused(uint16_t pattNum) // for tracker use only, not in loade
 
 	if (audioWasntLocked)
 		unlockAudio();
+
+	pattUsageChanged(pattNum);
+}
+
+void pattUsageChanged(uint16_t pattNum)
+{
+	assert(pattNum < MAX_PATTERNS);
+	pattUsage[pattNum].valid = false;
+}
+
+void allPattUsageChanged(void)
+{
+	for (int32_t i = 0; i < MAX_PATTERNS; i++)
+		pattUsage[i].valid = false;
+}
+
+static void updatePattUsage(uint16_t pattNum)
+{
+	pattUsage_t *u = &pattUsage[pattNum];
+
+	memset(u, 0, sizeof (pattUsage_t));
+	u->numChannels = (uint8_t)song.numChannels;
+
+	const note_t *p = pattern[pattNum];
+	if (p != NULL)
+	{
+		const int32_t numRows = patternNumRows[pattNum];
+		for (int32_t row = 0; row < numRows; row++)
+		{
+			for (int32_t ch = 0; ch < MAX_CHANNELS; ch++, p++)
+			{
+				const int32_t numBytes = (p->note > 0) + (p->instr > 0) + (p->vol > 0) + (p->efx > 0);
+				if (numBytes == 0 && p->efxData == 0)
+				{
+					u->packedChnSize[ch]++; // packed empty note
+					continue;
+				}
+
+				u->usedChannels |= 1UL << ch;
+
+				// same packing as the XM saver (5 bytes when the first four are set, unpacked)
+				if (numBytes == 4)
+					u->packedChnSize[ch] += 5;
+				else
+					u->packedChnSize[ch] += (uint16_t)(1 + numBytes + (p->efxData > 0));
+
+				if (ch < song.numChannels && p->instr > 0 && p->instr <= MAX_INST)
+					u->usedInstr[(p->instr-1) >> 5] |= 1UL << ((p->instr-1) & 31);
+			}
+		}
+	}
+
+	u->valid = true;
+}
+
+const pattUsage_t *getPattUsage(uint16_t pattNum)
+{
+	assert(pattNum < MAX_PATTERNS);
+
+	pattUsage_t *u = &pattUsage[pattNum];
+	if (!u->valid || u->numChannels != song.numChannels)
+		updatePattUsage(pattNum);
+
+	return u;
 }
 
 uint8_t getMaxVisibleChannels(void)
@@ -1215,6 +1281,9 @@ bool loadTrack(UNICHAR *filenameU)
 		goto trackLoadError;
 	}
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, editor.editPattern);
+
 	lockMixerCallback();
 	for (int32_t i = 0; i < numRows; i++)
 	{
@@ -1236,7 +1305,9 @@ bool loadTrack(UNICHAR *filenameU)
 			p->efxData = 0;
 		}
 	}
+	pattUsageChanged(editor.editPattern);
 	unlockMixerCallback();
+	undoPattEnd(&snap);
 
 	fclose(f);
 
@@ -1328,12 +1399,17 @@ bool loadPattern(UNICHAR *filenameU)
 	if (h.numRows > MAX_PATT_LEN)
 		h.numRows = MAX_PATT_LEN;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, editor.editPattern);
+
 	lockMixerCallback();
 
 	note_t *p = pattern[editor.editPattern];
 	if (fread(p, h.numRows * TRACK_WIDTH, 1, f) != 1)
 	{
 		unlockMixerCallback();
+		undoPattEnd(&snap);
+
 		okBox(0, "System message", "General I/O error during loading! Is the file in use?", NULL);
 		goto loadPattError;
 	}
@@ -1361,6 +1437,7 @@ bool loadPattern(UNICHAR *filenameU)
 
 	// set new pattern length (FT2 doesn't do this, strange...)
 	song.currNumRows = patternNumRows[editor.editPattern] = h.numRows;
+	pattUsageChanged(editor.editPattern);
 
 	if (song.row >= song.currNumRows)
 	{
@@ -1370,6 +1447,7 @@ bool loadPattern(UNICHAR *filenameU)
 	}
 
 	unlockMixerCallback();
+	undoPattEnd(&snap);
 
 	fclose(f);
 
@@ -1934,6 +2012,9 @@ void pbPattLenUp(void)
 	if (numRows >= MAX_PATT_LEN)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, editor.editPattern);
+
 	const bool audioWasntLocked = !audio.locked;
 	if (audioWasntLocked)
 		lockAudio();
@@ -1947,6 +2028,8 @@ void pbPattLenUp(void)
 
 	if (audioWasntLocked)
 		unlockAudio();
+
+	undoPattEnd(&snap);
 }
 
 void pbPattLenDown(void)
@@ -1955,6 +2038,9 @@ void pbPattLenDown(void)
 	if (numRows <= 1)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, editor.editPattern);
+
 	const bool audioWasntLocked = !audio.locked;
 	if (audioWasntLocked)
 		lockAudio();
@@ -1968,6 +2054,8 @@ void pbPattLenDown(void)
 
 	if (audioWasntLocked)
 		unlockAudio();
+
+	undoPattEnd(&snap);
 }
 
 void drawPosEdNums(int16_t songPos)
@@ -1989,8 +2077,8 @@ void drawPosEdNums(int16_t songPos)
 		clearRect(8, 32, 39, 15);
 	}
 
-	const uint32_t color1 = video.palette[PAL_PATTEXT];
-	const uint32_t color2 = video.palette[PAL_FORGRND];
+	const uint8_t color1 = PAL_PATTEXT;
+	const uint8_t color2 = PAL_FORGRND;
 
 	// top two
 	for (int16_t y = 0; y < 2; y++)
@@ -2667,6 +2755,9 @@ void pbZap(void)
 {
 	const int16_t choice = okBox(3, "System request", "Total devastation of the...", NULL);
 
+	if (choice >= 1 && choice <= 3)
+		clearUndoJournal();
+
 	if (choice == 1) // zap all
 	{
 		zapSong();
@@ -2739,6 +2830,9 @@ void shrinkPattern(void)
 	if (okBox(2, "System request", "Shrink pattern?", NULL) != 1)
 		return;
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	lockMixerCallback();
 
 	note_t *p = pattern[curPattern];
@@ -2753,6 +2847,7 @@ void shrinkPattern(void)
 
 	patternNumRows[curPattern] /= 2;
 	numRows = patternNumRows[curPattern];
+	pattUsageChanged(curPattern);
 
 	if (song.pattNum == curPattern)
 		song.currNumRows = numRows;
@@ -2767,6 +2862,8 @@ void shrinkPattern(void)
 	ui.updatePosSections = true;
 
 	unlockMixerCallback();
+	undoPattEnd(&snap);
+
 	setSongModifiedFlag();
 }
 
@@ -2783,6 +2880,9 @@ void expandPattern(void)
 		return;
 	}
 
+	undoPattSnap_t snap;
+	undoPattBegin(&snap, curPattern);
+
 	lockMixerCallback();
 
 	note_t *p = pattern[curPattern];
@@ -2801,6 +2901,7 @@ void expandPattern(void)
 	
 	patternNumRows[curPattern] *= 2;
 	numRows = patternNumRows[curPattern];
+	pattUsageChanged(curPattern);
 
 	if (song.pattNum == curPattern)
 		song.currNumRows = numRows;
@@ -2815,5 +2916,7 @@ void expandPattern(void)
 	ui.updatePosSections = true;
 
 	unlockMixerCallback();
+	undoPattEnd(&snap);
+
 	setSongModifiedFlag();
 }
@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "ft2_unicode.h"
+#include "ft2_replayer.h"
 
 enum
 {
@@ -57,12 +58,25 @@ typedef struct pattMark_t
 	int16_t markX1, markX2, markY1, markY2;
 } pattMark_t;
 
+// per-pattern usage summary, rebuilt on demand after the pattern was edited
+typedef struct pattUsage_t
+{
+	bool valid;
+	uint8_t numChannels; // song.numChannels at the time usedInstr[] was made
+	uint32_t usedChannels; // bit N set = channel N has data
+	uint32_t usedInstr[MAX_INST / 32]; // bit N set = instrument N+1 is referenced (first 'numChannels' channels)
+	uint16_t packedChnSize[MAX_CHANNELS]; // XM-packed size of each channel (all rows)
+} pattUsage_t;
+
 extern volatile pattMark_t pattMark; // ft2_pattern_ed.c
 
 void resetPlaybackTime(void);
 
 bool allocatePattern(uint16_t pattNum);
 void killPatternIfUnused(uint16_t pattNum);
+void pattUsageChanged(uint16_t pattNum); // call after changing a pattern's data or length
+void allPattUsageChanged(void);
+const pattUsage_t *getPattUsage(uint16_t pattNum);
 uint8_t getMaxVisibleChannels(void);
 void updatePatternWidth(void);
 void updateAdvEdit(void);
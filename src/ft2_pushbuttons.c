@@ -456,7 +456,7 @@ void drawPushButton(uint16_t pushButtonID)
 		// custom button graphics
 		if ((uint8_t)b->caption[0] < 32 && b->caption[1] == '\0')
 		{
-			uint8_t *src8 = &bmp.buttonGfx[(b->caption[0]-1) * 8];
+			const uint8_t *src8 = &bmp.buttonGfx[(b->caption[0]-1) * 8];
 			const char ch = b->caption[0];
 
 			textW = 8;
@@ -480,15 +480,8 @@ void drawPushButton(uint16_t pushButtonID)
 
 			// blit graphics
 
-			uint32_t *dst32 = &video.frameBuffer[(textY * SCREEN_W) + textX];
-			for (y = 0; y < 8; y++, src8 += BUTTON_GFX_BMP_WIDTH, dst32 += SCREEN_W)
-			{
-				for (x = 0; x < textW; x++)
-				{
-					if (src8[x] != 0)
-						dst32[x] = video.palette[PAL_BTNTEXT];
-				}
-			}
+			uint8_t *dst8 = &video.frameBuffer[(textY * SCREEN_W) + textX];
+			glyphBlit(dst8, SCREEN_W, src8, BUTTON_GFX_BMP_WIDTH, textW, 8, PAL_BTNTEXT);
 		}
 		else // normal text
 		{
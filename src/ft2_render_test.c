@@ -0,0 +1,1075 @@
+// for finding memory leaks in debug mode with Visual Studio
+#if defined _DEBUG && defined _MSC_VER
+#include <crtdbg.h>
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ft2_header.h"
+#include "ft2_audio.h"
+#include "ft2_config.h"
+#include "ft2_replayer.h"
+#include "ft2_module_loader.h"
+#include "ft2_module_probe.h"
+#include "ft2_wav_renderer.h"
+#include "ft2_sysreqs.h"
+#include "ft2_tables.h"
+#include "mixer/ft2_mix.h"
+#include "mixer/ft2_cubic_spline.h"
+#include "mixer/ft2_windowed_sinc.h"
+#include "ft2_render_test.h"
+
+#define RENDER_TEST_AMP 10
+#define RENDER_TEST_MAX_SECS (30*60) // safety cap for songs that never end
+#define GOLDEN_KEY_LEN 512
+#define SNAPSHOT_TEST_TICKS 500
+#define SYNTH_CHANNELS 4
+#define SYNTH_XM_ROWS 32
+#define SYNTH_ROWS 64 // MOD/S3M
+#define SYNTH_DATA_SIZE 65536
+
+enum
+{
+	SYNTH_XM = 0,
+	SYNTH_MOD = 1,
+	SYNTH_S3M = 2,
+
+	NUM_SYNTH_MODULES
+};
+
+typedef struct synthSmp_t
+{
+	const char *name;
+	int32_t length, loopStart, loopLength;
+	uint8_t loopType;
+	bool sample16Bit;
+} synthSmp_t;
+
+typedef struct goldenEntry_t
+{
+	uint64_t hash;
+	bool used;
+	char key[GOLDEN_KEY_LEN];
+} goldenEntry_t;
+
+static const uint32_t testRates[] = { 44100, 48000, 96000 };
+static const char *interpolationNames[NUM_INTERPOLATORS] = { "none", "sinc8", "linear", "sinc16", "cubic4", "cubic6" };
+static const char *synthPaths[NUM_SYNTH_MODULES] = { "synth/test.xm", "synth/test.mod", "synth/test.s3m" };
+
+// MOD has no ping-pong loops and no 16-bit samples, S3M has no ping-pong loops (both use forward loops/8-bit instead)
+static const synthSmp_t synthSmps[3] =
+{
+	{ "saw",      2048,    0, 2048, LOOP_FWD,  false },
+	{ "triangle", 4096, 1024, 2048, LOOP_BIDI, true  },
+	{ "noise",    6000,    0,    0, LOOP_OFF,  false }
+};
+
+static uint8_t synthData[SYNTH_DATA_SIZE];
+static uint32_t synthLen;
+static note_t synthPatt[SYNTH_ROWS][SYNTH_CHANNELS];
+static FILE *synthFiles[NUM_SYNTH_MODULES];
+static int32_t numGolden;
+static goldenEntry_t *golden;
+
+static void testMsgBox(const char *text, ...)
+{
+	va_list args;
+
+	va_start(args, text);
+	fprintf(stderr, "Loader: ");
+	vfprintf(stderr, text, args);
+	fprintf(stderr, "\n");
+	va_end(args);
+}
+
+static int16_t testSysReq(int16_t type, const char *headline, const char *text, void (*checkBoxCallback)(void))
+{
+	(void)type;
+	(void)headline;
+	(void)checkBoxCallback;
+
+	fprintf(stderr, "Loader: %s\n", text);
+	return 1; // "OK"
+}
+
+// 64-bit FNV-1a over the rendered PCM data
+static void hashPCM(const void *data, uint32_t numBytes, void *userData)
+{
+	const uint8_t *ptr8 = (const uint8_t *)data;
+	uint64_t hash = *(uint64_t *)userData;
+
+	for (uint32_t i = 0; i < numBytes; i++)
+	{
+		hash ^= ptr8[i];
+		hash *= 0x100000001B3ULL;
+	}
+
+	*(uint64_t *)userData = hash;
+}
+
+static bool loadGoldenFile(const char *filename)
+{
+	char line[GOLDEN_KEY_LEN + 32];
+
+	FILE *f = fopen(filename, "r");
+	if (f == NULL)
+		return false;
+
+	int32_t listSize = 0;
+	while (fgets(line, sizeof (line), f) != NULL)
+	{
+		// "<hash> <key>"
+		char *key = strchr(line, ' ');
+		if (key == NULL)
+			continue;
+
+		*key++ = '\0';
+		key[strcspn(key, "\r\n")] = '\0';
+
+		if (numGolden >= listSize)
+		{
+			listSize = (listSize == 0) ? 256 : listSize * 2;
+
+			goldenEntry_t *newList = (goldenEntry_t *)realloc(golden, listSize * sizeof (goldenEntry_t));
+			if (newList == NULL)
+			{
+				fclose(f);
+				return false;
+			}
+
+			golden = newList;
+		}
+
+		goldenEntry_t *g = &golden[numGolden++];
+		g->hash = strtoull(line, NULL, 16);
+		strncpy(g->key, key, GOLDEN_KEY_LEN-1);
+		g->key[GOLDEN_KEY_LEN-1] = '\0';
+	}
+
+	fclose(f);
+	return true;
+}
+
+static goldenEntry_t *findGolden(const char *key)
+{
+	for (int32_t i = 0; i < numGolden; i++)
+	{
+		if (!strcmp(golden[i].key, key))
+			return &golden[i];
+	}
+
+	return NULL;
+}
+
+static void freeGolden(void)
+{
+	if (golden != NULL)
+	{
+		free(golden);
+		golden = NULL;
+	}
+
+	numGolden = 0;
+}
+
+// ----- SYNTHETIC TEST MODULES -----
+
+static void put8(uint8_t x)
+{
+	if (synthLen < SYNTH_DATA_SIZE)
+		synthData[synthLen++] = x;
+}
+
+static void put16LE(uint16_t x)
+{
+	put8(x & 0xFF);
+	put8(x >> 8);
+}
+
+static void put16BE(uint16_t x)
+{
+	put8(x >> 8);
+	put8(x & 0xFF);
+}
+
+static void put32LE(uint32_t x)
+{
+	put16LE(x & 0xFFFF);
+	put16LE(x >> 16);
+}
+
+static void putStr(const char *str, int32_t length) // zero padded
+{
+	const int32_t strLength = (int32_t)strlen(str);
+	for (int32_t i = 0; i < length; i++)
+		put8((i < strLength) ? (uint8_t)str[i] : 0);
+}
+
+static void poke16LE(uint32_t pos, uint16_t x)
+{
+	if (pos+1 < SYNTH_DATA_SIZE)
+	{
+		synthData[pos+0] = x & 0xFF;
+		synthData[pos+1] = x >> 8;
+	}
+}
+
+static void padToParagraph(void) // S3M
+{
+	while (synthLen & 15)
+		put8(0);
+}
+
+// integer math only, so that the test samples are the same everywhere
+static int16_t synthSmpPoint(int32_t smpNum, int32_t i)
+{
+	if (smpNum == 0) // saw, 64 points per cycle
+		return (int16_t)(((i & 63) << 10) - 32768);
+
+	if (smpNum == 1) // triangle, 128 points per cycle
+	{
+		const int32_t pos = i & 127;
+		return (int16_t)(((pos < 64) ? pos : (127 - pos)) * 1024 - 32256);
+	}
+
+	// noise with a linear decay
+	uint32_t x = (uint32_t)i * 2654435761UL;
+	x ^= x >> 13;
+	x *= 0x5BD1E995;
+	x ^= x >> 15;
+
+	return (int16_t)((int16_t)(x >> 16) * (int64_t)(synthSmps[2].length - i) / synthSmps[2].length);
+}
+
+static void clearSynthPatt(void)
+{
+	memset(synthPatt, 0, sizeof (synthPatt));
+}
+
+static void setSynthNote(int32_t row, int32_t ch, uint8_t note, uint8_t insNum, uint8_t vol, uint8_t efx, uint8_t efxData)
+{
+	note_t *p = &synthPatt[row][ch];
+
+	p->note = note;
+	p->instr = insNum;
+	p->vol = vol;
+	p->efx = efx;
+	p->efxData = efxData;
+}
+
+// XM effect numbers and volume column, the notes use the whole FT2 range
+static void fillSynthXMPattern(int32_t pattNum)
+{
+	static const uint8_t bassNotes[8] = { 37, 32, 37, 32, 42, 44, 37, 35 };
+
+	clearSynthPatt();
+
+	if (pattNum == 0)
+	{
+		for (int32_t row = 0; row < SYNTH_XM_ROWS; row += 4)
+		{
+			setSynthNote(row, 0, bassNotes[row >> 2], 2, 0, 0, 0);
+			setSynthNote(row, 2, ((row & 7) == 0) ? 49 : 61, 3, ((row & 7) == 0) ? 0 : 0x20, 0, 0);
+		}
+
+		setSynthNote(12, 0, 0, 0, 0, 0x04, 0x46); // vibrato
+		setSynthNote(8,  2, 49, 3, 0, 0x09, 0x08); // sample offset
+		setSynthNote(24, 2, 49, 3, 0, 0x0E, 0x93); // retrigger
+
+		setSynthNote(0,  1, 61, 1, 0, 0x00, 0x37); // arpeggio
+		setSynthNote(6,  1, 65, 0, 0, 0x03, 0x20); // tone portamento
+		setSynthNote(10, 1, 0,  0, 0, 0x03, 0x00);
+		setSynthNote(14, 1, 97, 0, 0, 0, 0); // key off
+		setSynthNote(16, 1, 56, 1, 0x40, 0, 0);
+		setSynthNote(20, 1, 0,  0, 0, 0x01, 0x08); // portamento up
+		setSynthNote(24, 1, 0,  0, 0, 0x02, 0x10); // portamento down
+		setSynthNote(28, 1, 0,  0, 0, 0x14, 0x02); // key off (Kxx)
+
+		setSynthNote(2,  3, 49, 1, 0, 0x08, 0x20); // panning
+		setSynthNote(5,  3, 0,  0, 0xD4, 0, 0); // panning slide left
+		setSynthNote(10, 3, 0,  0, 0, 0x0A, 0x04); // volume slide
+		setSynthNote(18, 3, 58, 2, 0, 0x07, 0x48); // tremolo
+		setSynthNote(26, 3, 0,  0, 0, 0x1B, 0x32); // multi retrigger
+	}
+	else
+	{
+		for (int32_t row = 0; row < SYNTH_XM_ROWS; row += 4)
+		{
+			setSynthNote(row, 0, bassNotes[7 - (row >> 2)], 2, 0, 0, 0);
+			setSynthNote(row, 2, 49 + (row >> 2), 3, 0, 0, 0);
+		}
+
+		setSynthNote(0,  0, bassNotes[7], 2, 0, 0x0F, 0x03); // speed
+		setSynthNote(16, 2, 49, 3, 0, 0x0E, 0x60); // pattern loop
+		setSynthNote(19, 2, 0,  0, 0, 0x0E, 0x62);
+
+		setSynthNote(0,  1, 0,  0, 0, 0x0F, 0x96); // BPM
+		setSynthNote(4,  1, 61, 1, 0, 0x10, 0x30); // global volume
+		setSynthNote(8,  1, 0,  0, 0, 0x11, 0x20); // global volume slide
+		setSynthNote(12, 1, 63, 1, 0, 0x1D, 0x21); // tremor
+		setSynthNote(16, 1, 65, 1, 0, 0x0E, 0x12); // fine portamento up
+		setSynthNote(20, 1, 0,  0, 0, 0x21, 0x14); // extra fine portamento up
+		setSynthNote(24, 1, 0,  0, 0, 0x19, 0x40); // panning slide
+
+		setSynthNote(0,  3, 73, 2, 0xC8, 0, 0); // set panning
+		setSynthNote(4,  3, 0,  0, 0x62, 0, 0); // volume slide down
+		setSynthNote(8,  3, 0,  0, 0xB4, 0, 0); // vibrato depth
+		setSynthNote(12, 3, 61, 0, 0xF8, 0, 0); // tone portamento
+		setSynthNote(20, 3, 0,  0, 0, 0x15, 0x10); // envelope position
+		setSynthNote(31, 3, 0,  0, 0, 0x0D, 0x00); // pattern break
+	}
+}
+
+// ProTracker effects, notes within the three Amiga octaves (37..72)
+static void fillSynthMODPattern(int32_t pattNum)
+{
+	static const uint8_t bassNotes[8] = { 37, 44, 42, 39, 37, 44, 46, 42 };
+
+	clearSynthPatt();
+
+	for (int32_t row = 0; row < SYNTH_ROWS; row += 8)
+	{
+		setSynthNote(row, 0, bassNotes[row >> 3], 2, 0, 0, 0);
+		setSynthNote(row, 2, 49, 3, 0, 0, 0);
+		setSynthNote(row+4, 2, 56, 3, 0, 0x0C, 0x20); // set volume
+	}
+
+	if (pattNum == 0)
+	{
+		setSynthNote(0,  1, 61, 1, 0, 0x00, 0x47); // arpeggio
+		setSynthNote(8,  1, 65, 1, 0, 0x03, 0x10); // tone portamento
+		setSynthNote(12, 1, 0,  0, 0, 0x05, 0x02); // tone portamento + volume slide
+		setSynthNote(16, 1, 68, 1, 0, 0x04, 0x38); // vibrato
+		setSynthNote(20, 1, 0,  0, 0, 0x06, 0x01); // vibrato + volume slide
+		setSynthNote(24, 1, 61, 1, 0, 0x01, 0x04); // portamento up
+		setSynthNote(32, 1, 65, 1, 0, 0x02, 0x04); // portamento down
+		setSynthNote(40, 1, 56, 1, 0, 0x0E, 0xC3); // note cut
+		setSynthNote(44, 1, 58, 1, 0, 0x0E, 0xD2); // note delay
+		setSynthNote(48, 1, 61, 1, 0, 0x07, 0x64); // tremolo
+
+		setSynthNote(16, 2, 49, 3, 0, 0x09, 0x10); // sample offset
+		setSynthNote(40, 2, 49, 3, 0, 0x0E, 0x92); // retrigger
+
+		setSynthNote(0,  3, 49, 2, 0, 0x08, 0xC0); // panning
+		setSynthNote(4,  3, 0,  0, 0, 0x0A, 0x02); // volume slide
+		setSynthNote(32, 3, 53, 2, 0, 0x0E, 0x13); // fine portamento up
+		setSynthNote(36, 3, 0,  0, 0, 0x0E, 0xA4); // fine volume slide up
+		setSynthNote(56, 3, 0,  0, 0, 0x0E, 0xE1); // pattern delay
+	}
+	else
+	{
+		setSynthNote(0,  1, 61, 1, 0, 0x0F, 0x04); // speed
+		setSynthNote(1,  1, 0,  0, 0, 0x0F, 0x8C); // tempo
+		setSynthNote(8,  1, 63, 1, 0, 0x0E, 0x60); // pattern loop
+		setSynthNote(12, 1, 0,  0, 0, 0x0E, 0x61);
+		setSynthNote(16, 1, 65, 1, 0, 0x0E, 0x25); // fine portamento down
+		setSynthNote(32, 1, 68, 1, 0, 0x0C, 0x30);
+
+		setSynthNote(8,  3, 61, 2, 0, 0x08, 0x40);
+		setSynthNote(24, 3, 0,  0, 0, 0x0A, 0x20);
+		setSynthNote(48, 3, 0,  0, 0, 0x0D, 0x00); // pattern break
+	}
+}
+
+/* S3M effect letters (A=1..Z=26) and note bytes (octave in the upper nibble),
+** the volume column holds the volume+1 (0 = empty).
+*/
+static void fillSynthS3MPattern(int32_t pattNum)
+{
+	static const uint8_t bassNotes[8] = { 37, 32, 35, 37, 42, 40, 37, 44 };
+
+	clearSynthPatt();
+
+	for (int32_t row = 0; row < SYNTH_ROWS; row += 8)
+	{
+		setSynthNote(row, 0, bassNotes[row >> 3], 2, 0, 0, 0);
+		setSynthNote(row, 2, 49, 3, 0, 0, 0);
+		setSynthNote(row+4, 2, 61, 3, 1+24, 0, 0);
+	}
+
+	if (pattNum == 0)
+	{
+		setSynthNote(0,  1, 61, 1, 0, 10, 0x37); // J: arpeggio
+		setSynthNote(8,  1, 65, 1, 0, 7,  0x18); // G: tone portamento
+		setSynthNote(16, 1, 68, 1, 0, 8,  0x46); // H: vibrato
+		setSynthNote(24, 1, 0,  0, 0, 6,  0x06); // F: portamento up
+		setSynthNote(32, 1, 0,  0, 0, 5,  0xF4); // E: fine portamento down
+		setSynthNote(40, 1, 56, 1, 0, 18, 0x54); // R: tremolo
+		setSynthNote(48, 1, 0,  0, 0, 4,  0x03); // D: volume slide down
+
+		setSynthNote(16, 2, 49, 3, 0, 15, 0x08); // O: sample offset
+		setSynthNote(40, 2, 49, 3, 0, 17, 0x03); // Q: retrigger
+
+		setSynthNote(0,  3, 49, 2, 1+48, 24, 0x20); // X: panning
+		setSynthNote(32, 3, 53, 2, 0,    4,  0xF2); // D: fine volume slide up
+	}
+	else
+	{
+		setSynthNote(0,  1, 61, 1, 0, 1,  0x04); // A: speed
+		setSynthNote(1,  1, 0,  0, 0, 20, 0x90); // T: tempo
+		setSynthNote(8,  1, 63, 1, 0, 22, 0x30); // V: global volume
+		setSynthNote(16, 1, 65, 1, 0, 6,  0xE8); // F: extra fine portamento up
+		setSynthNote(32, 1, 68, 1, 1+32, 0, 0);
+
+		setSynthNote(8,  3, 61, 2, 0, 24, 0x60);
+		setSynthNote(48, 3, 0,  0, 0, 3,  0x00); // C: pattern break
+	}
+}
+
+static void putXMInstr(int32_t smpNum)
+{
+	static const int16_t volEnv[4][2] = { { 0, 64 }, { 8, 40 }, { 32, 48 }, { 64, 16 } };
+	static const int16_t panEnv[4][2] = { { 0, 32 }, { 32, 0 }, { 64, 64 }, { 96, 32 } };
+
+	const synthSmp_t *ss = &synthSmps[smpNum];
+	const int32_t bytesPerPoint = ss->sample16Bit ? 2 : 1;
+
+	// the volume envelope/fadeout/auto-vibrato go to instrument 1, the panning envelope to instrument 2
+	put32LE(INSTR_HEADER_SIZE);
+	putStr(ss->name, 22);
+	put8(0);
+	put16LE(1);
+	put32LE(sizeof (xmSmpHdr_t));
+
+	for (int32_t i = 0; i < 96; i++)
+		put8(0);
+
+	for (int32_t i = 0; i < 12; i++)
+	{
+		put16LE((smpNum == 0 && i < 4) ? volEnv[i][0] : 0);
+		put16LE((smpNum == 0 && i < 4) ? volEnv[i][1] : 0);
+	}
+
+	for (int32_t i = 0; i < 12; i++)
+	{
+		put16LE((smpNum == 1 && i < 4) ? panEnv[i][0] : 0);
+		put16LE((smpNum == 1 && i < 4) ? panEnv[i][1] : 0);
+	}
+
+	put8((smpNum == 0) ? 4 : 0); // volume envelope length
+	put8((smpNum == 1) ? 4 : 0); // panning envelope length
+	put8(2); // volume envelope sustain
+	put8(0);
+	put8(0);
+	put8(0);
+	put8(0); // panning envelope loop start
+	put8(3); // panning envelope loop end
+	put8((smpNum == 0) ? (ENV_ENABLED | ENV_SUSTAIN) : 0);
+	put8((smpNum == 1) ? (ENV_ENABLED | ENV_LOOP) : 0);
+	put8(0); // auto-vibrato type
+	put8((smpNum == 0) ? 32 : 0);
+	put8((smpNum == 0) ? 6 : 0);
+	put8((smpNum == 0) ? 24 : 0);
+	put16LE((smpNum == 0) ? 0x200 : 0); // fadeout
+
+	for (int32_t i = 0; i < 22; i++) // MIDI settings and reserved bytes
+		put8(0);
+
+	put32LE(ss->length * bytesPerPoint);
+	put32LE(ss->loopStart * bytesPerPoint);
+	put32LE(ss->loopLength * bytesPerPoint);
+	put8((smpNum == 2) ? 48 : 64);
+	put8((smpNum == 1) ? 16 : 0); // finetune
+	put8(ss->loopType | (ss->sample16Bit ? SAMPLE_16BIT : 0));
+	put8((smpNum == 0) ? 96 : 128);
+	put8((smpNum == 1) ? 12 : 0); // relative note
+	put8(0);
+	putStr(ss->name, 22);
+}
+
+static void putXMSmpData(int32_t smpNum)
+{
+	const synthSmp_t *ss = &synthSmps[smpNum];
+
+	// delta encoded
+	int16_t oldPoint = 0;
+	for (int32_t i = 0; i < ss->length; i++)
+	{
+		int16_t point = synthSmpPoint(smpNum, i);
+		if (ss->sample16Bit)
+		{
+			put16LE((uint16_t)(point - oldPoint));
+		}
+		else
+		{
+			point >>= 8;
+			put8((uint8_t)(point - oldPoint));
+		}
+
+		oldPoint = point;
+	}
+}
+
+static void makeSynthXM(void)
+{
+	synthLen = 0;
+
+	putStr("Extended Module: ", 17);
+	putStr("render test", 20);
+	put8(0x1A);
+	putStr("FastTracker v2.00", 20);
+	put16LE(0x0104);
+	put32LE(276); // header size
+	put16LE(3); // song length
+	put16LE(0); // restart position
+	put16LE(SYNTH_CHANNELS);
+	put16LE(2); // patterns
+	put16LE(3); // instruments
+	put16LE(1); // linear periods
+	put16LE(6);
+	put16LE(125);
+
+	for (int32_t i = 0; i < 256; i++)
+		put8((i == 1) ? 1 : 0);
+
+	for (int32_t i = 0; i < 2; i++)
+	{
+		fillSynthXMPattern(i);
+
+		// unpacked
+		put32LE(9);
+		put8(0);
+		put16LE(SYNTH_XM_ROWS);
+		put16LE(SYNTH_XM_ROWS * SYNTH_CHANNELS * sizeof (note_t));
+
+		for (int32_t row = 0; row < SYNTH_XM_ROWS; row++)
+		{
+			for (int32_t ch = 0; ch < SYNTH_CHANNELS; ch++)
+			{
+				const note_t *p = &synthPatt[row][ch];
+
+				put8(p->note);
+				put8(p->instr);
+				put8(p->vol);
+				put8(p->efx);
+				put8(p->efxData);
+			}
+		}
+	}
+
+	for (int32_t i = 0; i < 3; i++)
+	{
+		putXMInstr(i);
+		putXMSmpData(i);
+	}
+}
+
+static void makeSynthMOD(void)
+{
+	synthLen = 0;
+
+	putStr("render test", 20);
+	for (int32_t i = 0; i < 31; i++)
+	{
+		if (i < 3)
+		{
+			const synthSmp_t *ss = &synthSmps[i];
+
+			putStr(ss->name, 22);
+			put16BE((uint16_t)(ss->length >> 1));
+			put8((i == 1) ? 3 : 0); // finetune
+			put8((i == 2) ? 48 : 64);
+			put16BE((uint16_t)(ss->loopStart >> 1));
+			put16BE((ss->loopLength > 0) ? (uint16_t)(ss->loopLength >> 1) : 1);
+		}
+		else
+		{
+			putStr("", 22);
+			put16BE(0);
+			put8(0);
+			put8(0);
+			put16BE(0);
+			put16BE(1);
+		}
+	}
+
+	put8(2); // song length
+	put8(127);
+	for (int32_t i = 0; i < 128; i++)
+		put8((i == 1) ? 1 : 0);
+
+	putStr("M.K.", 4);
+
+	for (int32_t i = 0; i < 2; i++)
+	{
+		fillSynthMODPattern(i);
+
+		for (int32_t row = 0; row < SYNTH_ROWS; row++)
+		{
+			for (int32_t ch = 0; ch < SYNTH_CHANNELS; ch++)
+			{
+				const note_t *p = &synthPatt[row][ch];
+				const uint16_t period = (p->note > 0) ? modPeriods[p->note-1] : 0;
+
+				put8((p->instr & 0xF0) | (uint8_t)(period >> 8));
+				put8(period & 0xFF);
+				put8((uint8_t)((p->instr & 0x0F) << 4) | (p->efx & 0x0F));
+				put8(p->efxData);
+			}
+		}
+	}
+
+	for (int32_t i = 0; i < 3; i++)
+	{
+		for (int32_t j = 0; j < synthSmps[i].length; j++)
+			put8((uint8_t)(synthSmpPoint(i, j) >> 8));
+	}
+}
+
+static void makeSynthS3M(void)
+{
+	uint32_t smpParaPos[3];
+
+	synthLen = 0;
+
+	putStr("render test", 28);
+	put8(0x1A);
+	put8(16); // type
+	put16LE(0);
+	put16LE(4); // orders
+	put16LE(3); // samples
+	put16LE(2); // patterns
+	put16LE(0); // flags
+	put16LE(0x1320); // made with ST3.20
+	put16LE(2); // unsigned samples
+	putStr("SCRM", 4);
+	put8(64); // global volume
+	put8(6); // speed
+	put8(125); // tempo
+	put8(0xB0); // master volume (stereo)
+
+	for (int32_t i = 0; i < 12; i++)
+		put8(0);
+
+	for (int32_t i = 0; i < 32; i++)
+		put8((i < SYNTH_CHANNELS) ? (uint8_t)(((i & 1) * 8) + (i >> 1)) : 255); // L1 R1 L2 R2
+
+	put8(0);
+	put8(1);
+	put8(255);
+	put8(255);
+
+	// the parapointers are filled in below
+	const uint32_t smpParaPtrPos = synthLen;
+	for (int32_t i = 0; i < 3; i++)
+		put16LE(0);
+
+	const uint32_t pattParaPtrPos = synthLen;
+	for (int32_t i = 0; i < 2; i++)
+		put16LE(0);
+
+	for (int32_t i = 0; i < 3; i++)
+	{
+		const synthSmp_t *ss = &synthSmps[i];
+
+		padToParagraph();
+		poke16LE(smpParaPtrPos + (i * 2), (uint16_t)(synthLen >> 4));
+
+		put8(1); // PCM sample
+		putStr("", 12);
+		smpParaPos[i] = synthLen;
+		put8(0);
+		put16LE(0);
+		put32LE(ss->length);
+		put32LE(ss->loopStart);
+		put32LE(ss->loopStart + ss->loopLength);
+		put8((i == 2) ? 48 : 64);
+		put8(0);
+		put8(0); // not packed
+		put8(((ss->loopLength > 0) ? 1 : 0) | (ss->sample16Bit ? 4 : 0));
+		put32LE((i == 1) ? 16726 : 8363); // C4 rate
+		put32LE(0);
+		put16LE(0);
+		putStr("", 6);
+		putStr(ss->name, 28);
+		putStr("SCRS", 4);
+	}
+
+	for (int32_t i = 0; i < 2; i++)
+	{
+		fillSynthS3MPattern(i);
+
+		padToParagraph();
+		poke16LE(pattParaPtrPos + (i * 2), (uint16_t)(synthLen >> 4));
+
+		const uint32_t pattStart = synthLen;
+		put16LE(0);
+
+		for (int32_t row = 0; row < SYNTH_ROWS; row++)
+		{
+			for (int32_t ch = 0; ch < SYNTH_CHANNELS; ch++)
+			{
+				const note_t *p = &synthPatt[row][ch];
+
+				uint8_t bits = (uint8_t)ch;
+				if (p->note > 0 || p->instr > 0) bits |= 32;
+				if (p->vol > 0) bits |= 64;
+				if (p->efx > 0) bits |= 128;
+
+				if (bits == ch)
+					continue;
+
+				put8(bits);
+
+				if (bits & 32)
+				{
+					if (p->note == 0)
+						put8(255);
+					else if (p->note == NOTE_OFF)
+						put8(254);
+					else
+						put8((uint8_t)((((p->note-1) / 12) << 4) | ((p->note-1) % 12)));
+
+					put8(p->instr);
+				}
+
+				if (bits & 64)
+					put8(p->vol-1);
+
+				if (bits & 128)
+				{
+					put8(p->efx);
+					put8(p->efxData);
+				}
+			}
+
+			put8(0); // end of row
+		}
+
+		poke16LE(pattStart, (uint16_t)(synthLen - pattStart));
+	}
+
+	for (int32_t i = 0; i < 3; i++)
+	{
+		const synthSmp_t *ss = &synthSmps[i];
+
+		padToParagraph();
+
+		const uint32_t para = synthLen >> 4;
+		synthData[smpParaPos[i]] = (uint8_t)(para >> 16);
+		poke16LE(smpParaPos[i] + 1, (uint16_t)(para & 0xFFFF));
+
+		for (int32_t j = 0; j < ss->length; j++)
+		{
+			const int16_t point = synthSmpPoint(i, j);
+			if (ss->sample16Bit)
+				put16LE((uint16_t)point ^ 0x8000);
+			else
+				put8((uint8_t)(point >> 8) ^ 0x80);
+		}
+	}
+}
+
+static void freeSynthModules(void)
+{
+	for (int32_t i = 0; i < NUM_SYNTH_MODULES; i++)
+	{
+		if (synthFiles[i] != NULL)
+		{
+			fclose(synthFiles[i]);
+			synthFiles[i] = NULL;
+		}
+	}
+}
+
+// the built-in test modules go to temporary files, the loaders read from a FILE
+static bool makeSynthModules(void)
+{
+	for (int32_t i = 0; i < NUM_SYNTH_MODULES; i++)
+	{
+		     if (i == SYNTH_XM)  makeSynthXM();
+		else if (i == SYNTH_MOD) makeSynthMOD();
+		else                     makeSynthS3M();
+
+		if (synthLen >= SYNTH_DATA_SIZE)
+			return false; // doesn't fit, can't happen with the modules above
+
+		synthFiles[i] = tmpfile();
+		if (synthFiles[i] == NULL || fwrite(synthData, 1, synthLen, synthFiles[i]) != synthLen)
+			return false;
+	}
+
+	return true;
+}
+
+// test module 0..NUM_SYNTH_MODULES-1 is built-in, the rest are the files from the test directory
+static bool loadTestModule(int32_t moduleNum, UNICHAR **filesU)
+{
+	if (moduleNum < NUM_SYNTH_MODULES)
+		return loadMusicHeadlessFromFile(synthFiles[moduleNum]);
+
+	return loadMusicHeadless(filesU[moduleNum-NUM_SYNTH_MODULES]);
+}
+
+static void tickReplayerTimes(int32_t numTicks)
+{
+	for (int32_t i = 0; i < numTicks; i++)
+		tickReplayer();
+}
+
+/* Checks that setReplayerSnapshot() brings back the complete replayer state:
+** playing on from a restored snapshot has to end in the same state as the
+** first run. Nothing is mixed here, so the voices stay as they were restored.
+** storeSnapshot() clears the snapshots first, so they can be memcmp()'d.
+*/
+static bool snapshotRoundTripOK(void)
+{
+	static replayerSnapshot_t startState, endState1, endState2; // big
+
+	setPos(0, 0, true);
+	playMode = PLAYMODE_SONG;
+	songPlaying = true;
+	resetChannels();
+	song.globalVolume = 64;
+
+	tickReplayerTimes(SNAPSHOT_TEST_TICKS);
+	getReplayerSnapshot(&startState);
+	tickReplayerTimes(SNAPSHOT_TEST_TICKS);
+	getReplayerSnapshot(&endState1);
+
+	setReplayerSnapshot(&startState);
+	tickReplayerTimes(SNAPSHOT_TEST_TICKS);
+	getReplayerSnapshot(&endState2);
+
+	stopPlaying();
+
+	return memcmp(&endState1, &endState2, sizeof (replayerSnapshot_t)) == 0;
+}
+
+// the path relative to the test directory with '/' delimiters, so that golden files are portable
+static const char *getRelativePath(const char *pathUTF8, const char *dirUTF8, char *out, size_t outSize)
+{
+	const size_t dirLen = strlen(dirUTF8);
+	if (!strncmp(pathUTF8, dirUTF8, dirLen))
+	{
+		pathUTF8 += dirLen;
+		while (*pathUTF8 == '/' || *pathUTF8 == '\\')
+			pathUTF8++;
+	}
+
+	strncpy(out, pathUTF8, outSize-1);
+	out[outSize-1] = '\0';
+
+	for (char *p = out; *p != '\0'; p++)
+	{
+		if (*p == '\\')
+			*p = '/';
+	}
+
+	return out;
+}
+
+int32_t renderTestFromArgs(int argc, char **argv)
+{
+	char relPath[GOLDEN_KEY_LEN-32], key[GOLDEN_KEY_LEN];
+	const char *dirUTF8 = NULL, *goldenFilename = NULL, *outFilename = NULL;
+	int32_t result = 1, numFiles = 0;
+	UNICHAR **filesU = NULL;
+	char **filesUTF8 = NULL;
+	FILE *out = NULL;
+
+	for (int32_t i = 2; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "--golden") && i+1 < argc)
+			goldenFilename = argv[++i];
+		else if (!strcmp(argv[i], "--output") && i+1 < argc)
+			outFilename = argv[++i];
+		else if (dirUTF8 == NULL && argv[i][0] != '-')
+			dirUTF8 = argv[i];
+		else
+		{
+			fprintf(stderr, "Usage: ft2-clone --render-test [<directory>] [--golden <file>] [--output <file>]\n");
+			return 1;
+		}
+	}
+
+	if (goldenFilename != NULL && !loadGoldenFile(goldenFilename))
+	{
+		fprintf(stderr, "Error: Couldn't read golden file \"%s\"!\n", goldenFilename);
+		goto renderTestEnd;
+	}
+
+	if (dirUTF8 != NULL)
+	{
+		numFiles = listModuleFiles(dirUTF8, &filesU, &filesUTF8);
+		if (numFiles < 0)
+		{
+			numFiles = 0;
+			fprintf(stderr, "Error: Out of memory!\n");
+			goto renderTestEnd;
+		}
+
+		if (numFiles == 0) // a mistyped directory would otherwise pass with the built-in modules only
+		{
+			fprintf(stderr, "Error: No modules found in \"%s\"!\n", dirUTF8);
+			goto renderTestEnd;
+		}
+	}
+
+	if (!makeSynthModules())
+	{
+		fprintf(stderr, "Error: Couldn't write the built-in test modules to a temporary file!\n");
+		goto renderTestEnd;
+	}
+
+	if (outFilename != NULL)
+	{
+		out = fopen(outFilename, "w");
+		if (out == NULL)
+		{
+			fprintf(stderr, "Error: Couldn't open \"%s\" for writing!\n", outFilename);
+			goto renderTestEnd;
+		}
+	}
+
+	// the parts of the startup that the replayer and mixer need (no window or audio device)
+	if (!setupCubicSplineTables() || !setupWindowedSincTables() || !setupAudioBuffers() || !setupReplayer())
+	{
+		fprintf(stderr, "Error: Out of memory!\n");
+		goto renderTestEnd;
+	}
+	waitForWindowedSincTables();
+
+	loaderMsgBox = testMsgBox;
+	loaderSysReq = testSysReq;
+	config.masterVol = 256;
+	config.dontShowAgainFlags |= DONT_SHOW_IMPORT_WARNING_FLAG; // no S3M import warning on every load
+
+	int32_t numCases = 0, numPassed = 0, numFailed = 0, numNew = 0, numMissing = 0;
+	double dTotalSecs = 0.0, dTotalAudioSecs = 0.0;
+
+	for (int32_t i = 0; i < NUM_SYNTH_MODULES+numFiles; i++)
+	{
+		if (i < NUM_SYNTH_MODULES)
+			strcpy(relPath, synthPaths[i]);
+		else
+			getRelativePath(filesUTF8[i-NUM_SYNTH_MODULES], dirUTF8, relPath, sizeof (relPath));
+
+		sprintf(key, "snapshot %s", relPath);
+		numCases++;
+
+		if (!loadTestModule(i, filesU))
+		{
+			printf("ERROR    (couldn't load)          %s\n", key);
+			numFailed++;
+			continue;
+		}
+
+		if (snapshotRoundTripOK())
+		{
+			printf("OK%31s%s\n", "", key);
+			numPassed++;
+		}
+		else
+		{
+			printf("MISMATCH%25s%s\n", "", key);
+			numFailed++;
+		}
+
+		for (uint32_t r = 0; r < sizeof (testRates) / sizeof (testRates[0]); r++)
+		{
+			for (int32_t interpolation = 0; interpolation < NUM_INTERPOLATORS; interpolation++)
+			{
+				for (int32_t volRamp = 1; volRamp >= 0; volRamp--)
+				{
+					sprintf(key, "%u %s %s %s", testRates[r], interpolationNames[interpolation], volRamp ? "ramp" : "noramp", relPath);
+					numCases++;
+
+					// the golden entry is used even if the case fails, so that it isn't reported as missing too
+					goldenEntry_t *g = findGolden(key);
+					if (g != NULL)
+						g->used = true;
+
+					// reload for every case, rendering leaves the song state (speed, BPM etc.) changed
+					if (!loadTestModule(i, filesU))
+					{
+						printf("ERROR    (couldn't load)          %s\n", key);
+						numFailed++;
+						continue;
+					}
+
+					config.interpolation = (uint8_t)interpolation;
+					audioSetInterpolationType(config.interpolation);
+					audioSetVolRamp(volRamp ? true : false);
+
+					uint64_t hash = 0xCBF29CE484222325ULL, numFrames;
+
+					// 16-bit output, float output differs in the last bits between compilers/CPUs
+					const uint64_t time64 = SDL_GetPerformanceCounter();
+					const bool rendered = renderSongHeadless(testRates[r], 16, RENDER_TEST_AMP, (uint64_t)testRates[r] * RENDER_TEST_MAX_SECS,
+						hashPCM, &hash, &numFrames);
+					const double dSecs = (SDL_GetPerformanceCounter() - time64) / (double)SDL_GetPerformanceFrequency();
+
+					if (!rendered)
+					{
+						printf("ERROR    (out of memory)          %s\n", key);
+						numFailed++;
+						continue;
+					}
+
+					const double dAudioSecs = numFrames / (double)testRates[r];
+					dTotalSecs += dSecs;
+					dTotalAudioSecs += dAudioSecs;
+
+					if (out != NULL)
+						fprintf(out, "%016llx %s\n", (unsigned long long)hash, key);
+
+					const char *resultStr;
+					if (g == NULL)
+					{
+						resultStr = "NEW";
+						numNew++;
+
+						if (goldenFilename != NULL) // the golden file has to cover every case
+							numFailed++;
+					}
+					else if (g->hash != hash)
+					{
+						resultStr = "MISMATCH";
+						numFailed++;
+					}
+					else
+					{
+						resultStr = "OK";
+						numPassed++;
+					}
+
+					printf("%-8s %9.2f ms %8.1fx  %s\n", resultStr, dSecs * 1000.0, (dSecs > 0.0) ? (dAudioSecs / dSecs) : 0.0, key);
+				}
+			}
+		}
+	}
+
+	// golden entries without a case (module removed/renamed, or the wrong directory was given)
+	for (int32_t i = 0; i < numGolden; i++)
+	{
+		if (!golden[i].used)
+		{
+			printf("MISSING%26s%s\n", "", golden[i].key);
+			numMissing++;
+			numFailed++;
+		}
+	}
+
+	printf("\n%d case(s): %d OK, %d failed, %d new, %d missing. %.2f s rendered in %.2f s (%.1fx realtime)\n",
+		numCases, numPassed, numFailed, numNew, numMissing, dTotalAudioSecs, dTotalSecs, (dTotalSecs > 0.0) ? (dTotalAudioSecs / dTotalSecs) : 0.0);
+
+	result = (numFailed > 0) ? 1 : 0;
+
+renderTestEnd:
+	if (out != NULL)
+		fclose(out);
+
+	freeModuleFileList(numFiles, filesU, filesUTF8);
+	freeSynthModules();
+	freeGolden();
+
+	closeReplayer();
+	freeAudioBuffers();
+
+	return result;
+}
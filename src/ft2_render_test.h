@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Golden render test: renders a few small built-in XM/MOD/S3M modules (and
+** every module in the given directory) through the WAV renderer path for every
+** interpolation mode, volume ramping setting and a few output rates, and hashes
+** the 16-bit output. The hashes are compared against a golden file (made with
+** --output from a known good build), so replayer/mixer/loader changes that alter
+** the output get caught. Every module also gets a replayer snapshot round-trip check.
+** With a golden file, cases without a golden entry and golden entries without a
+** case fail too. Build without FMA contraction (-ffp-contract=off), or the output
+** depends on the CPU. The golden file for the built-in modules is
+** test/render_test.golden.
+**
+** "--render-test [<dir>] [--golden <file>] [--output <file>]", returns program exit code
+*/
+int32_t renderTestFromArgs(int argc, char **argv);
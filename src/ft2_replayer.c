@@ -30,8 +30,17 @@
 #include "mixer/ft2_cubic_spline.h"
 #include "mixer/ft2_windowed_sinc.h"
 
+#define DRYRUN_MAX_TICKS (1UL << 26) /* safety cap for songs that never end */
+#define SEEK_SNAPSHOT_ROWS 32 /* seeking dry-runs at most this many rows */
+
 static double dLogTab[4*12*16], dExp2MulTab[32];
 static bool bxxOverflow;
+
+static voice_t dryRunVoice[MAX_CHANNELS]; // only advanced, never mixed
+static uint64_t dryRunTickSamplesFrac;
+static bool dryRunning; // setSpeed() doesn't touch the mixer while dry-running
+static seekTable_t songSeekTable; // for seekSongTime(), kept until the song changes
+static volatile bool songSeekTableValid;
 static note_t nilPatternLine[MAX_CHANNELS];
 
 typedef void (*volColumnEfxRoutine)(channel_t *ch);
@@ -131,12 +140,14 @@ void setSongModifiedFlag(void)
 {
 	song.isModified = true;
 	editor.updateWindowTitle = true;
+	songSeekTableValid = false; // the song was edited
 }
 
 void removeSongModifiedFlag(void)
 {
 	song.isModified = false;
 	editor.updateWindowTitle = true;
+	songSeekTableValid = false; // a song was loaded (or saved)
 }
 
 void setSampleC4Hz(sample_t *s, double dC4Hz)
@@ -170,6 +181,7 @@ void setPatternLen(uint16_t pattNum, int16_t numRows)
 		lockAudio();
 
 	patternNumRows[pattNum] = numRows;
+	pattUsageChanged(pattNum);
 
 	if (pattern[pattNum] != NULL)
 		killPatternIfUnused(pattNum);
@@ -526,6 +538,138 @@ static void triggerNote(uint8_t note, uint8_t efx, uint8_t efxData, channel_t *c
 	}
 }
 
+/* Song flow: position jump, pattern break/loop/delay, speed/BPM and the row/position
+** advance. These work on a song_t and are shared by the replayer and walkSongFlow(),
+** so that the calculated song duration always follows the same rules as playback.
+*/
+
+static void flowPositionJump(song_t *s, bool *bxxOverflowFlag, uint8_t param, bool songMode)
+{
+	if (songMode)
+	{
+		const int16_t pos = (int16_t)param - 1;
+		if (pos < 0 || pos >= s->songLength)
+			*bxxOverflowFlag = true; // security fix not present in FT2...
+		else
+			s->songPos = pos;
+	}
+
+	s->pBreakPos = 0;
+	s->posJumpFlag = true;
+}
+
+static void flowPatternBreak(song_t *s, uint8_t param)
+{
+	param = ((param >> 4) * 10) + (param & 0x0F);
+	if (param <= 63)
+		s->pBreakPos = param;
+	else
+		s->pBreakPos = 0;
+
+	s->posJumpFlag = true;
+}
+
+static void flowPatternLoop(song_t *s, uint8_t *loopStartRow, uint8_t *loopCounter, uint8_t param)
+{
+	if (param == 0)
+	{
+		*loopStartRow = s->row & 0xFF;
+	}
+	else if (*loopCounter == 0)
+	{
+		*loopCounter = param;
+
+		s->pBreakPos = *loopStartRow;
+		s->pBreakFlag = true;
+	}
+	else if (--(*loopCounter) > 0)
+	{
+		s->pBreakPos = *loopStartRow;
+		s->pBreakFlag = true;
+	}
+}
+
+static void flowPatternDelay(song_t *s, uint8_t param)
+{
+	if (s->pattDelTime2 == 0)
+		s->pattDelTime = param + 1;
+}
+
+static bool flowSetSpeed(song_t *s, uint8_t param) // returns true if the BPM was changed
+{
+	if (param >= 32)
+	{
+		s->BPM = param;
+		return true;
+	}
+
+	s->tick = s->speed = param;
+	return false;
+}
+
+// called on the last tick of a row, returns true if the order list wrapped (end of song)
+static bool flowNextPos(song_t *s, const int16_t *numRows, bool *bxxOverflowFlag, bool songMode)
+{
+	bool songWrapped = false;
+
+	s->row++;
+
+	if (s->pattDelTime > 0)
+	{
+		s->pattDelTime2 = s->pattDelTime;
+		s->pattDelTime = 0;
+	}
+
+	if (s->pattDelTime2 > 0)
+	{
+		s->pattDelTime2--;
+		if (s->pattDelTime2 > 0)
+			s->row--;
+	}
+
+	if (s->pBreakFlag)
+	{
+		s->pBreakFlag = false;
+		s->row = s->pBreakPos;
+	}
+
+	if (s->row >= s->currNumRows || s->posJumpFlag)
+	{
+		s->row = s->pBreakPos;
+		s->pBreakPos = 0;
+		s->posJumpFlag = false;
+
+		if (songMode)
+		{
+			if (*bxxOverflowFlag)
+			{
+				s->songPos = 0;
+				*bxxOverflowFlag = false;
+			}
+			else if (++s->songPos >= s->songLength)
+			{
+				songWrapped = true;
+				s->songPos = s->songLoopStart;
+			}
+
+			assert(s->songPos <= 255);
+			s->pattNum = s->orders[s->songPos & 0xFF];
+			s->currNumRows = numRows[s->pattNum & 0xFF];
+		}
+
+		/*
+		** Because of a bug in FT2, pattern loop commands will manipulate
+		** the row the next pattern will begin at (should be 0).
+		** However, this can overflow the number of rows (length) for that
+		** pattern and cause out-of-bounds reads. Set to row 0 in this case.
+		*/
+		if (s->row >= s->currNumRows)
+			s->row = 0;
+	}
+
+	return songWrapped;
+}
+
 static void volSlide(channel_t *ch, uint8_t param);
 static void doVibrato(channel_t *ch);
 static void portamento(channel_t *ch, uint8_t param);
@@ -579,22 +723,7 @@ static void setVibratoCtrl(channel_t *ch, uint8_t param)
 
 static void patternLoop(channel_t *ch, uint8_t param)
 {
-	if (param == 0)
-	{
-		ch->patternLoopStartRow = song.row & 0xFF;
-	}
-	else if (ch->patternLoopCounter == 0)
-	{
-		ch->patternLoopCounter = param;
-
-		song.pBreakPos = ch->patternLoopStartRow;
-		song.pBreakFlag = true;
-	}
-	else if (--ch->patternLoopCounter > 0)
-	{
-		song.pBreakPos = ch->patternLoopStartRow;
-		song.pBreakFlag = true;
-	}
+	flowPatternLoop(&song, &ch->patternLoopStartRow, &ch->patternLoopCounter, param);
 }
 
 static void setTremoloCtrl(channel_t *ch, uint8_t param)
@@ -644,8 +773,7 @@ static void noteCut0(channel_t *ch, uint8_t param)
 
 static void patternDelay(channel_t *ch, uint8_t param)
 {
-	if (song.pattDelTime2 == 0)
-		song.pattDelTime = param + 1;
+	flowPatternDelay(&song, param);
 
 	(void)ch;
 }
@@ -688,45 +816,22 @@ static void E_Effects_TickZero(channel_t *ch, uint8_t param)
 
 static void positionJump(channel_t *ch, uint8_t param)
 {
-	if (playMode != PLAYMODE_PATT && playMode != PLAYMODE_RECPATT)
-	{
-		const int16_t pos = (int16_t)param - 1;
-		if (pos < 0 || pos >= song.songLength)
-			bxxOverflow = true; // security fix not present in FT2...
-		else
-			song.songPos = pos;
-	}
-
-	song.pBreakPos = 0;
-	song.posJumpFlag = true;
+	flowPositionJump(&song, &bxxOverflow, param, playMode != PLAYMODE_PATT && playMode != PLAYMODE_RECPATT);
 
 	(void)ch;
 }
 
 static void patternBreak(channel_t *ch, uint8_t param)
 {
-	param = ((param >> 4) * 10) + (param & 0x0F);
-	if (param <= 63)
-		song.pBreakPos = param;
-	else
-		song.pBreakPos = 0;
-
-	song.posJumpFlag = true;
+	flowPatternBreak(&song, param);
 
 	(void)ch;
 }
 
 static void setSpeed(channel_t *ch, uint8_t param)
 {
-	if (param >= 32)
-	{
-		song.BPM = param;
+	if (flowSetSpeed(&song, param) && !dryRunning)
 		setMixerBPM(song.BPM);
-	}
-	else
-	{
-		song.tick = song.speed = param;
-	}
 
 	(void)ch;
 }
@@ -2179,60 +2284,8 @@ static void getNextPos(void)
 	if (song.tick != 1)
 		return;
 
-	song.row++;
-
-	if (song.pattDelTime > 0)
-	{
-		song.pattDelTime2 = song.pattDelTime;
-		song.pattDelTime = 0;
-	}
-
-	if (song.pattDelTime2 > 0)
-	{
-		song.pattDelTime2--;
-		if (song.pattDelTime2 > 0)
-			song.row--;
-	}
-
-	if (song.pBreakFlag)
-	{
-		song.pBreakFlag = false;
-		song.row = song.pBreakPos;
-	}
-
-	if (song.row >= song.currNumRows || song.posJumpFlag)
-	{
-		song.row = song.pBreakPos;
-		song.pBreakPos = 0;
-		song.posJumpFlag = false;
-
-		if (playMode != PLAYMODE_PATT && playMode != PLAYMODE_RECPATT)
-		{
-			if (bxxOverflow)
-			{
-				song.songPos = 0;
-				bxxOverflow = false;
-			}
-			else if (++song.songPos >= song.songLength)
-			{
-				editor.wavReachedEndFlag = true;
-				song.songPos = song.songLoopStart;
-			}
-
-			assert(song.songPos <= 255);
-			song.pattNum = song.orders[song.songPos & 0xFF];
-			song.currNumRows = patternNumRows[song.pattNum & 0xFF];
-		}
-
-		/*
-		** Because of a bug in FT2, pattern loop commands will manipulate
-		** the row the next pattern will begin at (should be 0).
-		** However, this can overflow the number of rows (length) for that
-		** pattern and cause out-of-bounds reads. Set to row 0 in this case.
-		*/
-		if (song.row >= song.currNumRows)
-			song.row = 0;
-	}
+	if (flowNextPos(&song, patternNumRows, &bxxOverflow, playMode != PLAYMODE_PATT && playMode != PLAYMODE_RECPATT))
+		editor.wavReachedEndFlag = true;
 }
 
 void pauseMusic(void) // stops reading pattern data
@@ -2313,6 +2366,600 @@ void tickReplayer(void) // periodically called from audio callback
 	getNextPos();
 }
 
+/* Walks through a song the same way tickReplayer() does (with the same flow functions),
+** but only handles the effects that change the song flow or timing (Bxx, Dxx, E6x, EEx, Fxx).
+** No replayer state is touched, so this can run on any thread and on a copy of a song
+** (startSong's order list, song length, BPM, speed and channel count are used).
+**
+** The song starts from position 0, and ends when the order list wraps, on F00, or when
+** a row is about to be played a second time without a pattern loop (E6x) being active
+** (Bxx loop, *songLoops is set). rowFunc (can be NULL) is called for every played row
+** with the time and state at the start of the row, and can stop the walk by returning
+** false (walkSongFlow() then returns false).
+*/
+bool walkSongFlow(const song_t *startSong, note_t *const *patterns, const int16_t *numRows,
+	songFlowRowFunc rowFunc, void *userData, double *dDuration, bool *songLoops)
+{
+	uint8_t loopStartRow[MAX_CHANNELS], loopCounter[MAX_CHANNELS], rowVisited[MAX_ORDERS][MAX_PATT_LEN/8];
+	song_t s;
+
+	memcpy(&s, startSong, sizeof (song_t));
+	memset(loopStartRow, 0, sizeof (loopStartRow));
+	memset(loopCounter, 0, sizeof (loopCounter));
+	memset(rowVisited, 0, sizeof (rowVisited));
+
+	s.pBreakFlag = s.posJumpFlag = false;
+	s.pattDelTime = s.pattDelTime2 = s.pBreakPos = 0;
+	s.songPos = s.row = 0;
+	s.tick = 1;
+	s.pattNum = s.orders[0];
+	s.currNumRows = numRows[s.pattNum];
+
+	const int32_t numChannels = CLAMP(s.numChannels, 0, MAX_CHANNELS);
+	bool bxxOverflowFlag = false, walkedToEnd = true;
+	double dTime = 0.0;
+
+	if (songLoops != NULL)
+		*songLoops = false;
+
+	for (uint32_t ticks = 0; ticks < DRYRUN_MAX_TICKS; ticks++)
+	{
+		bool tickZero = false;
+		if (--s.tick == 0)
+		{
+			s.tick = s.speed;
+			tickZero = true;
+		}
+
+		if (tickZero && s.pattDelTime2 == 0) // read new row
+		{
+			uint8_t *visited = &rowVisited[s.songPos & 0xFF][(s.row >> 3) & 31];
+			const uint8_t rowBit = 1 << (s.row & 7);
+
+			if (*visited & rowBit)
+			{
+				bool patternLoopActive = false;
+				for (int32_t i = 0; i < numChannels; i++)
+				{
+					if (loopCounter[i] > 0)
+					{
+						patternLoopActive = true;
+						break;
+					}
+				}
+
+				if (!patternLoopActive)
+				{
+					if (songLoops != NULL)
+						*songLoops = true;
+
+					break;
+				}
+			}
+			*visited |= rowBit;
+
+			if (rowFunc != NULL && !rowFunc(userData, dTime, &s))
+			{
+				walkedToEnd = false;
+				break;
+			}
+
+			const note_t *p = patterns[s.pattNum];
+			if (p != NULL)
+			{
+				p += s.row * MAX_CHANNELS;
+				for (int32_t i = 0; i < numChannels; i++, p++)
+				{
+					const uint8_t param = p->efxData;
+					switch (p->efx)
+					{
+						case 0x0B: flowPositionJump(&s, &bxxOverflowFlag, param, true); break;
+						case 0x0D: flowPatternBreak(&s, param); break;
+						case 0x0F: flowSetSpeed(&s, param); break;
+
+						case 0x0E:
+						{
+							     if ((param >> 4) == 0x6) flowPatternLoop(&s, &loopStartRow[i], &loopCounter[i], param & 0x0F);
+							else if ((param >> 4) == 0xE) flowPatternDelay(&s, param & 0x0F);
+						}
+						break;
+
+						default: break;
+					}
+				}
+			}
+		}
+
+		dTime += 2.5 / s.BPM; // tick length (BPM is always 32..255 here)
+
+		if (s.speed == 0)
+			break; // F00 stops the song
+
+		if (s.tick == 1 && flowNextPos(&s, numRows, &bxxOverflowFlag, true))
+			break; // order list wrapped
+	}
+
+	if (dDuration != NULL)
+		*dDuration = dTime;
+
+	return walkedToEnd;
+}
+
+static void setDryRunStartState(uint16_t startBPM, uint16_t startSpeed) // same start state as the WAV renderer
+{
+	playMode = PLAYMODE_SONG;
+	songPlaying = true;
+	bxxOverflow = false;
+	editor.wavReachedEndFlag = false;
+
+	song.songPos = 0;
+	song.pattNum = song.orders[0];
+	song.currNumRows = patternNumRows[song.pattNum];
+	song.row = 0;
+	song.tick = 1;
+	song.globalVolume = 64;
+	song.BPM = startBPM;
+	song.speed = startSpeed;
+
+	resetChannels();
+	resetReplayerState();
+
+	memset(dryRunVoice, 0, sizeof (dryRunVoice)); // like stopVoices()
+	for (int32_t i = 0; i < MAX_CHANNELS; i++)
+		dryRunVoice[i].panning = 128;
+
+	dryRunTickSamplesFrac = 0;
+}
+
+// same tick lengths as the audio callback (the BPM set by the tick is used for the tick)
+static uint32_t getDryRunTickSamples(void)
+{
+	const int32_t i = CLAMP(song.BPM, MIN_BPM, MAX_BPM) - MIN_BPM;
+
+	uint32_t samples = audio.samplesPerTickIntTab[i];
+
+	dryRunTickSamplesFrac += audio.samplesPerTickFracTab[i];
+	if (dryRunTickSamplesFrac >= BPM_FRAC_SCALE)
+	{
+		dryRunTickSamplesFrac &= BPM_FRAC_MASK;
+		samples++;
+	}
+
+	return samples;
+}
+
+static void dryRunTick(void)
+{
+	tickReplayer();
+
+	const uint32_t samplesToMix = getDryRunTickSamples();
+
+	channel_t *ch = channel;
+	for (int32_t i = 0; i < song.numChannels; i++, ch++)
+		dryRunVoiceTick(&dryRunVoice[i], ch, samplesToMix);
+}
+
+static uint8_t getInstrPtrNum(const instr_t *ins)
+{
+	for (int32_t i = 0; i < 128+4; i++)
+	{
+		if (instr[i] == ins)
+			return (uint8_t)i;
+	}
+
+	return 255;
+}
+
+/* Stores the replayer state. The voices are the mixer voices (audio locked),
+** or the dry-run voices at the start of a tick.
+*/
+static void storeSnapshot(replayerSnapshot_t *snapshot, bool mixerVoices)
+{
+	memset(snapshot, 0, sizeof (replayerSnapshot_t)); // no uninitialized padding, snapshots can be compared
+
+	snapshot->pBreakFlag = song.pBreakFlag;
+	snapshot->posJumpFlag = song.posJumpFlag;
+	snapshot->bxxOverflow = bxxOverflow;
+	snapshot->pattDelTime = song.pattDelTime;
+	snapshot->pattDelTime2 = song.pattDelTime2;
+	snapshot->pBreakPos = song.pBreakPos;
+	snapshot->songPos = song.songPos;
+	snapshot->pattNum = song.pattNum;
+	snapshot->row = song.row;
+	snapshot->currNumRows = song.currNumRows;
+	snapshot->BPM = song.BPM;
+	snapshot->speed = song.speed;
+	snapshot->globalVolume = song.globalVolume;
+	snapshot->tick = song.tick;
+	snapshot->playbackSeconds = song.playbackSeconds;
+	snapshot->playbackSecondsFrac = song.playbackSecondsFrac;
+
+	if (mixerVoices)
+	{
+		snapshot->tickSampleCounter = audio.tickSampleCounter;
+		snapshot->tickSampleCounterFrac = audio.tickSampleCounterFrac;
+	}
+	else
+	{
+		snapshot->tickSampleCounter = 0;
+		snapshot->tickSampleCounterFrac = dryRunTickSamplesFrac;
+	}
+
+	memcpy(snapshot->channel, channel, sizeof (channel));
+
+	channel_t *ch = snapshot->channel;
+	for (int32_t i = 0; i < MAX_CHANNELS; i++, ch++)
+	{
+		// store pointers as numbers (the smpPtr sample always belongs to the instrPtr instrument)
+		snapshot->instrPtrNum[i] = getInstrPtrNum(ch->instrPtr);
+		if (ch->smpPtr != NULL && snapshot->instrPtrNum[i] != 255)
+			snapshot->smpPtrNum[i] = (uint8_t)(ch->smpPtr - ch->instrPtr->smp);
+		else
+			snapshot->smpPtrNum[i] = 255;
+
+		ch->instrPtr = NULL;
+		ch->smpPtr = NULL;
+		ch->status = 0;
+		ch->smpStartPos = 0; // only used together with IS_Trigger
+
+		if (i >= song.numChannels)
+			continue; // voice not active
+
+		if (mixerVoices)
+			getVoiceSnapshot(i, &snapshot->voice[i]);
+		else
+			storeVoiceSnapshot(&dryRunVoice[i], &snapshot->voice[i]);
+	}
+}
+
+// sets the replayer state and the dry-run voices
+static void loadSnapshot(const replayerSnapshot_t *snapshot)
+{
+	song.pBreakFlag = snapshot->pBreakFlag;
+	song.posJumpFlag = snapshot->posJumpFlag;
+	bxxOverflow = snapshot->bxxOverflow;
+	song.pattDelTime = snapshot->pattDelTime;
+	song.pattDelTime2 = snapshot->pattDelTime2;
+	song.pBreakPos = snapshot->pBreakPos;
+	song.songPos = snapshot->songPos;
+	song.pattNum = snapshot->pattNum;
+	song.row = snapshot->row;
+	song.currNumRows = snapshot->currNumRows;
+	song.BPM = snapshot->BPM;
+	song.speed = snapshot->speed;
+	song.globalVolume = snapshot->globalVolume;
+	song.tick = snapshot->tick;
+	song.playbackSeconds = snapshot->playbackSeconds;
+	song.playbackSecondsFrac = snapshot->playbackSecondsFrac;
+
+	dryRunTickSamplesFrac = snapshot->tickSampleCounterFrac;
+
+	memcpy(channel, snapshot->channel, sizeof (channel));
+
+	channel_t *ch = channel;
+	for (int32_t i = 0; i < MAX_CHANNELS; i++, ch++)
+	{
+		const uint8_t instrNum = snapshot->instrPtrNum[i];
+		const uint8_t smpNum = snapshot->smpPtrNum[i];
+
+		ch->instrPtr = (instrNum < 128+4 && instr[instrNum] != NULL) ? instr[instrNum] : instr[0];
+		ch->smpPtr = (smpNum < MAX_SMP_PER_INST && ch->instrPtr != NULL) ? &ch->instrPtr->smp[smpNum] : NULL;
+
+		loadVoiceSnapshot(&dryRunVoice[i], ch->smpPtr, &snapshot->voice[i], ch->finalPeriod);
+	}
+}
+
+/* Makes the mixer continue from the dry-run voices, tickSampleCounter samples
+** into the current tick. The mixer callback must be locked (voices stopped).
+*/
+static void startVoicesFromDryRun(uint32_t tickSampleCounter)
+{
+	channel_t *ch = channel;
+	for (int32_t i = 0; i < song.numChannels; i++, ch++)
+	{
+		startVoiceFromDryRun(i, &dryRunVoice[i]);
+
+		// the scope restarts at the voice position
+		if (dryRunVoice[i].active)
+		{
+			const voice_t *v = &dryRunVoice[i];
+
+			ch->smpStartPos = v->position;
+			if (v->samplingBackwards) // position is mirrored in the backwards part of pingpong loops
+				ch->smpStartPos = (v->loopStart + (v->loopStart + v->loopLength) - 1) - v->position;
+
+			ch->status |= IS_ScopeTrigger;
+		}
+	}
+
+	audio.tickSampleCounter = tickSampleCounter;
+	audio.tickSampleCounterFrac = dryRunTickSamplesFrac;
+	setMixerBPM(song.BPM);
+}
+
+static bool addSeekPoint(void *userData, double dTime, const song_t *s)
+{
+	seekTable_t *table = (seekTable_t *)userData;
+
+	if (table->numPoints >= table->numPointsAllocated)
+	{
+		const int32_t newSize = (table->numPointsAllocated == 0) ? 1024 : table->numPointsAllocated * 2;
+
+		seekPoint_t *newPoints = (seekPoint_t *)realloc(table->points, newSize * sizeof (seekPoint_t));
+		if (newPoints == NULL)
+			return false;
+
+		table->points = newPoints;
+		table->numPointsAllocated = newSize;
+	}
+
+	seekPoint_t *p = &table->points[table->numPoints++];
+	p->dTime = dTime;
+	p->songPos = (uint8_t)s->songPos;
+	p->row = (uint8_t)s->row;
+	p->speed = (uint8_t)s->speed;
+	p->BPM = (uint8_t)s->BPM;
+
+	return true;
+}
+
+// stores the dry-run state as the next snapshot, a failed allocation only makes later seeks slower
+static void addSeekSnapshot(seekTable_t *table)
+{
+	if (table->numSnapshots >= table->numSnapshotsAllocated)
+	{
+		const int32_t newSize = (table->numSnapshotsAllocated == 0) ? 16 : table->numSnapshotsAllocated * 2;
+
+		replayerSnapshot_t *newSnapshots = (replayerSnapshot_t *)realloc(table->snapshots, newSize * sizeof (replayerSnapshot_t));
+		if (newSnapshots == NULL)
+			return;
+
+		table->snapshots = newSnapshots;
+		table->numSnapshotsAllocated = newSize;
+	}
+
+	storeSnapshot(&table->snapshots[table->numSnapshots++], false);
+}
+
+void freeSeekTable(seekTable_t *table)
+{
+	if (table->points != NULL)
+		free(table->points);
+
+	if (table->snapshots != NULL)
+		free(table->snapshots);
+
+	memset(table, 0, sizeof (seekTable_t));
+}
+
+/* Stores the time, position and tempo of every row that gets played, by
+** walking the song flow (walkSongFlow()) from position 0 with the current
+** BPM/speed, like when pressing "Play song". Only pattern data and the order
+** list are read (main thread owned), so the audio is never locked and the
+** replayer keeps playing. The table must be recalculated if the song is edited.
+*/
+bool calcSeekTable(seekTable_t *table)
+{
+	song_t s;
+
+	freeSeekTable(table);
+
+	memset(&s, 0, sizeof (song_t));
+	memcpy(s.orders, song.orders, sizeof (s.orders));
+	s.songLength = song.songLength;
+	s.songLoopStart = song.songLoopStart;
+	s.numChannels = song.numChannels;
+	s.BPM = song.BPM;
+	s.speed = (song.speed == 0) ? song.initialSpeed : song.speed;
+
+	table->startBPM = s.BPM;
+	table->startSpeed = s.speed;
+
+	if (!walkSongFlow(&s, pattern, patternNumRows, addSeekPoint, table, &table->dDuration, &table->songLoops))
+	{
+		freeSeekTable(table);
+		return false;
+	}
+
+	return true;
+}
+
+int32_t getSeekPointFromTime(const seekTable_t *table, double dSeconds)
+{
+	if (table->numPoints <= 0)
+		return -1;
+
+	// binary search for the last row starting at or before dSeconds
+	int32_t lo = 0, hi = table->numPoints - 1;
+	while (lo < hi)
+	{
+		const int32_t mid = (lo + hi + 1) >> 1;
+		if (table->points[mid].dTime <= dSeconds)
+			lo = mid;
+		else
+			hi = mid - 1;
+	}
+
+	return lo;
+}
+
+void getReplayerSnapshot(replayerSnapshot_t *snapshot)
+{
+	const bool audioWasntLocked = !audio.locked;
+	if (audioWasntLocked)
+		lockAudio();
+
+	storeSnapshot(snapshot, true);
+
+	if (audioWasntLocked)
+		unlockAudio();
+}
+
+void setReplayerSnapshot(const replayerSnapshot_t *snapshot)
+{
+	lockMixerCallback();
+
+	loadSnapshot(snapshot);
+	startVoicesFromDryRun(snapshot->tickSampleCounter);
+
+	/* Don't use unlockMixerCallback() here, it would clear the channels again.
+	** No sample pointers were freed, so the voices are safe to play.
+	*/
+	unlockAudio();
+}
+
+static void setPlaybackTime(double dSeconds)
+{
+	double dSecsInt;
+	const double dSecsFrac = modf(dSeconds, &dSecsInt);
+
+	song.playbackSeconds = (uint32_t)dSecsInt;
+	song.playbackSecondsFrac = (uint64_t)(dSecsFrac * (1ULL << 52));
+}
+
+/* Moves the replayer to the row playing at dSeconds. If the song is playing,
+** the complete replayer state (effects, envelopes, tempo, voice sampling
+** positions) is reproduced by dry-running the replayer from the nearest
+** earlier snapshot in the table (or the song start) up to that row. The
+** dry-run stores a snapshot every SEEK_SNAPSHOT_ROWS rows that the table
+** doesn't have yet, so later seeks only dry-run a few rows. The music is only
+** paused during the dry-run (the mixer keeps running), the audio is locked
+** just for restarting the voices.
+*/
+bool setPosFromTime(seekTable_t *table, double dSeconds)
+{
+	const int32_t pointNum = getSeekPointFromTime(table, dSeconds);
+	if (pointNum < 0)
+		return false;
+
+	const seekPoint_t *p = &table->points[pointNum];
+
+	if (songPlaying && (playMode == PLAYMODE_SONG || playMode == PLAYMODE_RECSONG))
+	{
+		pauseMusic();
+
+		const int8_t oldPlayMode = playMode;
+		const bool oldWavReachedEndFlag = editor.wavReachedEndFlag;
+
+		if (table->snapshotsAudioFreq != audio.freq)
+		{
+			table->numSnapshots = 0;
+			table->snapshotsAudioFreq = audio.freq;
+		}
+
+		dryRunning = true;
+
+		int32_t snapshotNum = pointNum / SEEK_SNAPSHOT_ROWS;
+		if (snapshotNum >= table->numSnapshots)
+			snapshotNum = table->numSnapshots - 1;
+
+		int32_t rowNum = 0;
+		if (snapshotNum >= 0)
+		{
+			playMode = PLAYMODE_SONG;
+			songPlaying = true;
+			editor.wavReachedEndFlag = false;
+
+			loadSnapshot(&table->snapshots[snapshotNum]);
+			rowNum = snapshotNum * SEEK_SNAPSHOT_ROWS;
+		}
+		else
+		{
+			setDryRunStartState(table->startBPM, table->startSpeed);
+		}
+
+		for (uint32_t i = 0; i < DRYRUN_MAX_TICKS; i++)
+		{
+			if (song.tick == 1 && song.pattDelTime2 == 0) // the next tick reads a new row
+			{
+				if (rowNum == table->numSnapshots * SEEK_SNAPSHOT_ROWS)
+					addSeekSnapshot(table);
+
+				if (rowNum++ == pointNum)
+					break;
+			}
+
+			dryRunTick();
+		}
+		dryRunning = false;
+
+		playMode = oldPlayMode;
+		editor.wavReachedEndFlag = oldWavReachedEndFlag;
+
+		static replayerSnapshot_t seekState; // big
+		storeSnapshot(&seekState, false);
+
+		lockMixerCallback(); // this clears the channels too
+		loadSnapshot(&seekState);
+		startVoicesFromDryRun(0);
+		setPlaybackTime(p->dTime);
+		resumeMusic();
+
+		// see setReplayerSnapshot()
+		unlockAudio();
+		return true;
+	}
+
+	const bool audioWasntLocked = !audio.locked;
+	if (audioWasntLocked)
+		lockAudio();
+
+	resetReplayerState();
+	setPos(p->songPos, p->row, true);
+
+	song.speed = p->speed;
+	song.BPM = p->BPM;
+	setMixerBPM(song.BPM);
+	setPlaybackTime(p->dTime);
+
+	editor.BPM = song.BPM;
+	editor.speed = song.speed;
+	ui.drawBPMFlag = true;
+	ui.drawSpeedFlag = true;
+
+	if (audioWasntLocked)
+		unlockAudio();
+
+	return true;
+}
+
+// moves song playback deltaSeconds forwards/backwards (Ctrl+Shift+Left/Right)
+void seekSongTime(int32_t deltaSeconds)
+{
+	if (!songSeekTableValid)
+	{
+		if (!calcSeekTable(&songSeekTable))
+		{
+			okBox(0, "System message", "Not enough memory!", NULL);
+			return;
+		}
+
+		songSeekTableValid = true;
+	}
+
+	const seekTable_t *table = &songSeekTable;
+
+	// current time is the first visit of the current row (the playback timer is off after Bxx/pattern loops)
+	double dTime = -1.0;
+	for (int32_t i = 0; i < table->numPoints; i++)
+	{
+		if (table->points[i].songPos == editor.songPos && table->points[i].row == editor.row)
+		{
+			dTime = table->points[i].dTime;
+			break;
+		}
+	}
+
+	if (dTime < 0.0)
+		return;
+
+	dTime += deltaSeconds;
+	if (dTime < 0.0)
+		dTime = 0.0;
+
+	setPosFromTime(&songSeekTable, dTime);
+}
+
 void resetMusic(void)
 {
 	const bool audioWasntLocked = !audio.locked;
@@ -2587,6 +3234,7 @@ void freeAllPatterns(void)
 			pattern[i] = NULL;
 		}
 	}
+	allPattUsageChanged();
 	resumeAudio();
 }
 
@@ -2768,6 +3416,7 @@ void closeReplayer(void)
 {
 	freeAllInstr();
 	freeAllPatterns();
+	freeSeekTable(&songSeekTable);
 
 	// free reserved instruments
 
@@ -14,6 +14,7 @@ enum
 	IS_Trigger = 4, // trigger sample
 	IS_Pan = 8, // set panning
 	IS_QuickVol = 16, // 5ms volramp instead of tick ms
+	IS_ScopeTrigger = 32, // trigger scope only (voice was restored from a replayer snapshot)
 
 	LOOP_DISABLED = 0,
 	LOOP_FORWARD = 1,
@@ -214,6 +215,7 @@ typedef struct sample_t
 	int8_t finetune, relativeNote, *dataPtr, *origDataPtr;
 	uint8_t volume, flags, panning;
 	int32_t length, loopStart, loopLength;
+	uint32_t dataGen; // new for every (re)allocation of the data, for the undo journal
 
 	// fix for resampling interpolation taps
 	int8_t leftEdgeTapSamples8[MAX_TAPS*2];
@@ -277,6 +279,51 @@ typedef struct song_t
 	uint64_t playbackSecondsFrac;
 } song_t;
 
+// called by walkSongFlow() for every played row, return false to stop the walk
+typedef bool (*songFlowRowFunc)(void *userData, double dTime, const song_t *s);
+
+typedef struct seekPoint_t // one per played row
+{
+	double dTime; // seconds from song start
+	uint8_t songPos, row, speed, BPM;
+} seekPoint_t;
+
+typedef struct snapshotVoice_t // mixer state of a channel's voice
+{
+	bool active, samplingBackwards, hasLooped;
+	uint8_t panning;
+	int32_t position;
+	float fVolume; // can differ from the channel's fFinalVol
+	uint64_t positionFrac;
+} snapshotVoice_t;
+
+typedef struct replayerSnapshot_t // complete replayer state, has no pointers
+{
+	bool pBreakFlag, posJumpFlag, bxxOverflow;
+	uint8_t pattDelTime, pattDelTime2, pBreakPos;
+	uint8_t instrPtrNum[MAX_CHANNELS], smpPtrNum[MAX_CHANNELS]; // channel_t pointers as numbers (255 = NULL)
+	int16_t songPos, pattNum, row, currNumRows;
+	uint16_t BPM, speed, globalVolume, tick;
+	uint32_t playbackSeconds, tickSampleCounter; // tickSampleCounter = samples left of the current tick
+	uint64_t playbackSecondsFrac, tickSampleCounterFrac;
+	snapshotVoice_t voice[MAX_CHANNELS];
+	channel_t channel[MAX_CHANNELS]; // smpPtr/instrPtr are NULL in here
+} replayerSnapshot_t;
+
+typedef struct seekTable_t
+{
+	bool songLoops; // song ends by jumping back (Bxx) instead of ending
+	uint16_t startBPM, startSpeed; // tempo the song was walked with
+	int32_t numPoints, numPointsAllocated;
+	seekPoint_t *points;
+	double dDuration; // seconds
+
+	// snapshot n is the state at the start of point n*SEEK_SNAPSHOT_ROWS, recorded by setPosFromTime()
+	int32_t numSnapshots, numSnapshotsAllocated;
+	replayerSnapshot_t *snapshots;
+	uint32_t snapshotsAudioFreq; // the voice positions depend on the output rate
+} seekTable_t;
+
 double getSampleC4Rate(sample_t *s);
 
 void setNewSongPos(int32_t pos);
@@ -324,6 +371,15 @@ void samp2Delta(int8_t *p, int32_t length, uint8_t smpFlags);
 void setPatternLen(uint16_t pattNum, int16_t numRows);
 void setLinearPeriods(bool linearPeriodsFlag);
 void tickReplayer(void); // periodically called from audio callback
+bool walkSongFlow(const song_t *startSong, note_t *const *patterns, const int16_t *numRows,
+	songFlowRowFunc rowFunc, void *userData, double *dDuration, bool *songLoops); // thread-safe, touches no replayer state
+bool calcSeekTable(seekTable_t *table); // walks the song flow from the start, main thread only
+void freeSeekTable(seekTable_t *table);
+int32_t getSeekPointFromTime(const seekTable_t *table, double dSeconds); // -1 if table is empty
+bool setPosFromTime(seekTable_t *table, double dSeconds); // adds snapshots to the table
+void getReplayerSnapshot(replayerSnapshot_t *snapshot);
+void setReplayerSnapshot(const replayerSnapshot_t *snapshot);
+void seekSongTime(int32_t deltaSeconds);
 void resetChannels(void);
 bool patternEmpty(uint16_t pattNum);
 int16_t getUsedSamples(int16_t smpNum);
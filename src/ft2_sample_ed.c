@@ -28,8 +28,12 @@
 #include "ft2_keyboard.h"
 #include "ft2_structs.h"
 #include "ft2_replayer.h"
+#include "ft2_smp_kernels.h"
+#include "ft2_undo.h"
 #include "mixer/ft2_windowed_sinc.h" // SINC_TAPS, SINC_NEGATIVE_TAPS
 
+#define MAX_RETIRED_SMP_DATA 256
+
 static const char sharpNote1Char[12] = { 'C', 'C', 'D', 'D', 'E', 'F', 'F', 'G', 'G', 'A', 'A', 'B' };
 static const char sharpNote2Char[12] = { '-', '#', '-', '#', '-', '-', '#', '-', '#', '-', '#', '-' };
 static const char flatNote1Char[12]  = { 'C', 'D', 'D', 'E', 'E', 'F', 'G', 'G', 'A', 'A', 'B', 'B' };
@@ -44,11 +48,21 @@ static int32_t old_Rx1, old_Rx2, old_ViewSize, old_SmpScrPos;
 static int32_t lastMouseX, lastMouseY, lastDrawX, lastDrawY, mouseXOffs, curSmpLoopStart, curSmpLoopLength;
 static double dScrPosScaled, dPos2ScrMul, dScr2SmpPosMul;
 static sample_t smpCopySample;
+static smpPtr_t retiredSmpData[MAX_RETIRED_SMP_DATA];
+static int32_t numRetiredSmpData;
+static SDL_mutex *retiredSmpDataMutex;
+static SDL_atomic_t smpDataGenCounter;
 static SDL_Thread *thread;
 
 // globals
 int32_t smpEd_Rx1 = 0, smpEd_Rx2 = 0;
 
+// gives the sample a new data generation (unique, unlike the data pointer that the allocator may hand out again)
+static void newSmpDataGen(sample_t *s)
+{
+	s->dataGen = (uint32_t)SDL_AtomicAdd(&smpDataGenCounter, 1) + 1;
+}
+
 // allocs sample with proper alignment and padding for branchless resampling interpolation
 bool allocateSmpData(sample_t *s, int32_t length, bool sample16Bit)
 {
@@ -63,6 +77,8 @@ bool allocateSmpData(sample_t *s, int32_t length, bool sample16Bit)
 	}
 
 	s->dataPtr = s->origDataPtr + SMP_DAT_OFFSET;
+	newSmpDataGen(s);
+
 	return true;
 }
 
@@ -96,6 +112,7 @@ bool reallocateSmpData(sample_t *s, int32_t length, bool sample16Bit)
 
 	s->origDataPtr = newPtr;
 	s->dataPtr = s->origDataPtr + SMP_DAT_OFFSET;
+	newSmpDataGen(s);
 
 	return true;
 }
@@ -123,6 +140,7 @@ void setSmpDataPtr(sample_t *s, smpPtr_t *sp)
 {
 	s->origDataPtr = sp->origPtr;
 	s->dataPtr = sp->ptr;
+	newSmpDataGen(s);
 }
 
 void freeSmpDataPtr(smpPtr_t *sp)
@@ -146,6 +164,7 @@ void freeSmpData(sample_t *s)
 
 	s->dataPtr = NULL;
 	s->isFixed = false;
+	newSmpDataGen(s);
 }
 
 bool cloneSample(sample_t *src, sample_t *dst)
@@ -186,6 +205,180 @@ bool cloneSample(sample_t *src, sample_t *dst)
 	return true;
 }
 
+// copies 'length' sample points from 'pos' on, with the points that fixSample() replaced restored
+static void copyUnfixedSmpData(int8_t *dst, const sample_t *s, int32_t pos, int32_t length)
+{
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+
+	memcpy(dst, &s->dataPtr[pos << sample16Bit], length << sample16Bit);
+	if (!s->isFixed)
+		return;
+
+	for (int32_t i = 0; i < MAX_RIGHT_TAPS; i++)
+	{
+		const int32_t fixedPos = s->fixedPos + i;
+		if (fixedPos < pos || fixedPos >= pos+length)
+			continue;
+
+		if (sample16Bit)
+			((int16_t *)dst)[fixedPos-pos] = s->fixedSmp[i];
+		else
+			dst[fixedPos-pos] = (int8_t)s->fixedSmp[i];
+	}
+}
+
+bool beginSmpEdit(const sample_t *s, sample_t *editSmp)
+{
+	*editSmp = *s;
+	editSmp->origDataPtr = editSmp->dataPtr = NULL;
+	editSmp->isFixed = false;
+	editSmp->fixedPos = 0;
+
+	if (s->dataPtr == NULL || s->length <= 0)
+		return true;
+
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+	if (!allocateSmpData(editSmp, s->length, sample16Bit))
+		return false;
+
+	copyUnfixedSmpData(editSmp->dataPtr, s, 0, s->length); // only the copy gets the interpolation taps removed
+	return true;
+}
+
+bool initSmpEdit(void)
+{
+	retiredSmpDataMutex = SDL_CreateMutex();
+	return (retiredSmpDataMutex != NULL);
+}
+
+void freeSmpEdit(void) // the voices and scopes must be stopped
+{
+	for (int32_t i = 0; i < numRetiredSmpData; i++)
+		free(retiredSmpData[i].origPtr);
+	numRetiredSmpData = 0;
+
+	if (retiredSmpDataMutex != NULL)
+	{
+		SDL_DestroyMutex(retiredSmpDataMutex);
+		retiredSmpDataMutex = NULL;
+	}
+}
+
+// called from the sample edit threads and the main thread
+static void retireSmpData(const smpPtr_t *sp)
+{
+	if (sp->origPtr == NULL)
+		return;
+
+	SDL_LockMutex(retiredSmpDataMutex);
+
+	if (numRetiredSmpData == MAX_RETIRED_SMP_DATA)
+	{
+		// should never happen, but free the old data the hard way instead of leaking it
+		stopVoices(); // also waits for the scopes
+
+		for (int32_t i = 0; i < numRetiredSmpData; i++)
+			free(retiredSmpData[i].origPtr);
+
+		numRetiredSmpData = 0;
+	}
+
+	retiredSmpData[numRetiredSmpData++] = *sp;
+
+	SDL_UnlockMutex(retiredSmpDataMutex);
+}
+
+// copies the header fields in 'hdrFields' (SMP_HDR_*)
+static void copySmpHdrFields(sample_t *dst, const sample_t *src, uint8_t hdrFields)
+{
+	if (hdrFields & SMP_HDR_NAME)     memcpy(dst->name, src->name, sizeof (dst->name));
+	if (hdrFields & SMP_HDR_VOLUME)   dst->volume = src->volume;
+	if (hdrFields & SMP_HDR_PANNING)  dst->panning = src->panning;
+	if (hdrFields & SMP_HDR_FINETUNE) dst->finetune = src->finetune;
+	if (hdrFields & SMP_HDR_RELNOTE)  dst->relativeNote = src->relativeNote;
+}
+
+static void swapInSmpEdit(sample_t *s, sample_t *editSmp, uint8_t hdrFields)
+{
+	smpPtr_t oldData;
+
+	undoRecordSmpEdit(s, editSmp, hdrFields);
+	fixSample(editSmp);
+
+	const bool audioWasntLocked = !audio.locked;
+	if (audioWasntLocked)
+		lockAudio();
+
+	oldData.origPtr = s->origDataPtr;
+	oldData.ptr = s->dataPtr;
+
+	// only the fields that the edit owns, the rest of the header may have been changed by the user meanwhile
+	s->dataPtr = editSmp->dataPtr;
+	s->origDataPtr = editSmp->origDataPtr;
+	s->dataGen = editSmp->dataGen;
+	s->length = editSmp->length;
+	s->loopStart = editSmp->loopStart;
+	s->loopLength = editSmp->loopLength;
+	s->flags = editSmp->flags;
+	s->isFixed = editSmp->isFixed;
+	s->fixedPos = editSmp->fixedPos;
+	memcpy(s->fixedSmp, editSmp->fixedSmp, sizeof (s->fixedSmp));
+	memcpy(s->leftEdgeTapSamples8, editSmp->leftEdgeTapSamples8, sizeof (s->leftEdgeTapSamples8));
+	memcpy(s->leftEdgeTapSamples16, editSmp->leftEdgeTapSamples16, sizeof (s->leftEdgeTapSamples16));
+	copySmpHdrFields(s, editSmp, hdrFields);
+
+	if (audioWasntLocked)
+		unlockAudio();
+
+	retireSmpData(&oldData);
+
+	// the sample data is owned by 's' now
+	editSmp->origDataPtr = editSmp->dataPtr = NULL;
+	editSmp->isFixed = false;
+}
+
+void commitSmpEdit(sample_t *s, sample_t *editSmp)
+{
+	swapInSmpEdit(s, editSmp, 0);
+}
+
+void commitSmpEditHdr(sample_t *s, sample_t *editSmp, uint8_t hdrFields)
+{
+	swapInSmpEdit(s, editSmp, hdrFields);
+}
+
+void cancelSmpEdit(sample_t *editSmp)
+{
+	freeSmpData(editSmp);
+}
+
+void freeRetiredSmpData(void)
+{
+	// don't stall the GUI if an edit thread is retiring data right now, try again next frame
+	if (numRetiredSmpData == 0 || SDL_TryLockMutex(retiredSmpDataMutex) != 0)
+		return;
+
+	const bool audioWasntLocked = !audio.locked;
+	if (audioWasntLocked)
+		lockAudio();
+
+	int32_t numStillUsed = 0;
+	for (int32_t i = 0; i < numRetiredSmpData; i++)
+	{
+		smpPtr_t *sp = &retiredSmpData[i];
+		if (voicesUseSmpData(sp->ptr) || scopesUseSmpData(sp->ptr))
+			retiredSmpData[numStillUsed++] = *sp;
+		else
+			free(sp->origPtr);
+	}
+	numRetiredSmpData = numStillUsed;
+
+	if (audioWasntLocked)
+		unlockAudio();
+
+	SDL_UnlockMutex(retiredSmpDataMutex);
+}
+
 sample_t *getCurSample(void)
 {
 	if (editor.curInstr == 0 || instr[editor.curInstr] == NULL)
@@ -703,7 +896,7 @@ static bool getCopyBuffer(int32_t size, bool sample16Bit)
 
 static int32_t SDLCALL copySampleThread(void *ptr)
 {
-	pauseAudio();
+	sample_t editSmp;
 
 	sample_t *src;
 	if (instr[editor.srcInstr] == NULL)
@@ -711,14 +904,18 @@ static int32_t SDLCALL copySampleThread(void *ptr)
 	else
 		src = &instr[editor.srcInstr]->smp[editor.srcSmp];
 
-	if (instr[editor.curInstr] == NULL && !allocateInstr(editor.curInstr))
+	if (src == NULL)
+		memset(&editSmp, 0, sizeof (sample_t));
+	else if (!beginSmpEdit(src, &editSmp))
 		goto error;
 
-	sample_t *dst = &instr[editor.curInstr]->smp[editor.curSmp];
-	if (!cloneSample(src, dst))
+	if (instr[editor.curInstr] == NULL && !allocateInstr(editor.curInstr))
+	{
+		cancelSmpEdit(&editSmp);
 		goto error;
+	}
 
-	resumeAudio();
+	commitSmpEdit(&instr[editor.curInstr]->smp[editor.curSmp], &editSmp);
 
 	editor.updateCurSmp = true;
 	setSongModifiedFlag();
@@ -727,7 +924,6 @@ static int32_t SDLCALL copySampleThread(void *ptr)
 	return true;
 
 error:
-	resumeAudio();
 	okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 	return true;
 
@@ -794,13 +990,13 @@ static void writeRange(void)
 	int32_t rangeLen = (end + 1) - start;
 	assert(start+rangeLen <= SCREEN_W);
 
-	uint32_t *ptr32 = &video.frameBuffer[(174 * SCREEN_W) + start];
+	uint8_t *ptr8 = &video.frameBuffer[(174 * SCREEN_W) + start];
 	for (int32_t y = 0; y < SAMPLE_AREA_HEIGHT; y++)
 	{
 		for (int32_t x = 0; x < rangeLen; x++)
-			ptr32[x] = video.palette[(ptr32[x] >> 24) ^ 2]; // ">> 24" to get palette, XOR 2 to switch between mark/normal palette
+			ptr8[x] ^= 2; // XOR 2 to switch between mark/normal palette
 
-		ptr32 += SCREEN_W;
+		ptr8 += SCREEN_W;
 	}
 }
 
@@ -849,11 +1045,11 @@ void sampleLine(int32_t x1, int32_t x2, int32_t y1, int32_t y2)
 	const int32_t sy = SGN(dy);
 	int32_t x  = x1;
 	int32_t y  = y1;
-	const uint32_t pal1 = video.palette[PAL_DESKTOP];
-	const uint32_t pal2 = video.palette[PAL_FORGRND];
-	const uint32_t pixVal = video.palette[PAL_PATTEXT];
+	const uint8_t pal1 = PAL_DESKTOP;
+	const uint8_t pal2 = PAL_FORGRND;
+	const uint8_t pixVal = PAL_PATTEXT;
 	const int32_t pitch = sy * SCREEN_W;
-	uint32_t *dst32 = &video.frameBuffer[(y * SCREEN_W) + x];
+	uint8_t *dst8 = &video.frameBuffer[(y * SCREEN_W) + x];
 
 	// draw line
 	if (ax > ay)
@@ -863,12 +1059,12 @@ void sampleLine(int32_t x1, int32_t x2, int32_t y1, int32_t y2)
 		while (true)
 		{
 			// invert certain colors
-			if (*dst32 != pal2)
+			if (*dst8 != pal2)
 			{
-				if (*dst32 == pal1)
-					*dst32 = pal2;
+				if (*dst8 == pal1)
+					*dst8 = pal2;
 				else
-					*dst32 = pixVal;
+					*dst8 = pixVal;
 			}
 
 			if (x == x2)
@@ -877,12 +1073,12 @@ void sampleLine(int32_t x1, int32_t x2, int32_t y1, int32_t y2)
 			if (d >= 0)
 			{
 				d -= ax;
-				dst32 += pitch;
+				dst8 += pitch;
 			}
 
 			x += sx;
 			d += ay;
-			dst32 += sx;
+			dst8 += sx;
 		}
 	}
 	else
@@ -892,12 +1088,12 @@ void sampleLine(int32_t x1, int32_t x2, int32_t y1, int32_t y2)
 		while (true)
 		{
 			// invert certain colors
-			if (*dst32 != pal2)
+			if (*dst8 != pal2)
 			{
-				if (*dst32 == pal1)
-					*dst32 = pal2;
+				if (*dst8 == pal1)
+					*dst8 = pal2;
 				else
-					*dst32 = pixVal;
+					*dst8 = pixVal;
 			}
 
 			if (y == y2)
@@ -906,12 +1102,12 @@ void sampleLine(int32_t x1, int32_t x2, int32_t y1, int32_t y2)
 			if (d >= 0)
 			{
 				d -= ay;
-				dst32 += sx;
+				dst8 += sx;
 			}
 
 			y += sy;
 			d += ax;
-			dst32 += pitch;
+			dst8 += pitch;
 		}
 	}
 }
@@ -1242,7 +1438,7 @@ static void getSampleDataPeak(sample_t *s, int32_t index, int32_t length, int16_
 static void writeWaveform(void)
 {
 	// clear sample data area
-	memset(&video.frameBuffer[174 * SCREEN_W], 0, SAMPLE_AREA_WIDTH * SAMPLE_AREA_HEIGHT * sizeof (int32_t));
+	memset(&video.frameBuffer[174 * SCREEN_W], PAL_BCKGRND, SAMPLE_AREA_WIDTH * SAMPLE_AREA_HEIGHT);
 
 	// draw center line
 	hLine(0, SAMPLE_AREA_Y_CENTER, SAMPLE_AREA_WIDTH, PAL_DESKTOP);
@@ -1875,12 +2071,9 @@ void saveRange(void)
 	free(filenameU);
 }
 
-static bool cutRange(bool cropMode, int32_t r1, int32_t r2)
+// 's' is a working copy (see beginSmpEdit())
+static bool cutRange(sample_t *s, bool cropMode, int32_t r1, int32_t r2)
 {
-	sample_t *s = getCurSample();
-	if (s == NULL)
-		return false;
-
 	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
 	if (!cropMode)
@@ -1888,16 +2081,10 @@ static bool cutRange(bool cropMode, int32_t r1, int32_t r2)
 		if (editor.curInstr == 0 || s->dataPtr == NULL || s->length == 0)
 			return false;
 
-		pauseAudio();
-		unfixSample(s);
-
 		if (config.smpCutToBuffer)
 		{
 			if (!getCopyBuffer(r2-r1, sample16Bit))
 			{
-				fixSample(s);
-				resumeAudio();
-
 				okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 				return false;
 			}
@@ -1914,12 +2101,6 @@ static bool cutRange(bool cropMode, int32_t r1, int32_t r2)
 	{
 		if (!reallocateSmpData(s, length, sample16Bit))
 		{
-			freeSample(editor.curInstr, editor.curSmp);
-			editor.updateCurSmp = true;
-
-			if (!cropMode)
-				resumeAudio();
-
 			okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 			return false;
 		}
@@ -1953,25 +2134,16 @@ static bool cutRange(bool cropMode, int32_t r1, int32_t r2)
 			s->loopStart = 0;
 			DISABLE_LOOP(s->flags);
 		}
-
-		if (!cropMode)
-			fixSample(s);
 	}
 	else
 	{
-		freeSample(editor.curInstr, editor.curSmp);
-		editor.updateCurSmp = true;
-	}
-
-	if (!cropMode)
-	{
-		resumeAudio();
-		setSongModifiedFlag();
-
-		setMouseBusy(false);
+		// same as freeSample()
+		freeSmpData(s);
+		memset(s, 0, sizeof (sample_t));
+		s->panning = 128;
+		s->volume = 64;
 
-		smpEd_Rx2 = r1;
-		writeSampleFlag = true;
+		editor.updateCurSmp = true;
 	}
 
 	return true;
@@ -1979,10 +2151,35 @@ static bool cutRange(bool cropMode, int32_t r1, int32_t r2)
 
 static int32_t SDLCALL sampCutThread(void *ptr)
 {
-	if (!cutRange(false, smpEd_Rx1, smpEd_Rx2))
+	sample_t editSmp;
+
+	sample_t *s = getCurSample();
+	if (s == NULL)
+		return true;
+
+	if (!beginSmpEdit(s, &editSmp))
+	{
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		return true;
+	}
+
+	if (!cutRange(&editSmp, false, smpEd_Rx1, smpEd_Rx2))
+	{
+		cancelSmpEdit(&editSmp);
 		okBoxThreadSafe(0, "System message", "Not enough memory! (Disable \"cut to buffer\")", NULL);
+		return true;
+	}
+
+	if (editSmp.dataPtr == NULL)
+		commitSmpEditHdr(s, &editSmp, SMP_HDR_ALL); // the whole sample was cut, reset its header too
 	else
-		writeSampleFlag = true;
+		commitSmpEdit(s, &editSmp);
+
+	setSongModifiedFlag();
+	setMouseBusy(false);
+
+	smpEd_Rx2 = smpEd_Rx1;
+	writeSampleFlag = true;
 
 	return true;
 
@@ -2054,17 +2251,22 @@ void sampCopy(void)
 	SDL_DetachThread(thread);
 }
 
-static void pasteOverwrite(sample_t *s)
+static void pasteOverwrite(sample_t *dstSmp)
 {
+	smpPtr_t sp;
+	sample_t editSmp;
+
 	bool sample16Bit = (smpCopyBits == 16);
 
-	if (!reallocateSmpData(s, smpCopySize, sample16Bit))
+	if (!allocateSmpDataPtr(&sp, smpCopySize, sample16Bit))
 	{
 		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 		return;
 	}
 
-	pauseAudio();
+	sample_t *s = &editSmp;
+	*s = *dstSmp;
+	setSmpDataPtr(s, &sp);
 
 	memcpy(s->dataPtr, smpCopyBuff, smpCopySize << sample16Bit);
 
@@ -2095,9 +2297,7 @@ static void pasteOverwrite(sample_t *s)
 	}
 
 	s->isFixed = false;
-
-	fixSample(s);
-	resumeAudio();
+	commitSmpEditHdr(dstSmp, s, SMP_HDR_ALL); // the pasted sample's header comes along
 
 	editor.updateCurSmp = true;
 	setSongModifiedFlag();
@@ -2143,6 +2343,7 @@ static void pasteCopiedData(int8_t *dataPtr, int32_t offset, int32_t length, boo
 static int32_t SDLCALL sampPasteThread(void *ptr)
 {
 	smpPtr_t sp;
+	sample_t editSmp;
 
 	if (instr[editor.curInstr] == NULL && !allocateInstr(editor.curInstr))
 	{
@@ -2181,22 +2382,25 @@ static int32_t SDLCALL sampPasteThread(void *ptr)
 		return true;
 	}
 
-	pauseAudio();
-	unfixSample(s);
+	// only the new data is allocated, the original sample is read directly (it's left alone until the commit)
+	sample_t *dstSmp = s;
 
 	// paste left part of original sample
 	if (smpEd_Rx1 > 0)
-		memcpy(sp.ptr, s->dataPtr, smpEd_Rx1 << sample16Bit);
+		copyUnfixedSmpData(sp.ptr, dstSmp, 0, smpEd_Rx1);
 
 	// paste copied data
 	pasteCopiedData(sp.ptr, smpEd_Rx1, smpCopySize, sample16Bit);
 
 	// paste right part of original sample
-	if (smpEd_Rx2 < s->length)
-		memmove(&sp.ptr[(smpEd_Rx1+smpCopySize) << sample16Bit], &s->dataPtr[smpEd_Rx2 << sample16Bit], (s->length-smpEd_Rx2) << sample16Bit);
+	if (smpEd_Rx2 < dstSmp->length)
+		copyUnfixedSmpData(&sp.ptr[(smpEd_Rx1+smpCopySize) << sample16Bit], dstSmp, smpEd_Rx2, dstSmp->length-smpEd_Rx2);
 
-	freeSmpData(s);
+	s = &editSmp;
+	*s = *dstSmp;
 	setSmpDataPtr(s, &sp);
+	s->isFixed = false;
+	s->fixedPos = 0;
 
 	// adjust loop points if necessary
 	if (smpEd_Rx2-smpEd_Rx1 != smpCopySize)
@@ -2223,9 +2427,7 @@ static int32_t SDLCALL sampPasteThread(void *ptr)
 	}
 
 	s->length = newLength;
-
-	fixSample(s);
-	resumeAudio();
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -2267,23 +2469,26 @@ void sampPaste(void)
 
 static int32_t SDLCALL sampCropThread(void *ptr)
 {
+	sample_t editSmp;
+
 	sample_t *s = getCurSample();
 
 	int32_t r1 = smpEd_Rx1;
 	int32_t r2 = smpEd_Rx2;
 
-	pauseAudio();
-	unfixSample(s);
+	if (!beginSmpEdit(s, &editSmp))
+	{
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		return true;
+	}
 
-	if (!cutRange(true, 0, r1) || !cutRange(true, r2-r1, s->length))
+	if (!cutRange(&editSmp, true, 0, r1) || !cutRange(&editSmp, true, r2-r1, editSmp.length))
 	{
-		fixSample(s);
-		resumeAudio();
+		cancelSmpEdit(&editSmp);
 		return true;
 	}
-	
-	fixSample(s);
-	resumeAudio();
+
+	commitSmpEdit(s, &editSmp);
 
 	r1 = 0;
 	r2 = s->length;
@@ -2354,6 +2559,8 @@ void sampXFade(void)
 
 	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
+	sample_t editSmp, *dstSmp = s;
+
 	if (GET_LOOPTYPE(s->flags) == LOOP_BIDI)
 	{
 		y1 = s->loopStart;
@@ -2387,8 +2594,12 @@ void sampXFade(void)
 			const double dD2Mul = 1.0 / d2;
 			const double dD3Mul = 1.0 / d3;
 
-			pauseAudio();
-			unfixSample(s);
+			if (!beginSmpEdit(dstSmp, &editSmp))
+			{
+				okBox(0, "System message", "Not enough memory!", NULL);
+				return;
+			}
+			s = &editSmp;
 
 			for (int32_t i = 0; i < d1; i++)
 			{
@@ -2416,8 +2627,7 @@ void sampXFade(void)
 				}
 			}
 
-			fixSample(s);
-			resumeAudio();
+			commitSmpEdit(dstSmp, s);
 		}
 		else // last loop point
 		{
@@ -2450,8 +2660,12 @@ void sampXFade(void)
 			const double dD2Mul = 1.0 / d2;
 			const double dD3Mul = 1.0 / d3;
 
-			pauseAudio();
-			unfixSample(s);
+			if (!beginSmpEdit(dstSmp, &editSmp))
+			{
+				okBox(0, "System message", "Not enough memory!", NULL);
+				return;
+			}
+			s = &editSmp;
 
 			for (int32_t i = 0; i < d1; i++)
 			{
@@ -2479,8 +2693,7 @@ void sampXFade(void)
 				}
 			}
 
-			fixSample(s);
-			resumeAudio();
+			commitSmpEdit(dstSmp, s);
 		}
 	}
 	else // forward loop
@@ -2525,8 +2738,12 @@ void sampXFade(void)
 		const double dD2Mul = 1.0 / d2;
 		const double dD3Mul = 1.0 / d3;
 
-		pauseAudio();
-		unfixSample(s);
+		if (!beginSmpEdit(dstSmp, &editSmp))
+		{
+			okBox(0, "System message", "Not enough memory!", NULL);
+			return;
+		}
+		s = &editSmp;
 
 		for (int32_t i = 0; i < length; i++)
 		{
@@ -2561,8 +2778,7 @@ void sampXFade(void)
 			putSampleValue(s->dataPtr, bIdx, dD, sample16Bit);
 		}
 
-		fixSample(s);
-		resumeAudio();
+		commitSmpEdit(dstSmp, s);
 	}
 
 	writeSample(true);
@@ -2642,22 +2858,25 @@ void rbSamplePingpongLoop(void)
 
 static int32_t SDLCALL convSmp8Bit(void *ptr)
 {
-	sample_t *s = getCurSample();
-	assert(s->dataPtr != NULL);
+	sample_t editSmp;
 
-	pauseAudio();
-	unfixSample(s);
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
+	{
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
+	}
 
-	const int16_t *src16 = (const int16_t *)s->dataPtr;
-	for (int32_t i = 0; i < s->length; i++)
-		s->dataPtr[i] = src16[i] >> 8;
+	sample_t *s = &editSmp;
+	assert(s->dataPtr != NULL);
 
+	smpKernelConvert(s->dataPtr, false, s->dataPtr, true, s->length);
 	reallocateSmpData(s, s->length, false);
 
 	s->flags &= ~SAMPLE_16BIT; // remove 16-bit flag
 
-	fixSample(s);
-	resumeAudio();
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -2707,25 +2926,29 @@ void rbSample8bit(void)
 
 static int32_t SDLCALL convSmp16Bit(void *ptr)
 {
-	sample_t *s = getCurSample();
+	sample_t editSmp;
 
-	pauseAudio();
-	unfixSample(s);
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
+	{
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
+	}
+
+	sample_t *s = &editSmp;
 
 	if (!reallocateSmpData(s, s->length, true))
 	{
+		cancelSmpEdit(s);
 		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
 		return true;
 	}
 
-	int16_t *dst16 = (int16_t *)s->dataPtr;
-	for (int32_t i = s->length-1; i >= 0; i--)
-		dst16[i] = s->dataPtr[i] << 8;
-
+	smpKernelConvert(s->dataPtr, true, s->dataPtr, false, s->length);
 	s->flags |= SAMPLE_16BIT;
 
-	fixSample(s);
-	resumeAudio();
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -3037,9 +3260,9 @@ static void invertSamplePosLine(int32_t x)
 	if (x < 0 || x >= SCREEN_W)
 		return;
 
-	uint32_t *ptr32 = &video.frameBuffer[(174 * SCREEN_W) + x];
-	for (int32_t y = 0; y < SAMPLE_AREA_HEIGHT; y++, ptr32 += SCREEN_W)
-		*ptr32 = video.palette[(*ptr32 >> 24) ^ 1]; // ">> 24" to get palette, XOR 1 to switch between normal/inverted mode
+	uint8_t *ptr8 = &video.frameBuffer[(174 * SCREEN_W) + x];
+	for (int32_t y = 0; y < SAMPLE_AREA_HEIGHT; y++, ptr8 += SCREEN_W)
+		*ptr8 ^= 1; // XOR 1 to switch between normal/inverted mode
 }
 
 static void writeSamplePosLine(void)
@@ -3528,65 +3751,26 @@ void toggleSampleEditorExt(void)
 
 static int32_t SDLCALL sampleBackwardsThread(void *ptr)
 {
-	int8_t tmp8, *ptrStart, *ptrEnd;
-	int16_t tmp16, *ptrStart16, *ptrEnd16;
+	sample_t editSmp;
 
 	const bool sampleDataMarked = (smpEd_Rx1 != smpEd_Rx2);
-	sample_t *s = getCurSample();
-	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
-
-	if (sample16Bit)
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
 	{
-		if (!sampleDataMarked)
-		{
-			ptrStart16 = (int16_t *)s->dataPtr;
-			ptrEnd16 = (int16_t *)s->dataPtr + (s->length-1);
-		}
-		else
-		{
-			ptrStart16 = (int16_t *)s->dataPtr + smpEd_Rx1;
-			ptrEnd16 = (int16_t *)s->dataPtr + (smpEd_Rx2-1);
-		}
-
-		pauseAudio();
-		unfixSample(s);
-
-		while (ptrStart16 < ptrEnd16)
-		{
-			tmp16 = *ptrStart16;
-			*ptrStart16++ = *ptrEnd16;
-			*ptrEnd16-- = tmp16;
-		}
-
-		fixSample(s);
-		resumeAudio();
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
 	}
-	else
-	{
-		if (!sampleDataMarked)
-		{
-			ptrStart = s->dataPtr;
-			ptrEnd = &s->dataPtr[s->length-1];
-		}
-		else
-		{
-			ptrStart = &s->dataPtr[smpEd_Rx1];
-			ptrEnd = &s->dataPtr[smpEd_Rx2-1];
-		}
 
-		pauseAudio();
-		unfixSample(s);
+	sample_t *s = &editSmp;
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
-		while (ptrStart < ptrEnd)
-		{
-			tmp8 = *ptrStart;
-			*ptrStart++ = *ptrEnd;
-			*ptrEnd-- = tmp8;
-		}
+	if (!sampleDataMarked)
+		smpKernelReverse(s->dataPtr, sample16Bit, s->length);
+	else
+		smpKernelReverse(&s->dataPtr[smpEd_Rx1 << sample16Bit], sample16Bit, smpEd_Rx2 - smpEd_Rx1);
 
-		fixSample(s);
-		resumeAudio();
-	}
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -3616,26 +3800,20 @@ void sampleBackwards(void)
 
 static int32_t SDLCALL sampleChangeSignThread(void *ptr)
 {
-	sample_t *s = getCurSample();
+	sample_t editSmp;
 
-	pauseAudio();
-	unfixSample(s);
-
-	if (s->flags & SAMPLE_16BIT)
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
 	{
-		int16_t *ptr16 = (int16_t *)s->dataPtr;
-		for (int32_t i = 0; i < s->length; i++)
-			ptr16[i] ^= 0x8000;
-	}
-	else
-	{
-		int8_t *ptr8 = s->dataPtr;
-		for (int32_t i = 0; i < s->length; i++)
-			ptr8[i] ^= 0x80;
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
 	}
 
-	fixSample(s);
-	resumeAudio();
+	sample_t *s = &editSmp;
+
+	smpKernelFlipSign(s->dataPtr, !!(s->flags & SAMPLE_16BIT), s->length);
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -3665,25 +3843,24 @@ void sampleChangeSign(void)
 
 static int32_t SDLCALL sampleByteSwapThread(void *ptr)
 {
-	sample_t *s = getCurSample();
+	sample_t editSmp;
 
-	pauseAudio();
-	unfixSample(s);
-
-	int32_t length = s->length;
-	if (!(s->flags & SAMPLE_16BIT))
-		length >>= 1;
-
-	int8_t *ptr8 = s->dataPtr;
-	for (int32_t i = 0; i < length; i++, ptr8 += 2)
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
 	{
-		const int8_t tmp = ptr8[0];
-		ptr8[0] = ptr8[1];
-		ptr8[1] = tmp;
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
 	}
 
-	fixSample(s);
-	resumeAudio();
+	sample_t *s = &editSmp;
+
+	int32_t numWords = s->length;
+	if (!(s->flags & SAMPLE_16BIT))
+		numWords >>= 1;
+
+	smpKernelByteSwap(s->dataPtr, numWords);
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -3719,90 +3896,43 @@ void sampleByteSwap(void)
 
 static int32_t SDLCALL fixDCThread(void *ptr)
 {
-	int8_t *ptr8;
-	int16_t *ptr16;
-	int32_t length;
+	int32_t offset, length;
 
-	const bool sampleDataMarked = (smpEd_Rx1 != smpEd_Rx2);
-	sample_t *s = getCurSample();
+	sample_t editSmp;
 
-	if (s->flags & SAMPLE_16BIT)
+	const bool sampleDataMarked = (smpEd_Rx1 != smpEd_Rx2);
+	sample_t *dstSmp = getCurSample();
+	if (!beginSmpEdit(dstSmp, &editSmp))
 	{
-		if (!sampleDataMarked)
-		{
-			ptr16 = (int16_t *)s->dataPtr;
-			length = s->length;
-		}
-		else
-		{
-			ptr16 = (int16_t *)&s->dataPtr + smpEd_Rx1;
-			length = smpEd_Rx2 - smpEd_Rx1;
-		}
-
-		if (length < 0 || length > s->length)
-		{
-			setMouseBusy(false);
-			return true;
-		}
-
-		pauseAudio();
-		unfixSample(s);
-
-		int64_t	averageDC = 0;
-		for (int32_t i = 0; i < length; i++)
-			averageDC += ptr16[i];
-		averageDC = (averageDC + (length>>1)) / length; // rounded
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		setMouseBusy(false);
+		return true;
+	}
 
-		const int32_t smpSub = (int32_t)averageDC;
-		for (int32_t i = 0; i < length; i++)
-		{
-			int32_t smp32 = ptr16[i] - smpSub;
-			CLAMP16(smp32);
-			ptr16[i] = (int16_t)smp32;
-		}
+	sample_t *s = &editSmp;
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
-		fixSample(s);
-		resumeAudio();
+	if (!sampleDataMarked)
+	{
+		offset = 0;
+		length = s->length;
 	}
-	else // 8-bit
+	else
 	{
-		if (!sampleDataMarked)
-		{
-			ptr8 = s->dataPtr;
-			length = s->length;
-		}
-		else
-		{
-			ptr8 = &s->dataPtr[smpEd_Rx1];
-			length = smpEd_Rx2 - smpEd_Rx1;
-		}
-
-		if (length < 0 || length > s->length)
-		{
-			setMouseBusy(false);
-			return true;
-		}
-
-		pauseAudio();
-		unfixSample(s);
-
-		int64_t	averageDC = 0;
-		for (int32_t i = 0; i < length; i++)
-			averageDC += ptr8[i];
-		averageDC = (averageDC + (length>>1)) / length; // rounded
-
-		const int32_t smpSub = (int32_t)averageDC;
-		for (int32_t i = 0; i < length; i++)
-		{
-			int32_t smp32 = ptr8[i] - smpSub;
-			CLAMP8(smp32);
-			ptr8[i] = (int8_t)smp32;
-		}
+		offset = smpEd_Rx1;
+		length = smpEd_Rx2 - smpEd_Rx1;
+	}
 
-		fixSample(s);
-		resumeAudio();
+	if (length < 0 || length > s->length)
+	{
+		cancelSmpEdit(s);
+		setMouseBusy(false);
+		return true;
 	}
 
+	smpKernelRemoveDC(&s->dataPtr[offset << sample16Bit], sample16Bit, length);
+	commitSmpEdit(dstSmp, s);
+
 	setSongModifiedFlag();
 	setMouseBusy(false);
 
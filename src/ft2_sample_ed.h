@@ -20,6 +20,35 @@ void freeSmpDataPtr(smpPtr_t *sp);
 void freeSmpData(sample_t *s);
 
 bool cloneSample(sample_t *src, sample_t *dst);
+
+// header fields that an edit can take along (see commitSmpEditHdr())
+enum
+{
+	SMP_HDR_NAME = 1,
+	SMP_HDR_VOLUME = 2,
+	SMP_HDR_PANNING = 4,
+	SMP_HDR_FINETUNE = 8,
+	SMP_HDR_RELNOTE = 16,
+	SMP_HDR_ALL = 31
+};
+
+/* Copy-on-write sample editing (no pauseAudio() needed):
+** beginSmpEdit() makes a working copy with its own (unfixed) sample data,
+** the copy can then be modified freely while the song keeps playing.
+** commitSmpEdit() fixes the copy and swaps its data, length, loop and flags
+** into the sample under a short audio lock (the rest of the header is left
+** alone), commitSmpEditHdr() also takes the given SMP_HDR_* fields along.
+** Voices/scopes still playing the old data keep playing it until they are
+** retriggered, the old data is freed by freeRetiredSmpData() after that.
+*/
+bool beginSmpEdit(const sample_t *s, sample_t *editSmp);
+void commitSmpEdit(sample_t *s, sample_t *editSmp);
+void commitSmpEditHdr(sample_t *s, sample_t *editSmp, uint8_t hdrFields);
+void cancelSmpEdit(sample_t *editSmp);
+void freeRetiredSmpData(void); // called every frame
+bool initSmpEdit(void);
+void freeSmpEdit(void);
+
 sample_t *getCurSample(void);
 void sanitizeSample(sample_t *s);
 void fixSample(sample_t *s); // modifies samples before index 0, and after loop/end (for branchless mixer interpolation)
@@ -25,6 +25,7 @@
 #include "ft2_keyboard.h"
 #include "ft2_tables.h"
 #include "ft2_structs.h"
+#include "ft2_smp_kernels.h"
 
 static volatile bool stopThread;
 
@@ -87,7 +88,18 @@ static int32_t SDLCALL resampleThread(void *ptr)
 	if (instr[editor.curInstr] == NULL)
 		return true;
 
-	sample_t *s = &instr[editor.curInstr]->smp[editor.curSmp];
+	sample_t editSmp;
+
+	sample_t *dstSmp = &instr[editor.curInstr]->smp[editor.curSmp];
+	if (!beginSmpEdit(dstSmp, &editSmp))
+	{
+		outOfMemory = true;
+		setMouseBusy(false);
+		ui.sysReqShown = false;
+		return true;
+	}
+
+	sample_t *s = &editSmp;
 	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
 
 	const double dRatio = pow(2.0, (int32_t)smpEd_RelReSmp * (1.0 / 12.0));
@@ -99,6 +111,7 @@ static int32_t SDLCALL resampleThread(void *ptr)
 	const uint32_t newLen = (int32_t)floor(dNewLen);
 	if (!allocateSmpDataPtr(&sp, newLen, sample16Bit))
 	{
+		cancelSmpEdit(s);
 		outOfMemory = true;
 		setMouseBusy(false);
 		ui.sysReqShown = false;
@@ -112,9 +125,6 @@ static int32_t SDLCALL resampleThread(void *ptr)
 	const uint64_t delta64 = (const uint64_t)round((UINT32_MAX+1.0) / dRatio);
 	uint64_t posFrac64 = 0;
 
-	pauseAudio();
-	unfixSample(s);
-
 	/* Fast nearest-neighbor resampling.
 	**
 	** Could benefit from windowed-sinc interpolation,
@@ -156,9 +166,7 @@ static int32_t SDLCALL resampleThread(void *ptr)
 	s->loopLength = (int32_t)(s->loopLength * dRatio);
 
 	sanitizeSample(s);
-
-	fixSample(s);
-	resumeAudio();
+	commitSmpEditHdr(dstSmp, s, SMP_HDR_RELNOTE);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -414,7 +422,18 @@ static int32_t SDLCALL createEchoThread(void *ptr)
 		return true;
 	}
 
-	sample_t *s = &instr[editor.curInstr]->smp[editor.curSmp];
+	sample_t editSmp;
+
+	sample_t *dstSmp = &instr[editor.curInstr]->smp[editor.curSmp];
+	if (!beginSmpEdit(dstSmp, &editSmp))
+	{
+		outOfMemory = true;
+		setMouseBusy(false);
+		ui.sysReqShown = false;
+		return true;
+	}
+
+	sample_t *s = &editSmp;
 
 	int32_t readLen = s->length;
 	int8_t *readPtr = s->dataPtr;
@@ -434,6 +453,7 @@ static int32_t SDLCALL createEchoThread(void *ptr)
 
 	if (nEchoes < 1)
 	{
+		cancelSmpEdit(s);
 		ui.sysReqShown = false;
 		return true;
 	}
@@ -453,15 +473,13 @@ static int32_t SDLCALL createEchoThread(void *ptr)
 
 	if (!allocateSmpDataPtr(&sp, writeLen, sample16Bit))
 	{
+		cancelSmpEdit(s);
 		outOfMemory = true;
 		setMouseBusy(false);
 		ui.sysReqShown = false;
 		return false;
 	}
 
-	pauseAudio();
-	unfixSample(s);
-
 	int32_t writeIdx = 0;
 
 	if (sample16Bit)
@@ -538,9 +556,7 @@ static int32_t SDLCALL createEchoThread(void *ptr)
 	}
 
 	s->length = writeLen;
-
-	fixSample(s);
-	resumeAudio();
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -809,6 +825,7 @@ void pbSampleEcho(void)
 static int32_t SDLCALL mixThread(void *ptr)
 {
 	smpPtr_t sp;
+	sample_t dstCopy, srcCopy;
 
 	int8_t *dstPtr, *mixPtr;
 	uint8_t mixFlags, dstFlags;
@@ -885,22 +902,42 @@ static int32_t SDLCALL mixThread(void *ptr)
 		ui.sysReqShown = false;
 		return true;
 	}
-	memset(sp.ptr, 0, maxLen);
 
 	if (instr[dstIns] == NULL && !allocateInstr(dstIns))
 	{
+		freeSmpDataPtr(&sp);
 		outOfMemory = true;
 		setMouseBusy(false);
 		ui.sysReqShown = false;
 		return true;
 	}
 
-	pauseAudio();
-	unfixSample(s);
+	// read from unfixed copies of both samples, so that the audio can keep running
+	if (!beginSmpEdit(s, &dstCopy))
+	{
+		freeSmpDataPtr(&sp);
+		outOfMemory = true;
+		setMouseBusy(false);
+		ui.sysReqShown = false;
+		return true;
+	}
 
-	// unfix source sample
 	if (instr[mixIns] != NULL)
-		unfixSample(sSrc);
+	{
+		if (!beginSmpEdit(sSrc, &srcCopy))
+		{
+			cancelSmpEdit(&dstCopy);
+			freeSmpDataPtr(&sp);
+			outOfMemory = true;
+			setMouseBusy(false);
+			ui.sysReqShown = false;
+			return true;
+		}
+
+		mixPtr = srcCopy.dataPtr;
+	}
+
+	dstPtr = dstCopy.dataPtr;
 
 	const double dAmp1 = mix_Balance / 100.0;
 	const double dAmp2 = 1.0 - dAmp1;
@@ -908,28 +945,21 @@ static int32_t SDLCALL mixThread(void *ptr)
 	const double dSmp2ScaleMul = dst16Bits ? (1.0 / 32768.0) : (1.0 / 128.0);
 	const double dNormalizeMul = dst16Bits ? 32768.0 : 128.0;
 
-	for (int32_t i = 0; i < maxLen; i++)
-	{
-		double dSmp1 = (i >= mixLen) ? 0.0 : (getSampleValue(mixPtr, i, src16Bits) * dSmp1ScaleMul); // -1.0 .. 0.999inf
-		double dSmp2 = (i >= dstLen) ? 0.0 : (getSampleValue(dstPtr, i, dst16Bits) * dSmp2ScaleMul); // -1.0 .. 0.999inf
+	// the gains also scale the samples to -1.0 .. 0.999inf and back to the destination bit depth
+	smpKernelMix(sp.ptr, dst16Bits, maxLen,
+		mixPtr, src16Bits, mixLen, dAmp1 * dSmp1ScaleMul * dNormalizeMul,
+		dstPtr, dst16Bits, dstLen, dAmp2 * dSmp2ScaleMul * dNormalizeMul);
 
-		const double dSmp = ((dSmp1 * dAmp1) + (dSmp2 * dAmp2)) * dNormalizeMul;
-		putSampleValue(sp.ptr, i, dSmp, dst16Bits);
-	}
+	freeSmpData(&dstCopy);
+	setSmpDataPtr(&dstCopy, &sp);
 
-	freeSmpData(s);
-	setSmpDataPtr(s, &sp);
-
-	s->length = maxLen;
-	s->flags = dstFlags;
+	dstCopy.length = maxLen;
+	dstCopy.flags = dstFlags;
 
-	fixSample(s);
+	commitSmpEdit(s, &dstCopy);
 
-	// re-fix source sample again
 	if (instr[mixIns] != NULL)
-		fixSample(sSrc);
-
-	resumeAudio();
+		cancelSmpEdit(&srcCopy);
 
 	setSongModifiedFlag();
 	setMouseBusy(false);
@@ -1196,62 +1226,18 @@ static int32_t SDLCALL applyVolumeThread(void *ptr)
 	if (len <= 0)
 		goto applyVolumeExit;
 
-	const bool mustInterpolate = (dVol_StartVol != dVol_EndVol);
-	const double dVolDelta = ((dVol_EndVol - dVol_StartVol) / 100.0) / len;
-	double dVol = dVol_StartVol / 100.0;
-
-	pauseAudio();
-	unfixSample(s);
-	if (s->flags & SAMPLE_16BIT)
+	sample_t editSmp, *dstSmp = s;
+	if (!beginSmpEdit(dstSmp, &editSmp))
 	{
-		int16_t *ptr16 = (int16_t *)s->dataPtr + x1;
-		if (mustInterpolate)
-		{
-			for (int32_t i = 0; i < len; i++)
-			{
-				int32_t smp32 = (int32_t)((int32_t)ptr16[i] * dVol);
-				CLAMP16(smp32);
-				ptr16[i] = (int16_t)smp32;
-
-				dVol += dVolDelta;
-			}
-		}
-		else // no interpolation needed
-		{
-			for (int32_t i = 0; i < len; i++)
-			{
-				int32_t smp32 = (int32_t)((int32_t)ptr16[i] * dVol);
-				CLAMP16(smp32);
-				ptr16[i] = (int16_t)smp32;
-			}
-		}
+		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
+		goto applyVolumeExit;
 	}
-	else // 8-bit sample
-	{
-		int8_t *ptr8 = s->dataPtr + x1;
-		if (mustInterpolate)
-		{
-			for (int32_t i = 0; i < len; i++)
-			{
-				int32_t smp32 = (int32_t)((int32_t)ptr8[i] * dVol);
-				CLAMP8(smp32);
-				ptr8[i] = (int8_t)smp32;
+	s = &editSmp;
 
-				dVol += dVolDelta;
-			}
-		}
-		else // no interpolation needed
-		{
-			for (int32_t i = 0; i < len; i++)
-			{
-				int32_t smp32 = (int32_t)((int32_t)ptr8[i] * dVol);
-				CLAMP8(smp32);
-				ptr8[i] = (int8_t)smp32;
-			}
-		}
-	}
-	fixSample(s);
-	resumeAudio();
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+	smpKernelGainRamp(&s->dataPtr[x1 << sample16Bit], sample16Bit, len, dVol_StartVol / 100.0, dVol_EndVol / 100.0);
+
+	commitSmpEdit(dstSmp, s);
 
 	setSongModifiedFlag();
 
@@ -1333,33 +1319,10 @@ static int32_t SDLCALL getMaxScaleThread(void *ptr)
 	if (fixedSampleInRange)
 		unfixSample(s);
 
-	int32_t maxAmp = 0;
-	if (s->flags & SAMPLE_16BIT)
-	{
-		const int16_t *ptr16 = (const int16_t *)s->dataPtr + x1;
-		for (uint32_t i = 0; i < len; i++)
-		{
-			const int32_t absSmp = ABS(ptr16[i]);
-			if (absSmp > maxAmp)
-				maxAmp = absSmp;
-		}
-
-		if (maxAmp > 0)
-			dVolChange = (32767.0 / maxAmp) * 100.0;
-	}
-	else // 8-bit
-	{
-		const int8_t *ptr8 = (const int8_t *)&s->dataPtr[x1];
-		for (uint32_t i = 0; i < len; i++)
-		{
-			const int32_t absSmp = ABS(ptr8[i]);
-			if (absSmp > maxAmp)
-				maxAmp = absSmp;
-		}
-
-		if (maxAmp > 0)
-			dVolChange = (127.0 / maxAmp) * 100.0;
-	}
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+	const int32_t maxAmp = smpKernelGetPeak(&s->dataPtr[x1 << sample16Bit], sample16Bit, len);
+	if (maxAmp > 0)
+		dVolChange = ((sample16Bit ? 32767.0 : 127.0) / maxAmp) * 100.0;
 
 	if (fixedSampleInRange)
 		fixSample(s);
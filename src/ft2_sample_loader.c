@@ -6,6 +6,7 @@
 #include <stdio.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdarg.h>
 #include <math.h>
 #include "ft2_header.h"
 #include "ft2_gui.h"
@@ -15,18 +16,19 @@
 #include "ft2_mouse.h"
 #include "ft2_diskop.h"
 #include "ft2_structs.h"
+#include "ft2_sample_loader.h"
 
 #ifdef HAS_LIBFLAC
-bool loadFLAC(FILE *f, uint32_t filesize);
+bool loadFLAC(FILE *f, uint32_t filesize, sample_t *s);
 #endif
 
 bool detectBRR(FILE *f);
-bool loadBRR(FILE *f, uint32_t filesize);
+bool loadBRR(FILE *f, uint32_t filesize, sample_t *s);
 
-bool loadAIFF(FILE *f, uint32_t filesize);
-bool loadIFF(FILE *f, uint32_t filesize);
-bool loadRAW(FILE *f, uint32_t filesize);
-bool loadWAV(FILE *f, uint32_t filesize);
+bool loadAIFF(FILE *f, uint32_t filesize, sample_t *s);
+bool loadIFF(FILE *f, uint32_t filesize, sample_t *s);
+bool loadRAW(FILE *f, uint32_t filesize, sample_t *s);
+bool loadWAV(FILE *f, uint32_t filesize, sample_t *s);
 
 enum
 {
@@ -47,18 +49,30 @@ char *supportedSmpExtensions[] =
 	"END_OF_LIST" // do NOT move, remove or edit this line!
 };
 
-// globals for sample loaders
-bool loadAsInstrFlag, smpFilenameSet;
-char *smpFilename;
-uint8_t sampleSlot;
-sample_t tmpSmp;
-// --------------------------
+#define MAX_IMPORT_THREADS 16
+
+typedef struct smpImportJob_t
+{
+	bool toInstruments;
+	int16_t firstInstr, firstSmp, batchStereoMode;
+	int32_t numFiles, numFilesDropped;
+	UNICHAR **filesU;
+	sample_t *smp;
+	bool *loaded;
+	SDL_atomic_t nextFile;
+	SDL_mutex *mutex; // for batchStereoMode and loaderMessages
+	char loaderMessages[256]; // the different loader errors, for the summary
+	void (*oldLoaderMsgBox)(const char *, ...); // restored when the import is done
+	int16_t (*oldLoaderSysReq)(int16_t, const char *, const char *, void (*)(void));
+} smpImportJob_t;
 
 static volatile bool sampleIsLoading;
+static bool loadAsInstrFlag;
+static uint8_t sampleSlot;
+static sample_t tmpSmp;
+static smpImportJob_t *importJob; // non-NULL while a batch import is running
 static SDL_Thread *thread;
 
-static void freeTmpSample(sample_t *s);
-
 // Crude sample detection routine. These aren't always accurate detections!
 static int8_t detectSample(FILE *f)
 {
@@ -88,19 +102,48 @@ static int8_t detectSample(FILE *f)
 	return FORMAT_UNKNOWN;
 }
 
-static int32_t SDLCALL loadSampleThread(void *ptr)
+static void setSampleNameFromFilename(sample_t *s, UNICHAR *filenameU)
 {
-	if (editor.tmpFilenameU == NULL)
+	char *tmpFilename = unicharToCp850(filenameU, true);
+	if (tmpFilename == NULL)
+		return;
+
+	int32_t i = (int32_t)strlen(tmpFilename);
+	while (i--)
 	{
-		loaderMsgBox("General I/O error during loading!");
-		goto loadError;
+		if (tmpFilename[i] == DIR_DELIMITER)
+			break;
+	}
+
+	char *tmpPtr = tmpFilename;
+	if (i > 0)
+		tmpPtr += i+1;
+
+	sanitizeFilename(tmpPtr);
+
+	int32_t filenameLen = (int32_t)strlen(tmpPtr);
+	for (i = 0; i < 22; i++)
+	{
+		if (i < filenameLen)
+			s->name[i] = tmpPtr[i];
+		else
+			s->name[i] = '\0';
 	}
 
-	FILE *f = UNICHAR_FOPEN(editor.tmpFilenameU, "rb");
+	free(tmpFilename);
+}
+
+/* Loads a sample file into s (zeroed by the caller) through the format loaders.
+** The loaders keep all their state in s or on the stack, so several files can
+** be loaded at once.
+*/
+static bool loadSampleFile(UNICHAR *filenameU, sample_t *s)
+{
+	FILE *f = UNICHAR_FOPEN(filenameU, "rb");
 	if (f == NULL)
 	{
 		loaderMsgBox("General I/O error during loading! Is the file in use?");
-		goto loadError;
+		return false;
 	}
 
 	int8_t format = detectSample(f);
@@ -111,7 +154,7 @@ static int32_t SDLCALL loadSampleThread(void *ptr)
 	{
 		fclose(f);
 		loaderMsgBox("Error loading sample: The file is empty!");
-		goto loadError;
+		return false;
 	}
 
 	bool sampleLoaded = false;
@@ -122,58 +165,61 @@ static int32_t SDLCALL loadSampleThread(void *ptr)
 		case FORMAT_FLAC:
 		{
 #ifdef HAS_LIBFLAC
-			sampleLoaded = loadFLAC(f, filesize);
+			sampleLoaded = loadFLAC(f, filesize, s);
 #else
 			loaderMsgBox("Can't load sample: Program is not compiled with FLAC support!");
 #endif
 		}
 		break;
 
-		case FORMAT_IFF: sampleLoaded = loadIFF(f, filesize); break;
-		case FORMAT_WAV: sampleLoaded = loadWAV(f, filesize); break;
-		case FORMAT_AIFF: sampleLoaded = loadAIFF(f, filesize); break;
-		case FORMAT_BRR: sampleLoaded = loadBRR(f, filesize); break;
-		default: sampleLoaded = loadRAW(f, filesize); break;
+		case FORMAT_IFF: sampleLoaded = loadIFF(f, filesize, s); break;
+		case FORMAT_WAV: sampleLoaded = loadWAV(f, filesize, s); break;
+		case FORMAT_AIFF: sampleLoaded = loadAIFF(f, filesize, s); break;
+		case FORMAT_BRR: sampleLoaded = loadBRR(f, filesize, s); break;
+		default: sampleLoaded = loadRAW(f, filesize, s); break;
 	}
 	fclose(f);
 
 	if (!sampleLoaded)
-		goto loadError;
+	{
+		freeSmpData(s);
+		return false;
+	}
 
-	// sample loaded successfully!
+	// if the loader didn't find a sample name in the file, set it to its filename
+	if (s->name[0] == '\0')
+		setSampleNameFromFilename(s, filenameU);
 
-	if (!smpFilenameSet) // if we didn't set a custom sample name in the loader, set it to its filename
-	{
-		char *tmpFilename = unicharToCp850(editor.tmpFilenameU, true);
-		if (tmpFilename != NULL)
-		{
-			int32_t i = (int32_t)strlen(tmpFilename);
-			while (i--)
-			{
-				if (tmpFilename[i] == DIR_DELIMITER)
-					break;
-			}
+	fixString(s->name, 21); // remove leading spaces from sample filename
+	return true;
+}
 
-			char *tmpPtr = tmpFilename;
-			if (i > 0)
-				tmpPtr += i+1;
+// puts a loaded sample into a slot, mixer callback must be locked
+static void putLoadedSample(sample_t *src, int16_t insNum, int16_t smpNum)
+{
+	sample_t *s = &instr[insNum]->smp[smpNum];
 
-			sanitizeFilename(tmpPtr);
+	freeSample(insNum, smpNum);
+	memcpy(s, src, sizeof (sample_t));
 
-			int32_t filenameLen = (int32_t)strlen(tmpPtr);
-			for (i = 0; i < 22; i++)
-			{
-				if (i < filenameLen)
-					tmpSmp.name[i] = tmpPtr[i];
-				else
-					tmpSmp.name[i] = '\0';
-			}
+	sanitizeSample(s);
 
-			free(tmpFilename);
-		}
+	fixSample(s); // prepares sample for branchless resampling interpolation
+	fixInstrAndSampleNames(insNum);
+}
+
+static int32_t SDLCALL loadSampleThread(void *ptr)
+{
+	if (editor.tmpFilenameU == NULL)
+	{
+		loaderMsgBox("General I/O error during loading!");
+		goto loadError;
 	}
 
-	fixString(tmpSmp.name, 21); // remove leading spaces from sample filename
+	if (!loadSampleFile(editor.tmpFilenameU, &tmpSmp))
+		goto loadError;
+
+	// sample loaded successfully!
 
 	lockMixerCallback();
 	if (loadAsInstrFlag) // if loaded in instrument mode
@@ -187,19 +233,12 @@ static int32_t SDLCALL loadSampleThread(void *ptr)
 
 	if (instr[editor.curInstr] == NULL)
 	{
+		unlockMixerCallback();
 		loaderMsgBox("Not enough memory!");
 		goto loadError;
 	}
 
-	sample_t *s = &instr[editor.curInstr]->smp[sampleSlot];
-
-	freeSample(editor.curInstr, sampleSlot);
-	memcpy(s, &tmpSmp, sizeof (sample_t));
-
-	sanitizeSample(s);
-
-	fixSample(s); // prepares sample for branchless resampling interpolation
-	fixInstrAndSampleNames(editor.curInstr);
+	putLoadedSample(&tmpSmp, editor.curInstr, sampleSlot);
 
 	unlockMixerCallback();
 
@@ -212,21 +251,32 @@ static int32_t SDLCALL loadSampleThread(void *ptr)
 
 loadError:
 	setMouseBusy(false);
-	freeTmpSample(&tmpSmp);
+	freeSmpData(&tmpSmp);
 	sampleIsLoading = false;
 	return false;
 
 	(void)ptr;
 }
 
-static void freeTmpSample(sample_t *s)
+void removeSampleIsLoadingFlag(void)
 {
-	freeSmpData(s);
+	sampleIsLoading = false;
 }
 
-void removeSampleIsLoadingFlag(void)
+int16_t askStereoSampleLoadMode(void)
 {
-	sampleIsLoading = false;
+	smpImportJob_t *job = importJob;
+	if (job == NULL)
+		return loaderSysReq(4, "System request", "This is a stereo sample...", NULL);
+
+	// batch import: ask on the first stereo file only, the answer goes for the rest too
+	SDL_LockMutex(job->mutex);
+	if (job->batchStereoMode == -1)
+		job->batchStereoMode = loaderSysReq(4, "System request", "Stereo samples found (applies to all files)...", NULL);
+	const int16_t stereoMode = job->batchStereoMode;
+	SDL_UnlockMutex(job->mutex);
+
+	return stereoMode;
 }
 
 bool loadSample(UNICHAR *filenameU, uint8_t smpNr, bool instrFlag)
@@ -247,7 +297,6 @@ bool loadSample(UNICHAR *filenameU, uint8_t smpNr, bool instrFlag)
 	sampleSlot = smpNr;
 	loadAsInstrFlag = instrFlag;
 	sampleIsLoading = true;
-	smpFilenameSet = false;
 
 	memset(&tmpSmp, 0, sizeof (tmpSmp));
 	UNICHAR_STRCPY(editor.tmpFilenameU, filenameU);
@@ -265,62 +314,734 @@ bool loadSample(UNICHAR *filenameU, uint8_t smpNr, bool instrFlag)
 	return true;
 }
 
-void normalizeSigned32Bit(int32_t *sampleData, uint32_t sampleLength)
+// the workers' loader errors are collected for the summary instead, one box per file would be too much
+static void importLoaderMsgBox(const char *fmt, ...)
+{
+	char strBuf[256];
+	va_list args;
+
+	smpImportJob_t *job = importJob;
+	if (job == NULL)
+		return;
+
+	va_start(args, fmt);
+	vsnprintf(strBuf, sizeof (strBuf), fmt, args);
+	va_end(args);
+
+	const char *msg = strBuf;
+	if (!strncmp(msg, "Error loading sample: ", 22))
+		msg += 22;
+
+	SDL_LockMutex(job->mutex);
+	if (strstr(job->loaderMessages, msg) == NULL) // every error only once
+	{
+		const size_t len = strlen(job->loaderMessages);
+		snprintf(&job->loaderMessages[len], sizeof (job->loaderMessages) - len, "%s%s", (len > 0) ? " " : "", msg);
+	}
+	SDL_UnlockMutex(job->mutex);
+}
+
+static void freeImportJob(smpImportJob_t *job)
+{
+	for (int32_t i = 0; i < job->numFiles; i++)
+	{
+		if (job->filesU[i] != NULL)
+			free(job->filesU[i]);
+
+		freeSmpData(&job->smp[i]);
+	}
+
+	if (job->mutex != NULL)
+		SDL_DestroyMutex(job->mutex);
+
+	free(job->filesU);
+	free(job->smp);
+	free(job->loaded);
+	free(job);
+}
+
+static int32_t SDLCALL importWorkerThread(void *ptr)
+{
+	smpImportJob_t *job = (smpImportJob_t *)ptr;
+
+	while (true)
+	{
+		const int32_t i = SDL_AtomicAdd(&job->nextFile, 1);
+		if (i >= job->numFiles)
+			break;
+
+		job->loaded[i] = loadSampleFile(job->filesU[i], &job->smp[i]);
+	}
+
+	return true;
+}
+
+static int32_t SDLCALL importSamplesThread(void *ptr)
+{
+	smpImportJob_t *job = (smpImportJob_t *)ptr;
+	int32_t i;
+
+	// decode all files on a worker pool, this thread takes part as well
+	int32_t numThreads = CLAMP(SDL_GetCPUCount(), 1, MAX_IMPORT_THREADS) - 1;
+	if (numThreads > job->numFiles-1)
+		numThreads = job->numFiles-1;
+
+	SDL_Thread *workers[MAX_IMPORT_THREADS];
+	int32_t workersStarted = 0;
+	for (i = 0; i < numThreads; i++)
+	{
+		workers[workersStarted] = SDL_CreateThread(importWorkerThread, NULL, job);
+		if (workers[workersStarted] != NULL)
+			workersStarted++;
+	}
+
+	importWorkerThread(job);
+
+	for (i = 0; i < workersStarted; i++)
+		SDL_WaitThread(workers[i], NULL);
+
+	// commit the loaded files to consecutive slots (failed files leave no gaps)
+	int32_t numLoaded = 0, lastLoaded = -1;
+	bool outOfMemory = false;
+
+	lockMixerCallback();
+	for (i = 0; i < job->numFiles; i++)
+	{
+		if (!job->loaded[i])
+			continue;
+
+		int16_t insNum, smpNum;
+		if (job->toInstruments)
+		{
+			insNum = job->firstInstr + (int16_t)numLoaded;
+			smpNum = 0;
+
+			freeInstr(insNum);
+		}
+		else
+		{
+			insNum = job->firstInstr;
+			smpNum = job->firstSmp + (int16_t)numLoaded;
+		}
+
+		if (instr[insNum] == NULL)
+			allocateInstr(insNum);
+
+		if (instr[insNum] == NULL)
+		{
+			outOfMemory = true;
+			break;
+		}
+
+		if (job->toInstruments)
+		{
+			memcpy(song.instrName[insNum], job->smp[i].name, 22);
+			song.instrName[insNum][22] = '\0';
+		}
+
+		putLoadedSample(&job->smp[i], insNum, smpNum);
+		memset(&job->smp[i], 0, sizeof (sample_t)); // now owned by the instrument
+
+		lastLoaded = i;
+		numLoaded++;
+	}
+	unlockMixerCallback();
+
+	if (lastLoaded >= 0)
+	{
+		UNICHAR_STRCPY(editor.tmpFilenameU, job->filesU[lastLoaded]);
+		setSongModifiedFlag();
+	}
+
+	char loaderMessages[sizeof (job->loaderMessages)];
+
+	const int32_t numFiles = job->numFiles;
+	const int32_t numFailed = job->numFiles - numLoaded;
+	const int32_t numSkipped = job->numFilesDropped - job->numFiles;
+	strcpy(loaderMessages, job->loaderMessages);
+
+	loaderMsgBox = job->oldLoaderMsgBox;
+	loaderSysReq = job->oldLoaderSysReq;
+
+	importJob = NULL;
+	freeImportJob(job);
+
+	if (outOfMemory)
+		myLoaderMsgBoxThreadSafe("Not enough memory! Only %d sample(s) were imported.", numLoaded);
+	else if (numFailed > 0 && loaderMessages[0] != '\0')
+		myLoaderMsgBoxThreadSafe("%d of %d file(s) couldn't be loaded: %s", numFailed, numFiles, loaderMessages);
+	else if (numFailed > 0)
+		myLoaderMsgBoxThreadSafe("%d of %d file(s) couldn't be loaded as samples!", numFailed, numFiles);
+	else if (numSkipped > 0)
+		myLoaderMsgBoxThreadSafe("Ran past the last slot, the last %d file(s) were not imported!", numSkipped);
+	else if (loaderMessages[0] != '\0')
+		myLoaderMsgBoxThreadSafe("%s", loaderMessages);
+
+	// when caught in main/video thread, it disables busy mouse and sets sampleIsLoading to true
+	editor.updateCurSmp = true;
+
+	return true;
+}
+
+bool loadSamples(UNICHAR **filenamesU, int32_t numFiles, bool toInstruments)
+{
+	if (sampleIsLoading || filenamesU == NULL || numFiles <= 0)
+		return false;
+
+	if (editor.curInstr == 0)
+	{
+		okBox(0, "System message", "The zero-instrument cannot hold instrument data!", NULL);
+		return false;
+	}
+
+	smpImportJob_t *job = (smpImportJob_t *)calloc(1, sizeof (smpImportJob_t));
+	if (job == NULL)
+	{
+		okBox(0, "System message", "Not enough memory!", NULL);
+		return false;
+	}
+
+	job->toInstruments = toInstruments;
+	job->firstInstr = editor.curInstr;
+	job->firstSmp = toInstruments ? 0 : editor.curSmp;
+	job->batchStereoMode = -1;
+	job->numFilesDropped = numFiles;
+
+	// there is no point in loading files that won't fit (used slots are overwritten, like with single loads)
+	const int32_t slotsLeft = toInstruments ? ((MAX_INST+1) - job->firstInstr) : (MAX_SMP_PER_INST - job->firstSmp);
+	if (numFiles > slotsLeft)
+		numFiles = slotsLeft;
+
+	job->filesU = (UNICHAR **)calloc(numFiles, sizeof (UNICHAR *));
+	job->smp = (sample_t *)calloc(numFiles, sizeof (sample_t));
+	job->loaded = (bool *)calloc(numFiles, sizeof (bool));
+	job->mutex = SDL_CreateMutex();
+
+	if (job->filesU == NULL || job->smp == NULL || job->loaded == NULL || job->mutex == NULL)
+	{
+		freeImportJob(job);
+		okBox(0, "System message", "Not enough memory!", NULL);
+		return false;
+	}
+	job->numFiles = numFiles;
+
+	for (int32_t i = 0; i < numFiles; i++)
+	{
+		job->filesU[i] = (UNICHAR *)malloc((UNICHAR_STRLEN(filenamesU[i]) + 1) * sizeof (UNICHAR));
+		if (job->filesU[i] == NULL)
+		{
+			freeImportJob(job);
+			okBox(0, "System message", "Not enough memory!", NULL);
+			return false;
+		}
+
+		UNICHAR_STRCPY(job->filesU[i], filenamesU[i]);
+	}
+
+	job->oldLoaderMsgBox = loaderMsgBox;
+	job->oldLoaderSysReq = loaderSysReq;
+
+	loaderMsgBox = importLoaderMsgBox;
+	loaderSysReq = okBoxThreadSafe;
+
+	sampleIsLoading = true;
+	importJob = job;
+
+	mouseAnimOn();
+	thread = SDL_CreateThread(importSamplesThread, NULL, job);
+	if (thread == NULL)
+	{
+		loaderMsgBox = job->oldLoaderMsgBox;
+		loaderSysReq = job->oldLoaderSysReq;
+
+		importJob = NULL;
+		freeImportJob(job);
+		sampleIsLoading = false;
+		mouseAnimOff();
+		okBox(0, "System message", "Couldn't create thread!", NULL);
+		return false;
+	}
+
+	SDL_DetachThread(thread);
+	return true;
+}
+
+/* Streaming PCM decoder shared by the WAV, AIFF and RAW loaders.
+**
+** The sample data is read in fixed-size chunks, and each chunk is downmixed
+** and converted straight into the final 8-bit/16-bit sample. Formats wider
+** than 16-bit are always normalized, which needs the peak first, so for those
+** the data is read twice (peak scan, then convert). Peak memory use is the
+** final sample plus one chunk, instead of the whole file in its source format.
+**
+** The kernels below are plain loops over the chunk, written so that the
+** compiler can vectorize them.
+*/
+
+static const uint8_t pcmSampleBytes[PCM_FORMAT_DOUBLE+1] = { 1, 1, 2, 3, 4, 4, 8 };
+
+static void swapChunkEndianness(uint8_t *buf, uint32_t numSamples, uint8_t sampleBytes)
 {
 	uint32_t i;
 
-	uint32_t sampleVolPeak = 0;
-	for (i = 0; i < sampleLength; i++)
+	if (sampleBytes == 2)
 	{
-		const uint32_t sample = ABS(sampleData[i]);
-		if (sampleVolPeak < sample)
-			sampleVolPeak = sample;
+		uint16_t *ptr16 = (uint16_t *)buf;
+		for (i = 0; i < numSamples; i++)
+			ptr16[i] = SWAP16(ptr16[i]);
 	}
+	else if (sampleBytes == 4)
+	{
+		uint32_t *ptr32 = (uint32_t *)buf;
+		for (i = 0; i < numSamples; i++)
+			ptr32[i] = SWAP32(ptr32[i]);
+	}
+	else if (sampleBytes == 8)
+	{
+		uint64_t *ptr64 = (uint64_t *)buf;
+		for (i = 0; i < numSamples; i++)
+			ptr64[i] = SWAP64(ptr64[i]);
+	}
+}
 
-	if (sampleVolPeak <= 0)
-		return;
+// integer formats -> signed 32-bit (8/16-bit keep their range, 24/32-bit are MSB aligned)
+static void decodeChunkToS32(const uint8_t *src, int32_t *dst, uint32_t numSamples, int8_t format, bool bigEndian)
+{
+	uint32_t i;
+
+	switch (format)
+	{
+		case PCM_FORMAT_U8:
+		{
+			for (i = 0; i < numSamples; i++)
+				dst[i] = src[i] - 128;
+		}
+		break;
+
+		case PCM_FORMAT_S8:
+		{
+			const int8_t *ptr8 = (const int8_t *)src;
+			for (i = 0; i < numSamples; i++)
+				dst[i] = ptr8[i];
+		}
+		break;
+
+		case PCM_FORMAT_S16:
+		{
+			const int16_t *ptr16 = (const int16_t *)src;
+			for (i = 0; i < numSamples; i++)
+				dst[i] = ptr16[i];
+		}
+		break;
+
+		case PCM_FORMAT_S24:
+		{
+			if (bigEndian)
+			{
+				for (i = 0; i < numSamples; i++, src += 3)
+					dst[i] = (int32_t)(((uint32_t)src[0] << 24) | (src[1] << 16) | (src[2] << 8));
+			}
+			else
+			{
+				for (i = 0; i < numSamples; i++, src += 3)
+					dst[i] = (int32_t)(((uint32_t)src[2] << 24) | (src[1] << 16) | (src[0] << 8));
+			}
+		}
+		break;
+
+		case PCM_FORMAT_S32:
+		{
+			const int32_t *ptr32 = (const int32_t *)src;
+			for (i = 0; i < numSamples; i++)
+				dst[i] = ptr32[i];
+		}
+		break;
 
-	const double dGain = (double)INT32_MAX / sampleVolPeak;
-	for (i = 0; i < sampleLength; i++)
-		sampleData[i] = (int32_t)(sampleData[i] * dGain);
+		default: break;
+	}
 }
 
-void normalize32BitFloatToSigned16Bit(float *fSampleData, uint32_t sampleLength)
+// downmixes a stereo chunk in place (output frame i never overtakes input frame i)
+static void stereoToMonoS32(int32_t *buf, uint32_t numFrames, int16_t stereoMode)
 {
 	uint32_t i;
 
-	float fSampleVolPeak = 0.0f;
-	for (i = 0; i < sampleLength; i++)
+	if (stereoMode == STEREO_SAMPLE_READ_LEFT)
 	{
-		const float fSample = fabsf(fSampleData[i]);
-		if (fSampleVolPeak < fSample)
-			fSampleVolPeak = fSample;
+		for (i = 0; i < numFrames; i++)
+			buf[i] = buf[(i * 2) + 0];
 	}
+	else if (stereoMode == STEREO_SAMPLE_READ_RIGHT)
+	{
+		for (i = 0; i < numFrames; i++)
+			buf[i] = buf[(i * 2) + 1];
+	}
+	else
+	{
+		for (i = 0; i < numFrames; i++)
+			buf[i] = (int32_t)(((int64_t)buf[(i * 2) + 0] + buf[(i * 2) + 1]) >> 1);
+	}
+}
 
-	if (fSampleVolPeak <= 0.0f)
-		return;
+static void stereoToMonoFloat(float *fBuf, uint32_t numFrames, int16_t stereoMode)
+{
+	uint32_t i;
 
-	const float fGain = (float)INT16_MAX / fSampleVolPeak;
-	for (i = 0; i < sampleLength; i++)
-		fSampleData[i] *= fGain;
+	if (stereoMode == STEREO_SAMPLE_READ_LEFT)
+	{
+		for (i = 0; i < numFrames; i++)
+			fBuf[i] = fBuf[(i * 2) + 0];
+	}
+	else if (stereoMode == STEREO_SAMPLE_READ_RIGHT)
+	{
+		for (i = 0; i < numFrames; i++)
+			fBuf[i] = fBuf[(i * 2) + 1];
+	}
+	else
+	{
+		for (i = 0; i < numFrames; i++)
+			fBuf[i] = (fBuf[(i * 2) + 0] + fBuf[(i * 2) + 1]) * 0.5f;
+	}
 }
 
-void normalize64BitFloatToSigned16Bit(double *dSampleData, uint32_t sampleLength)
+static void stereoToMonoDouble(double *dBuf, uint32_t numFrames, int16_t stereoMode)
 {
 	uint32_t i;
 
-	double dSampleVolPeak = 0.0;
-	for (i = 0; i < sampleLength; i++)
+	if (stereoMode == STEREO_SAMPLE_READ_LEFT)
+	{
+		for (i = 0; i < numFrames; i++)
+			dBuf[i] = dBuf[(i * 2) + 0];
+	}
+	else if (stereoMode == STEREO_SAMPLE_READ_RIGHT)
+	{
+		for (i = 0; i < numFrames; i++)
+			dBuf[i] = dBuf[(i * 2) + 1];
+	}
+	else
 	{
-		const double dSample = fabs(dSampleData[i]);
-		if (dSampleVolPeak < dSample)
-			dSampleVolPeak = dSample;
+		for (i = 0; i < numFrames; i++)
+			dBuf[i] = (dBuf[(i * 2) + 0] + dBuf[(i * 2) + 1]) * 0.5;
 	}
+}
 
-	if (dSampleVolPeak <= 0.0)
-		return;
+/* Reads up to numFrames (<= PCM_CHUNK_FRAMES) and leaves them as mono in
+** ps->s32Buf (integer formats) or ps->readBuf (float/double).
+** Returns the number of whole frames read.
+*/
+static uint32_t readMonoChunk(pcmStream_t *ps, uint32_t numFrames)
+{
+	const uint8_t sampleBytes = pcmSampleBytes[ps->format];
+
+	numFrames = (uint32_t)fread(ps->readBuf, sampleBytes, numFrames * ps->numChannels, ps->f) / ps->numChannels;
+	if (numFrames == 0)
+		return 0;
+
+	const uint32_t numSamples = numFrames * ps->numChannels;
+
+	if (ps->bigEndian && ps->format != PCM_FORMAT_S24)
+		swapChunkEndianness(ps->readBuf, numSamples, sampleBytes);
+
+	if (ps->format == PCM_FORMAT_FLOAT)
+	{
+		if (ps->numChannels == 2)
+			stereoToMonoFloat((float *)ps->readBuf, numFrames, ps->stereoMode);
+	}
+	else if (ps->format == PCM_FORMAT_DOUBLE)
+	{
+		if (ps->numChannels == 2)
+			stereoToMonoDouble((double *)ps->readBuf, numFrames, ps->stereoMode);
+	}
+	else
+	{
+		decodeChunkToS32(ps->readBuf, ps->s32Buf, numSamples, ps->format, ps->bigEndian);
+		if (ps->numChannels == 2)
+			stereoToMonoS32(ps->s32Buf, numFrames, ps->stereoMode);
+	}
+
+	return numFrames;
+}
+
+static double getChunkPeak(pcmStream_t *ps, uint32_t numFrames)
+{
+	uint32_t i;
+
+	if (ps->format == PCM_FORMAT_FLOAT)
+	{
+		const float *fBuf = (const float *)ps->readBuf;
+
+		float fPeak = 0.0f;
+		for (i = 0; i < numFrames; i++)
+		{
+			const float fSample = fabsf(fBuf[i]);
+			if (fPeak < fSample)
+				fPeak = fSample;
+		}
 
-	const double dGain = (double)INT16_MAX / dSampleVolPeak;
-	for (i = 0; i < sampleLength; i++)
-		dSampleData[i] *= dGain;
+		return fPeak;
+	}
+	else if (ps->format == PCM_FORMAT_DOUBLE)
+	{
+		const double *dBuf = (const double *)ps->readBuf;
+
+		double dPeak = 0.0;
+		for (i = 0; i < numFrames; i++)
+		{
+			const double dSample = fabs(dBuf[i]);
+			if (dPeak < dSample)
+				dPeak = dSample;
+		}
+
+		return dPeak;
+	}
+	else
+	{
+		uint32_t peak = 0;
+		for (i = 0; i < numFrames; i++)
+		{
+			const int32_t sample = ps->s32Buf[i];
+			const uint32_t sampleAbs = (sample < 0) ? 0U - (uint32_t)sample : (uint32_t)sample;
+			if (peak < sampleAbs)
+				peak = sampleAbs;
+		}
+
+		return peak;
+	}
+}
+
+static void storeChunk(pcmStream_t *ps, int8_t *dst8, int16_t *dst16, uint32_t numFrames, double dPeak)
+{
+	uint32_t i;
+
+	switch (ps->format)
+	{
+		case PCM_FORMAT_U8:
+		case PCM_FORMAT_S8:
+		{
+			for (i = 0; i < numFrames; i++)
+				dst8[i] = (int8_t)ps->s32Buf[i];
+		}
+		break;
+
+		case PCM_FORMAT_S16:
+		{
+			for (i = 0; i < numFrames; i++)
+				dst16[i] = (int16_t)ps->s32Buf[i];
+		}
+		break;
+
+		case PCM_FORMAT_S24:
+		case PCM_FORMAT_S32:
+		{
+			if (dPeak <= 0.0)
+			{
+				for (i = 0; i < numFrames; i++)
+					dst16[i] = (int16_t)(ps->s32Buf[i] >> 16);
+			}
+			else
+			{
+				const double dGain = (double)INT32_MAX / dPeak;
+				for (i = 0; i < numFrames; i++)
+					dst16[i] = (int16_t)((int32_t)(ps->s32Buf[i] * dGain) >> 16);
+			}
+		}
+		break;
+
+		case PCM_FORMAT_FLOAT:
+		{
+			const float *fBuf = (const float *)ps->readBuf;
+			const float fGain = (dPeak <= 0.0) ? 1.0f : (float)INT16_MAX / (float)dPeak;
+
+			for (i = 0; i < numFrames; i++)
+				dst16[i] = (int16_t)(int32_t)(fBuf[i] * fGain);
+		}
+		break;
+
+		case PCM_FORMAT_DOUBLE:
+		{
+			const double *dBuf = (const double *)ps->readBuf;
+			const double dGain = (dPeak <= 0.0) ? 1.0 : (double)INT16_MAX / dPeak;
+
+			for (i = 0; i < numFrames; i++)
+				dst16[i] = (int16_t)(int32_t)(dBuf[i] * dGain);
+		}
+		break;
+
+		default: break;
+	}
+}
+
+bool openPCMStream(pcmStream_t *ps, FILE *f, int8_t format, bool bigEndian, uint8_t numChannels, int16_t stereoMode)
+{
+	ps->f = f;
+	ps->format = format;
+	ps->bigEndian = bigEndian;
+	ps->numChannels = numChannels;
+	ps->stereoMode = stereoMode;
+
+	// raw chunk + 32-bit work area (only used by integer formats)
+	const uint32_t readBufBytes = PCM_CHUNK_FRAMES * numChannels * pcmSampleBytes[format];
+	ps->readBuf = (uint8_t *)malloc(readBufBytes + (PCM_CHUNK_FRAMES * numChannels * sizeof (int32_t)));
+	if (ps->readBuf == NULL)
+		return false;
+
+	ps->s32Buf = (int32_t *)&ps->readBuf[readBufBytes];
+	return true;
+}
+
+void closePCMStream(pcmStream_t *ps)
+{
+	if (ps->readBuf != NULL)
+	{
+		free(ps->readBuf);
+		ps->readBuf = NULL;
+	}
+}
+
+uint32_t readPCMStreamFloat(pcmStream_t *ps, float *fDst, uint32_t numFrames)
+{
+	uint32_t i;
+
+	numFrames = readMonoChunk(ps, numFrames);
+	switch (ps->format)
+	{
+		case PCM_FORMAT_U8:
+		case PCM_FORMAT_S8:
+		{
+			for (i = 0; i < numFrames; i++)
+				fDst[i] = ps->s32Buf[i] * (1.0f / 128.0f);
+		}
+		break;
+
+		case PCM_FORMAT_S16:
+		{
+			for (i = 0; i < numFrames; i++)
+				fDst[i] = ps->s32Buf[i] * (1.0f / 32768.0f);
+		}
+		break;
+
+		case PCM_FORMAT_S24:
+		case PCM_FORMAT_S32:
+		{
+			for (i = 0; i < numFrames; i++)
+				fDst[i] = (float)(ps->s32Buf[i] * (1.0 / 2147483648.0));
+		}
+		break;
+
+		case PCM_FORMAT_FLOAT:
+		{
+			memcpy(fDst, ps->readBuf, numFrames * sizeof (float));
+		}
+		break;
+
+		case PCM_FORMAT_DOUBLE:
+		{
+			const double *dBuf = (const double *)ps->readBuf;
+			for (i = 0; i < numFrames; i++)
+				fDst[i] = (float)dBuf[i];
+		}
+		break;
+
+		default: break;
+	}
+
+	return numFrames;
+}
+
+bool loadPCMSampleData(FILE *f, sample_t *s, uint32_t numFrames, int8_t format, bool bigEndian, uint8_t numChannels, int16_t stereoMode)
+{
+	uint32_t pos, framesLeft;
+
+	if (numFrames == 0)
+	{
+		loaderMsgBox("Error loading sample: The sample is not supported or is invalid!");
+		return false;
+	}
+
+	if (numFrames > MAX_SAMPLE_LEN)
+		numFrames = MAX_SAMPLE_LEN;
+
+	const bool sample16Bit = (format != PCM_FORMAT_U8 && format != PCM_FORMAT_S8);
+	const bool normalize = (format >= PCM_FORMAT_S24);
+
+	pcmStream_t ps;
+	if (!openPCMStream(&ps, f, format, bigEndian, numChannels, stereoMode))
+	{
+		loaderMsgBox("Not enough memory!");
+		return false;
+	}
+
+	if (!allocateSmpData(s, numFrames, sample16Bit))
+	{
+		closePCMStream(&ps);
+		loaderMsgBox("Not enough memory!");
+		return false;
+	}
+
+	if (sample16Bit)
+		s->flags |= SAMPLE_16BIT;
+
+	/* When reading the right channel or mixing to mono, the last frame
+	** has always been silenced. Keep doing that, and leave it out of the
+	** peak scan as well.
+	*/
+	const bool silenceLastFrame = (numChannels == 2 && stereoMode != STEREO_SAMPLE_READ_LEFT);
+	const uint32_t framesToDecode = silenceLastFrame ? (numFrames - 1) : numFrames;
+
+	double dPeak = 0.0;
+	if (normalize)
+	{
+		const long dataPos = ftell(f);
+
+		framesLeft = framesToDecode;
+		while (framesLeft > 0)
+		{
+			const uint32_t chunkFrames = (framesLeft > PCM_CHUNK_FRAMES) ? PCM_CHUNK_FRAMES : framesLeft;
+			if (readMonoChunk(&ps, chunkFrames) != chunkFrames)
+				goto ioError;
+
+			const double dChunkPeak = getChunkPeak(&ps, chunkFrames);
+			if (dPeak < dChunkPeak)
+				dPeak = dChunkPeak;
+
+			framesLeft -= chunkFrames;
+		}
+
+		fseek(f, dataPos, SEEK_SET);
+	}
+
+	int8_t *dst8 = s->dataPtr;
+	int16_t *dst16 = (int16_t *)s->dataPtr;
+
+	pos = 0;
+	framesLeft = framesToDecode;
+	while (framesLeft > 0)
+	{
+		const uint32_t chunkFrames = (framesLeft > PCM_CHUNK_FRAMES) ? PCM_CHUNK_FRAMES : framesLeft;
+		if (readMonoChunk(&ps, chunkFrames) != chunkFrames)
+			goto ioError;
+
+		storeChunk(&ps, &dst8[pos], &dst16[pos], chunkFrames, dPeak);
+
+		pos += chunkFrames;
+		framesLeft -= chunkFrames;
+	}
+
+	if (silenceLastFrame)
+	{
+		if (sample16Bit)
+			dst16[pos] = 0;
+		else
+			dst8[pos] = 0;
+	}
+
+	closePCMStream(&ps);
+
+	s->length = numFrames;
+	return true;
+
+ioError:
+	closePCMStream(&ps);
+	loaderMsgBox("General I/O error during loading! Is the file in use?");
+	return false;
 }
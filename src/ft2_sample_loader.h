@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include "ft2_header.h"
 #include "ft2_unicode.h"
 
@@ -12,19 +13,58 @@ enum
 	STEREO_SAMPLE_CONVERT = 3,
 };
 
-void normalizeSigned32Bit(int32_t *sampleData, uint32_t sampleLength);
-void normalize32BitFloatToSigned16Bit(float *fSampleData, uint32_t sampleLength);
-void normalize64BitFloatToSigned16Bit(double *dSampleData, uint32_t sampleLength);
+// source formats for loadPCMSampleData()
+enum
+{
+	PCM_FORMAT_U8 = 0,
+	PCM_FORMAT_S8 = 1,
+	PCM_FORMAT_S16 = 2,
+	PCM_FORMAT_S24 = 3,
+	PCM_FORMAT_S32 = 4,
+	PCM_FORMAT_FLOAT = 5,
+	PCM_FORMAT_DOUBLE = 6
+};
+
+/* Reads numFrames of interleaved PCM data from the current file position into
+** a newly allocated s->dataPtr as mono 8-bit (U8/S8) or 16-bit (everything else),
+** downmixing stereo by stereoMode. Formats above 16-bit are normalized.
+** Sets s->length and SAMPLE_16BIT. Shows its own error message on failure.
+*/
+bool loadPCMSampleData(FILE *f, sample_t *s, uint32_t numFrames, int8_t format, bool bigEndian, uint8_t numChannels, int16_t stereoMode);
+
+// chunked PCM reader (also used by the Disk Op. sample preview)
+#define PCM_CHUNK_FRAMES 8192
+
+typedef struct pcmStream_t
+{
+	FILE *f;
+	int8_t format;
+	bool bigEndian;
+	uint8_t numChannels;
+	int16_t stereoMode;
+	uint8_t *readBuf;
+	int32_t *s32Buf;
+} pcmStream_t;
+
+bool openPCMStream(pcmStream_t *ps, FILE *f, int8_t format, bool bigEndian, uint8_t numChannels, int16_t stereoMode);
+void closePCMStream(pcmStream_t *ps);
+
+// reads up to numFrames (max PCM_CHUNK_FRAMES) as mono -1..1 floats (not normalized), returns frames read
+uint32_t readPCMStreamFloat(pcmStream_t *ps, float *fDst, uint32_t numFrames);
 
 bool loadSample(UNICHAR *filenameU, uint8_t sampleSlot, bool loadAsInstrFlag);
+
+/* Batch import: loads the files concurrently, then puts them into consecutive
+** samples of the current instrument (from the current sample), or into sample 0
+** of consecutive instruments (from the current one). Used slots are overwritten.
+** Files that fail to load leave no gaps, and files past the last slot are skipped.
+*/
+bool loadSamples(UNICHAR **filenamesU, int32_t numFiles, bool toInstruments);
+
 void removeSampleIsLoadingFlag(void);
 
-// globals for sample loaders
-extern bool loadAsInstrFlag, smpFilenameSet;
-extern char *smpFilename;
-extern uint8_t sampleSlot;
-extern sample_t tmpSmp;
-// --------------------------
+// for the format loaders. Asks once per batch import.
+int16_t askStereoSampleLoadMode(void);
 
 // file extensions accepted by Disk Op. in sample mode
 extern char *supportedSmpExtensions[];
@@ -160,7 +160,7 @@ static bool saveRawSample(UNICHAR *filenameU, bool saveRangedData)
 	if (loopEnabled && smp->length > smp->loopStart+smp->loopLength)
 		fileRestoreFixedSampleData(filenameU, 0, smp);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 
 	setMouseBusy(false);
 	return true;
@@ -312,7 +312,7 @@ static bool saveIFFSample(UNICHAR *filenameU, bool saveRangedData)
 	if (loopEnabled && smp->length > smp->loopStart+smp->loopLength)
 		fileRestoreFixedSampleData(filenameU, sampleDataPos, smp);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 
 	setMouseBusy(false);
 	return true;
@@ -492,7 +492,7 @@ static bool saveWAVSample(UNICHAR *filenameU, bool saveRangedData)
 	if (loopEnabled && smp->length > smp->loopStart+smp->loopLength)
 		fileRestoreFixedSampleData(filenameU, sampleDataPos, smp);
 
-	editor.diskOpReadDir = true; // force diskop re-read
+	diskOp_DirContentsChanged(); // update Disk Op. file list
 
 	setMouseBusy(false);
 	return true;
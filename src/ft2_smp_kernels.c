@@ -0,0 +1,736 @@
+/* Sample editor kernels
+**
+** Gain ramp, peak scan, DC removal, reverse, sign flip, byte swap, mix and
+** bit-depth conversion. Every kernel works on a [start, end) range, so that
+** long samples can be cut into chunks that the worker threads pick from a
+** shared counter (same scheme as the XM pattern packer).
+*/
+
+// for finding memory leaks in debug mode with Visual Studio
+#if defined _DEBUG && defined _MSC_VER
+#include <crtdbg.h>
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "ft2_header.h"
+#include "ft2_structs.h"
+#include "ft2_smp_kernels.h"
+
+#if defined _WIN32 || defined __amd64__ || (defined __i386__ && defined __SSE2__)
+#include <emmintrin.h>
+#define KERNELS_SSE2
+#endif
+
+#define KERNEL_MAX_THREADS 16
+#define KERNEL_CHUNK_LEN (1 << 18) // samples per work unit
+#define GAIN_BLOCK_LEN 4096 // the ramp gain is recalculated in double precision per block (no float drift)
+#define SUM16_BLOCK_LEN (8 * 16384) // int32 lanes of _mm_madd_epi16() can't overflow within this many samples
+
+typedef struct kernelJob_t kernelJob_t;
+typedef void (*kernelFunc_t)(kernelJob_t *job, int32_t start, int32_t end);
+
+struct kernelJob_t
+{
+	kernelFunc_t func;
+	int32_t length;
+	SDL_atomic_t nextChunk;
+	SDL_SpinLock resultLock;
+
+	int8_t *dst;
+	const int8_t *src1, *src2;
+	bool dst16Bit, src1_16Bit, src2_16Bit;
+	int32_t src1Length, src2Length, smpSub;
+	double dGain1, dGain2; // gain ramp: start gain and gain delta per sample. Mix: source gains
+
+	// results, merged under resultLock
+	int64_t sum;
+	int32_t peak;
+};
+
+static inline int32_t loadSmp(const int8_t *p, int32_t i, bool sample16Bit)
+{
+	return sample16Bit ? ((const int16_t *)p)[i] : p[i];
+}
+
+static inline void storeSmp(int8_t *p, int32_t i, int32_t smp32, bool sample16Bit)
+{
+	if (sample16Bit)
+	{
+		CLAMP16(smp32);
+		((int16_t *)p)[i] = (int16_t)smp32;
+	}
+	else
+	{
+		CLAMP8(smp32);
+		p[i] = (int8_t)smp32;
+	}
+}
+
+#ifdef KERNELS_SSE2
+// loads four 8-bit or 16-bit samples as floats
+static inline __m128 load4(const int8_t *p, int32_t i, bool sample16Bit)
+{
+	__m128i v;
+
+	if (sample16Bit)
+	{
+		v = _mm_loadl_epi64((const __m128i *)&p[i << 1]);
+		v = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+	}
+	else
+	{
+		int32_t tmp;
+		memcpy(&tmp, &p[i], 4);
+
+		v = _mm_cvtsi32_si128(tmp);
+		v = _mm_unpacklo_epi8(v, v);
+		v = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 24);
+	}
+
+	return _mm_cvtepi32_ps(v);
+}
+
+// stores four int32 values as 8-bit or 16-bit samples, the packing instructions do the clamping
+static inline void store4(int8_t *p, int32_t i, __m128i v, bool sample16Bit)
+{
+	v = _mm_packs_epi32(v, v);
+	if (sample16Bit)
+	{
+		_mm_storel_epi64((__m128i *)&p[i << 1], v);
+	}
+	else
+	{
+		const int32_t tmp = _mm_cvtsi128_si32(_mm_packs_epi16(v, v));
+		memcpy(&p[i], &tmp, 4);
+	}
+}
+
+static inline __m128i reverseWords(__m128i v)
+{
+	v = _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+	v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+	return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+static inline __m128i swapBytes(__m128i v)
+{
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+static void mergeResults(kernelJob_t *job, int64_t sum, int32_t peak)
+{
+	SDL_AtomicLock(&job->resultLock);
+	job->sum += sum;
+	if (peak > job->peak)
+		job->peak = peak;
+	SDL_AtomicUnlock(&job->resultLock);
+}
+
+static int32_t SDLCALL kernelThread(void *ptr)
+{
+	kernelJob_t *job = (kernelJob_t *)ptr;
+
+	while (true)
+	{
+		const int64_t start = (int64_t)SDL_AtomicAdd(&job->nextChunk, 1) * KERNEL_CHUNK_LEN;
+		if (start >= job->length)
+			break;
+
+		const int64_t end = MIN(start + KERNEL_CHUNK_LEN, job->length);
+		job->func(job, (int32_t)start, (int32_t)end);
+	}
+
+	return true;
+}
+
+static void runKernel(kernelJob_t *job, kernelFunc_t func, int32_t length, bool allowThreads)
+{
+	job->func = func;
+	job->length = length;
+	SDL_AtomicSet(&job->nextChunk, 0);
+
+	if (length <= 0)
+		return;
+
+	int32_t numThreads = 1;
+	if (allowThreads && length >= SMP_KERNEL_MT_LENGTH)
+	{
+		const int64_t numChunks = ((int64_t)length + (KERNEL_CHUNK_LEN-1)) / KERNEL_CHUNK_LEN;
+
+		numThreads = CLAMP(SDL_GetCPUCount(), 1, KERNEL_MAX_THREADS);
+		if (numThreads > numChunks)
+			numThreads = (int32_t)numChunks;
+	}
+
+	if (numThreads <= 1)
+	{
+		func(job, 0, length);
+		return;
+	}
+
+	SDL_Thread *threads[KERNEL_MAX_THREADS];
+	int32_t threadsStarted = 0;
+	for (int32_t i = 0; i < numThreads-1; i++) // this thread is also working
+	{
+		threads[threadsStarted] = SDL_CreateThread(kernelThread, NULL, job);
+		if (threads[threadsStarted] != NULL)
+			threadsStarted++;
+	}
+
+	kernelThread(job);
+
+	for (int32_t i = 0; i < threadsStarted; i++)
+		SDL_WaitThread(threads[i], NULL);
+}
+
+static void gainRampRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int8_t *p = job->dst;
+	const bool sample16Bit = job->dst16Bit;
+	const float fDelta = (float)job->dGain2;
+
+	for (int32_t pos = start; pos < end; pos += GAIN_BLOCK_LEN)
+	{
+		const int32_t blockEnd = MIN(end, pos + GAIN_BLOCK_LEN);
+		const float fGain = (float)(job->dGain1 + (job->dGain2 * pos));
+
+		int32_t i = pos;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			const __m128 vGain = _mm_set1_ps(fGain);
+			const __m128 vDelta = _mm_set1_ps(fDelta);
+			const __m128 vFour = _mm_set1_ps(4.0f);
+			__m128 vIndex = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+
+			for (; i+4 <= blockEnd; i += 4)
+			{
+				const __m128 vSmp = _mm_mul_ps(load4(p, i, sample16Bit), _mm_add_ps(vGain, _mm_mul_ps(vDelta, vIndex)));
+				store4(p, i, _mm_cvttps_epi32(vSmp), sample16Bit);
+				vIndex = _mm_add_ps(vIndex, vFour);
+			}
+		}
+#endif
+		for (; i < blockEnd; i++)
+			storeSmp(p, i, (int32_t)(loadSmp(p, i, sample16Bit) * (fGain + (fDelta * (float)(i - pos)))), sample16Bit);
+	}
+}
+
+static void peakRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int32_t minVal = 0, maxVal = 0, i = start;
+
+	if (job->src1_16Bit)
+	{
+		const int16_t *p16 = (const int16_t *)job->src1;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2 && i+8 <= end)
+		{
+			__m128i vMin = _mm_setzero_si128();
+			__m128i vMax = _mm_setzero_si128();
+
+			for (; i+8 <= end; i += 8)
+			{
+				const __m128i v = _mm_loadu_si128((const __m128i *)&p16[i]);
+				vMin = _mm_min_epi16(vMin, v);
+				vMax = _mm_max_epi16(vMax, v);
+			}
+
+			int16_t mins[8], maxs[8];
+			_mm_storeu_si128((__m128i *)mins, vMin);
+			_mm_storeu_si128((__m128i *)maxs, vMax);
+			for (int32_t j = 0; j < 8; j++)
+			{
+				if (mins[j] < minVal) minVal = mins[j];
+				if (maxs[j] > maxVal) maxVal = maxs[j];
+			}
+		}
+#endif
+		for (; i < end; i++)
+		{
+			if (p16[i] < minVal) minVal = p16[i];
+			if (p16[i] > maxVal) maxVal = p16[i];
+		}
+	}
+	else
+	{
+		const int8_t *p8 = job->src1;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2 && i+16 <= end)
+		{
+			// no signed 8-bit min/max in SSE2, so flip the sign bit and use the unsigned ones
+			const __m128i vSign = _mm_set1_epi8(-128);
+			__m128i vMin = vSign;
+			__m128i vMax = vSign;
+
+			for (; i+16 <= end; i += 16)
+			{
+				const __m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p8[i]), vSign);
+				vMin = _mm_min_epu8(vMin, v);
+				vMax = _mm_max_epu8(vMax, v);
+			}
+
+			int8_t mins[16], maxs[16];
+			_mm_storeu_si128((__m128i *)mins, _mm_xor_si128(vMin, vSign));
+			_mm_storeu_si128((__m128i *)maxs, _mm_xor_si128(vMax, vSign));
+			for (int32_t j = 0; j < 16; j++)
+			{
+				if (mins[j] < minVal) minVal = mins[j];
+				if (maxs[j] > maxVal) maxVal = maxs[j];
+			}
+		}
+#endif
+		for (; i < end; i++)
+		{
+			if (p8[i] < minVal) minVal = p8[i];
+			if (p8[i] > maxVal) maxVal = p8[i];
+		}
+	}
+
+	mergeResults(job, 0, MAX(-minVal, maxVal));
+}
+
+static void sumRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int64_t sum = 0;
+	int32_t i = start;
+
+	if (job->src1_16Bit)
+	{
+		const int16_t *p16 = (const int16_t *)job->src1;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			const __m128i vOne = _mm_set1_epi16(1);
+			while (i+8 <= end)
+			{
+				const int32_t blockEnd = i + MIN((end - i) & ~7, SUM16_BLOCK_LEN);
+
+				__m128i vSum = _mm_setzero_si128();
+				for (; i < blockEnd; i += 8)
+					vSum = _mm_add_epi32(vSum, _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&p16[i]), vOne));
+
+				int32_t lanes[4];
+				_mm_storeu_si128((__m128i *)lanes, vSum);
+				sum += (int64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+			}
+		}
+#endif
+		for (; i < end; i++)
+			sum += p16[i];
+	}
+	else
+	{
+		const int8_t *p8 = job->src1;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2 && i+16 <= end)
+		{
+			// sum the unsigned (sign flipped) bytes with _mm_sad_epu8(), then remove the bias
+			const __m128i vSign = _mm_set1_epi8(-128);
+			const __m128i vZero = _mm_setzero_si128();
+			const int32_t numSamples = (end - i) & ~15;
+
+			__m128i vSum = _mm_setzero_si128();
+			for (; i+16 <= end; i += 16)
+				vSum = _mm_add_epi64(vSum, _mm_sad_epu8(_mm_xor_si128(_mm_loadu_si128((const __m128i *)&p8[i]), vSign), vZero));
+
+			int64_t lanes[2];
+			_mm_storeu_si128((__m128i *)lanes, vSum);
+			sum += (lanes[0] + lanes[1]) - ((int64_t)numSamples * 128);
+		}
+#endif
+		for (; i < end; i++)
+			sum += p8[i];
+	}
+
+	mergeResults(job, sum, 0);
+}
+
+static void subtractRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int8_t *p = job->dst;
+	const bool sample16Bit = job->dst16Bit;
+	const int32_t smpSub = job->smpSub;
+
+	int32_t i = start;
+#ifdef KERNELS_SSE2
+	if (cpu.hasSSE2)
+	{
+		// the saturating subtractions do the clamping
+		if (sample16Bit)
+		{
+			int16_t *p16 = (int16_t *)p;
+			const __m128i vSub = _mm_set1_epi16((int16_t)smpSub);
+			for (; i+8 <= end; i += 8)
+				_mm_storeu_si128((__m128i *)&p16[i], _mm_subs_epi16(_mm_loadu_si128((const __m128i *)&p16[i]), vSub));
+		}
+		else
+		{
+			const __m128i vSub = _mm_set1_epi8((int8_t)smpSub);
+			for (; i+16 <= end; i += 16)
+				_mm_storeu_si128((__m128i *)&p[i], _mm_subs_epi8(_mm_loadu_si128((const __m128i *)&p[i]), vSub));
+		}
+	}
+#endif
+	for (; i < end; i++)
+		storeSmp(p, i, loadSmp(p, i, sample16Bit) - smpSub, sample16Bit);
+}
+
+// start/end index the first half of the sample, each sample point is swapped with its mirror
+static void reverseRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	const int32_t length = job->src1Length;
+
+	int32_t i = start;
+	if (job->dst16Bit)
+	{
+		int16_t *p16 = (int16_t *)job->dst;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			for (; i+8 <= end; i += 8)
+			{
+				__m128i *front = (__m128i *)&p16[i];
+				__m128i *back = (__m128i *)&p16[length - i - 8];
+
+				const __m128i a = _mm_loadu_si128(front);
+				const __m128i b = _mm_loadu_si128(back);
+				_mm_storeu_si128(front, reverseWords(b));
+				_mm_storeu_si128(back, reverseWords(a));
+			}
+		}
+#endif
+		for (; i < end; i++)
+		{
+			const int16_t tmp16 = p16[i];
+			p16[i] = p16[length-1-i];
+			p16[length-1-i] = tmp16;
+		}
+	}
+	else
+	{
+		int8_t *p8 = job->dst;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			for (; i+16 <= end; i += 16)
+			{
+				__m128i *front = (__m128i *)&p8[i];
+				__m128i *back = (__m128i *)&p8[length - i - 16];
+
+				const __m128i a = _mm_loadu_si128(front);
+				const __m128i b = _mm_loadu_si128(back);
+				_mm_storeu_si128(front, swapBytes(reverseWords(b)));
+				_mm_storeu_si128(back, swapBytes(reverseWords(a)));
+			}
+		}
+#endif
+		for (; i < end; i++)
+		{
+			const int8_t tmp8 = p8[i];
+			p8[i] = p8[length-1-i];
+			p8[length-1-i] = tmp8;
+		}
+	}
+}
+
+static void flipSignRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int32_t i = start;
+	if (job->dst16Bit)
+	{
+		int16_t *p16 = (int16_t *)job->dst;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			const __m128i vSign = _mm_set1_epi16(-32768);
+			for (; i+8 <= end; i += 8)
+				_mm_storeu_si128((__m128i *)&p16[i], _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p16[i]), vSign));
+		}
+#endif
+		for (; i < end; i++)
+			p16[i] ^= 0x8000;
+	}
+	else
+	{
+		int8_t *p8 = job->dst;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			const __m128i vSign = _mm_set1_epi8(-128);
+			for (; i+16 <= end; i += 16)
+				_mm_storeu_si128((__m128i *)&p8[i], _mm_xor_si128(_mm_loadu_si128((const __m128i *)&p8[i]), vSign));
+		}
+#endif
+		for (; i < end; i++)
+			p8[i] ^= 0x80;
+	}
+}
+
+static void byteSwapRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	uint16_t *p16 = (uint16_t *)job->dst;
+
+	int32_t i = start;
+#ifdef KERNELS_SSE2
+	if (cpu.hasSSE2)
+	{
+		for (; i+8 <= end; i += 8)
+			_mm_storeu_si128((__m128i *)&p16[i], swapBytes(_mm_loadu_si128((const __m128i *)&p16[i])));
+	}
+#endif
+	for (; i < end; i++)
+		p16[i] = (uint16_t)((p16[i] << 8) | (p16[i] >> 8));
+}
+
+static void mixSegment(kernelJob_t *job, int32_t start, int32_t end, bool useSrc1, bool useSrc2)
+{
+	int8_t *dst = job->dst;
+	const int8_t *src1 = job->src1, *src2 = job->src2;
+	const bool dst16Bit = job->dst16Bit, src1_16Bit = job->src1_16Bit, src2_16Bit = job->src2_16Bit;
+	const float fGain1 = (float)job->dGain1;
+	const float fGain2 = (float)job->dGain2;
+
+	int32_t i = start;
+#ifdef KERNELS_SSE2
+	if (cpu.hasSSE2)
+	{
+		const __m128 vGain1 = _mm_set1_ps(fGain1);
+		const __m128 vGain2 = _mm_set1_ps(fGain2);
+		const __m128 vSignMask = _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+		const __m128 vHalf = _mm_set1_ps(0.5f);
+
+		for (; i+4 <= end; i += 4)
+		{
+			__m128 vOut = _mm_setzero_ps();
+			if (useSrc1) vOut = _mm_mul_ps(load4(src1, i, src1_16Bit), vGain1);
+			if (useSrc2) vOut = _mm_add_ps(vOut, _mm_mul_ps(load4(src2, i, src2_16Bit), vGain2));
+
+			// round half away from zero (like FROUND), then truncate
+			vOut = _mm_add_ps(vOut, _mm_or_ps(_mm_and_ps(vOut, vSignMask), vHalf));
+			store4(dst, i, _mm_cvttps_epi32(vOut), dst16Bit);
+		}
+	}
+#endif
+	for (; i < end; i++)
+	{
+		float fOut = 0.0f;
+		if (useSrc1) fOut = loadSmp(src1, i, src1_16Bit) * fGain1;
+		if (useSrc2) fOut += loadSmp(src2, i, src2_16Bit) * fGain2;
+
+		FROUND(fOut);
+		storeSmp(dst, i, (int32_t)fOut, dst16Bit);
+	}
+}
+
+static void mixRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	const int32_t src1Length = (job->src1 == NULL) ? 0 : job->src1Length;
+	const int32_t src2Length = (job->src2 == NULL) ? 0 : job->src2Length;
+
+	// split the range where one of the sources ends
+	int32_t i = start;
+	while (i < end)
+	{
+		const bool useSrc1 = (i < src1Length);
+		const bool useSrc2 = (i < src2Length);
+
+		int32_t segmentEnd = end;
+		if (useSrc1 && src1Length < segmentEnd) segmentEnd = src1Length;
+		if (useSrc2 && src2Length < segmentEnd) segmentEnd = src2Length;
+
+		mixSegment(job, i, segmentEnd, useSrc1, useSrc2);
+		i = segmentEnd;
+	}
+}
+
+static void convertRange(kernelJob_t *job, int32_t start, int32_t end)
+{
+	int8_t *dst = job->dst;
+	const int8_t *src = job->src1;
+
+	int32_t i = start;
+	if (job->dst16Bit && !job->src1_16Bit) // 8-bit -> 16-bit (safe in-place when run from end to start)
+	{
+		int16_t *dst16 = (int16_t *)dst;
+
+		i = end;
+		for (; i > start && ((i - start) & 15) != 0; i--)
+			dst16[i-1] = (int16_t)(src[i-1] * 256);
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			// interleaving with zero puts each byte in the high byte of a word (= sample << 8)
+			const __m128i vZero = _mm_setzero_si128();
+			for (; i > start; i -= 16)
+			{
+				const __m128i v = _mm_loadu_si128((const __m128i *)&src[i-16]);
+				_mm_storeu_si128((__m128i *)&dst16[i-16], _mm_unpacklo_epi8(vZero, v));
+				_mm_storeu_si128((__m128i *)&dst16[i-8], _mm_unpackhi_epi8(vZero, v));
+			}
+		}
+#endif
+		for (; i > start; i--)
+			dst16[i-1] = (int16_t)(src[i-1] * 256);
+	}
+	else if (!job->dst16Bit && job->src1_16Bit) // 16-bit -> 8-bit (safe in-place when run from start to end)
+	{
+		const int16_t *src16 = (const int16_t *)src;
+#ifdef KERNELS_SSE2
+		if (cpu.hasSSE2)
+		{
+			for (; i+16 <= end; i += 16)
+			{
+				const __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)&src16[i+0]), 8);
+				const __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)&src16[i+8]), 8);
+				_mm_storeu_si128((__m128i *)&dst[i], _mm_packs_epi16(a, b));
+			}
+		}
+#endif
+		for (; i < end; i++)
+			dst[i] = (int8_t)(src16[i] >> 8);
+	}
+	else
+	{
+		const int32_t shift = job->dst16Bit;
+		memmove(&dst[start << shift], &src[start << shift], (end - start) << shift);
+	}
+}
+
+void smpKernelGainRamp(int8_t *smpData, bool sample16Bit, int32_t length, double dStartGain, double dEndGain)
+{
+	kernelJob_t job;
+
+	if (smpData == NULL || length <= 0)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = smpData;
+	job.dst16Bit = sample16Bit;
+	job.dGain1 = dStartGain;
+	job.dGain2 = (dEndGain - dStartGain) / length;
+
+	runKernel(&job, gainRampRange, length, true);
+}
+
+int32_t smpKernelGetPeak(const int8_t *smpData, bool sample16Bit, int32_t length)
+{
+	kernelJob_t job;
+
+	if (smpData == NULL || length <= 0)
+		return 0;
+
+	memset(&job, 0, sizeof (job));
+	job.src1 = smpData;
+	job.src1_16Bit = sample16Bit;
+
+	runKernel(&job, peakRange, length, true);
+	return job.peak;
+}
+
+void smpKernelRemoveDC(int8_t *smpData, bool sample16Bit, int32_t length)
+{
+	kernelJob_t job;
+
+	if (smpData == NULL || length <= 0)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = smpData;
+	job.src1 = smpData;
+	job.dst16Bit = job.src1_16Bit = sample16Bit;
+
+	runKernel(&job, sumRange, length, true);
+
+	job.smpSub = (int32_t)((job.sum + (length >> 1)) / length); // rounded
+	if (job.smpSub != 0)
+		runKernel(&job, subtractRange, length, true);
+}
+
+void smpKernelReverse(int8_t *smpData, bool sample16Bit, int32_t length)
+{
+	kernelJob_t job;
+
+	if (smpData == NULL || length < 2)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = smpData;
+	job.dst16Bit = sample16Bit;
+	job.src1Length = length;
+
+	runKernel(&job, reverseRange, length >> 1, true);
+}
+
+void smpKernelFlipSign(int8_t *smpData, bool sample16Bit, int32_t length)
+{
+	kernelJob_t job;
+
+	if (smpData == NULL || length <= 0)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = smpData;
+	job.dst16Bit = sample16Bit;
+
+	runKernel(&job, flipSignRange, length, true);
+}
+
+void smpKernelByteSwap(int8_t *data, int32_t numWords)
+{
+	kernelJob_t job;
+
+	if (data == NULL || numWords <= 0)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = data;
+
+	runKernel(&job, byteSwapRange, numWords, true);
+}
+
+void smpKernelMix(int8_t *dstData, bool dst16Bit, int32_t length,
+	const int8_t *src1Data, bool src1_16Bit, int32_t src1Length, double dSrc1Gain,
+	const int8_t *src2Data, bool src2_16Bit, int32_t src2Length, double dSrc2Gain)
+{
+	kernelJob_t job;
+
+	if (dstData == NULL || length <= 0)
+		return;
+
+	memset(&job, 0, sizeof (job));
+	job.dst = dstData;
+	job.dst16Bit = dst16Bit;
+	job.src1 = src1Data;
+	job.src1_16Bit = src1_16Bit;
+	job.src1Length = src1Length;
+	job.dGain1 = dSrc1Gain;
+	job.src2 = src2Data;
+	job.src2_16Bit = src2_16Bit;
+	job.src2Length = src2Length;
+	job.dGain2 = dSrc2Gain;
+
+	runKernel(&job, mixRange, length, true);
+}
+
+void smpKernelConvert(int8_t *dstData, bool dst16Bit, const int8_t *srcData, bool src16Bit, int32_t length)
+{
+	kernelJob_t job;
+
+	if (dstData == NULL || srcData == NULL || length <= 0)
+		return;
+
+	assert(dstData != srcData || dst16Bit != src16Bit);
+
+	memset(&job, 0, sizeof (job));
+	job.dst = dstData;
+	job.dst16Bit = dst16Bit;
+	job.src1 = srcData;
+	job.src1_16Bit = src16Bit;
+
+	// in-place conversion has to run in one go, so only split it if the buffers are separate
+	runKernel(&job, convertRange, length, dstData != srcData);
+}
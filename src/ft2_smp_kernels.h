@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Sample data kernels for the sample editor tools (SSE2 where available).
+** Samples longer than SMP_KERNEL_MT_LENGTH are split across worker threads.
+** Lengths/offsets are in samples, and the data is the unfixed sample data
+** (use beginSmpEdit() first).
+*/
+
+#define SMP_KERNEL_MT_LENGTH (1 << 20)
+
+// multiplies by a gain going linearly from dStartGain to dEndGain (1.0 = unity), truncates and clamps
+void smpKernelGainRamp(int8_t *smpData, bool sample16Bit, int32_t length, double dStartGain, double dEndGain);
+
+// returns the highest absolute sample value (0..128 or 0..32768)
+int32_t smpKernelGetPeak(const int8_t *smpData, bool sample16Bit, int32_t length);
+
+// subtracts the (rounded) average from the sample data, clamps
+void smpKernelRemoveDC(int8_t *smpData, bool sample16Bit, int32_t length);
+
+void smpKernelReverse(int8_t *smpData, bool sample16Bit, int32_t length);
+void smpKernelFlipSign(int8_t *smpData, bool sample16Bit, int32_t length);
+void smpKernelByteSwap(int8_t *data, int32_t numWords);
+
+/* dst = round((src1 * dSrc1Gain) + (src2 * dSrc2Gain)), clamped. The gains are
+** in sample units (they include the 8-bit/16-bit scaling). Past the end of a
+** source (or if it's NULL), that source is silent.
+*/
+void smpKernelMix(int8_t *dstData, bool dst16Bit, int32_t length,
+	const int8_t *src1Data, bool src1_16Bit, int32_t src1Length, double dSrc1Gain,
+	const int8_t *src2Data, bool src2_16Bit, int32_t src2Length, double dSrc2Gain);
+
+/* 16-bit -> 8-bit keeps the high byte, 8-bit -> 16-bit shifts up by 8.
+** dstData may be the same as srcData (runs on one thread then), the buffer must
+** be big enough for the 16-bit data in that case.
+*/
+void smpKernelConvert(int8_t *dstData, bool dst16Bit, const int8_t *srcData, bool src16Bit, int32_t length);
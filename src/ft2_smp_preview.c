@@ -0,0 +1,575 @@
+/* Disk Op. sample preview
+**
+** A decoder thread streams the first seconds of a WAV/AIFF/IFF/FLAC file
+** into a small ring buffer, and the audio callback resamples it into the
+** mix buffer. Nothing is allocated per file except the decoder state, and
+** instr[] is never touched, so previewing doesn't change the song.
+*/
+
+// for finding memory leaks in debug mode with Visual Studio
+#if defined _DEBUG && defined _MSC_VER
+#include <crtdbg.h>
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "ft2_header.h"
+#include "ft2_audio.h"
+#include "ft2_structs.h"
+#include "ft2_sample_loader.h"
+#include "ft2_smp_preview.h"
+
+#ifdef HAS_LIBFLAC
+#ifdef EXTERNAL_LIBFLAC
+#include <FLAC/stream_decoder.h>
+#else
+#include "libflac/FLAC/stream_decoder.h"
+#endif
+#endif
+
+#define PREVIEW_RING_SIZE 32768 // frames, must be a power of two
+#define PREVIEW_RING_MASK (PREVIEW_RING_SIZE-1)
+#define PREVIEW_MAX_SECONDS 10
+#define PREVIEW_VOLUME 0.5f
+
+typedef struct previewInfo_t
+{
+	int8_t format;
+	bool bigEndian;
+	uint8_t numChannels;
+	uint32_t dataPtr, numFrames;
+	double dSampleRate;
+} previewInfo_t;
+
+static SDL_atomic_t previewActive, stopRequested, decodeDone, readPos, writePos;
+static float fRing[PREVIEW_RING_SIZE], fDecodeBuf[PREVIEW_RING_SIZE / 2];
+static float fPrevSmp, fCurrSmp; // for linear interpolation (audio thread only)
+static double dPreviewRate, dPreviewFrac;
+static UNICHAR *previewFilenameU;
+static SDL_Thread *previewThread;
+
+// waits for room in the ring buffer, returns false if the preview was stopped
+static bool pushFrames(const float *fSrc, uint32_t numFrames)
+{
+	while (numFrames > 0)
+	{
+		const uint32_t wr = (uint32_t)SDL_AtomicGet(&writePos);
+		const uint32_t rd = (uint32_t)SDL_AtomicGet(&readPos);
+
+		uint32_t space = PREVIEW_RING_SIZE - (wr - rd);
+		if (space == 0)
+		{
+			if (SDL_AtomicGet(&stopRequested))
+				return false;
+
+			SDL_Delay(2);
+			continue;
+		}
+
+		if (space > numFrames)
+			space = numFrames;
+
+		for (uint32_t i = 0; i < space; i++)
+			fRing[(wr + i) & PREVIEW_RING_MASK] = fSrc[i];
+
+		SDL_AtomicSet(&writePos, (int32_t)(wr + space));
+
+		// the mixer starts when there is something to play
+		if (!SDL_AtomicGet(&previewActive))
+			SDL_AtomicSet(&previewActive, 1);
+
+		fSrc += space;
+		numFrames -= space;
+	}
+
+	return !SDL_AtomicGet(&stopRequested);
+}
+
+static double getAIFFSampleRate(const uint8_t *in)
+{
+	// 80-bit IEEE-754 to double (sign bit ignored), same as the AIFF loader
+	const uint16_t exp15 = ((in[0] & 0x7F) << 8) | in[1];
+
+	uint64_t mantissa = 0;
+	for (int32_t i = 0; i < 8; i++)
+		mantissa = (mantissa << 8) | in[2+i];
+
+	return (1.0 + ((mantissa & INT64_MAX) / (INT64_MAX+1.0))) * exp2(exp15 - 16383.0);
+}
+
+static bool getWAVInfo(FILE *f, uint32_t filesize, previewInfo_t *info)
+{
+	uint16_t audioFormat = 0, numChannels = 0, bitsPerSample = 0;
+	uint32_t chunkID, chunkSize, sampleRate = 0, dataLen = 0;
+
+	fseek(f, 12, SEEK_SET);
+	while (!feof(f) && (uint32_t)ftell(f) < filesize-8)
+	{
+		if (fread(&chunkID, 4, 1, f) != 1 || fread(&chunkSize, 4, 1, f) != 1)
+			break;
+
+		const uint32_t chunkPtr = ftell(f);
+		if (chunkID == 0x20746D66 && chunkSize >= 16) // "fmt "
+		{
+			fread(&audioFormat, 2, 1, f);
+			fread(&numChannels, 2, 1, f);
+			fread(&sampleRate, 4, 1, f);
+			fseek(f, 6, SEEK_CUR);
+			fread(&bitsPerSample, 2, 1, f);
+		}
+		else if (chunkID == 0x61746164) // "data"
+		{
+			info->dataPtr = chunkPtr;
+			dataLen = chunkSize;
+		}
+
+		fseek(f, chunkPtr + chunkSize + (chunkSize & 1), SEEK_SET);
+	}
+
+	if (info->dataPtr == 0 || sampleRate == 0 || numChannels == 0 || numChannels > 2)
+		return false;
+
+	if (audioFormat == 3 && bitsPerSample == 32) // IEEE float
+		info->format = PCM_FORMAT_FLOAT;
+	else if (audioFormat == 3 && bitsPerSample == 64)
+		info->format = PCM_FORMAT_DOUBLE;
+	else if (audioFormat == 1 && bitsPerSample == 8)
+		info->format = PCM_FORMAT_U8;
+	else if (audioFormat == 1 && bitsPerSample == 16)
+		info->format = PCM_FORMAT_S16;
+	else if (audioFormat == 1 && bitsPerSample == 24)
+		info->format = PCM_FORMAT_S24;
+	else if (audioFormat == 1 && bitsPerSample == 32)
+		info->format = PCM_FORMAT_S32;
+	else
+		return false;
+
+	info->bigEndian = false;
+	info->numChannels = (uint8_t)numChannels;
+	info->numFrames = dataLen / ((bitsPerSample / 8) * numChannels);
+	info->dSampleRate = sampleRate;
+
+	return true;
+}
+
+static bool getAIFFInfo(FILE *f, uint32_t filesize, previewInfo_t *info)
+{
+	uint8_t comm[22];
+	uint32_t chunkID, chunkSize, commLen = 0, dataLen = 0;
+
+	fseek(f, 12, SEEK_SET);
+	while (!feof(f) && (uint32_t)ftell(f) < filesize-8)
+	{
+		if (fread(&chunkID, 4, 1, f) != 1 || fread(&chunkSize, 4, 1, f) != 1)
+			break;
+
+		chunkID = SWAP32(chunkID);
+		chunkSize = SWAP32(chunkSize);
+
+		const uint32_t chunkPtr = ftell(f);
+		if (chunkID == 0x434F4D4D && chunkSize >= 18) // "COMM"
+		{
+			commLen = (chunkSize > 22) ? 22 : chunkSize;
+			fread(comm, 1, commLen, f);
+		}
+		else if (chunkID == 0x53534E44 && chunkSize > 8) // "SSND"
+		{
+			info->dataPtr = chunkPtr + 8; // skip offset and blockSize
+			dataLen = chunkSize - 8;
+		}
+
+		fseek(f, chunkPtr + chunkSize + (chunkSize & 1), SEEK_SET);
+	}
+
+	if (commLen == 0 || info->dataPtr == 0)
+		return false;
+
+	const uint16_t numChannels = (comm[0] << 8) | comm[1];
+	const uint16_t bitDepth = (comm[6] << 8) | comm[7];
+
+	if (numChannels == 0 || numChannels > 2)
+		return false;
+
+	bool signedSample = true, floatSample = false;
+	if (commLen >= 22)
+	{
+		if (!memcmp(&comm[18], "raw ", 4))
+			signedSample = false;
+		else if (!memcmp(&comm[18], "FL32", 4) || !memcmp(&comm[18], "fl32", 4) || !memcmp(&comm[18], "FL64", 4) || !memcmp(&comm[18], "fl64", 4))
+			floatSample = true;
+		else if (memcmp(&comm[18], "NONE", 4) && memcmp(&comm[18], "twos", 4))
+			return false;
+	}
+
+	if (floatSample && bitDepth == 32)
+		info->format = PCM_FORMAT_FLOAT;
+	else if (floatSample && bitDepth == 64)
+		info->format = PCM_FORMAT_DOUBLE;
+	else if (!floatSample && bitDepth == 8)
+		info->format = signedSample ? PCM_FORMAT_S8 : PCM_FORMAT_U8;
+	else if (!floatSample && bitDepth == 16)
+		info->format = PCM_FORMAT_S16;
+	else if (!floatSample && bitDepth == 24)
+		info->format = PCM_FORMAT_S24;
+	else if (!floatSample && bitDepth == 32)
+		info->format = PCM_FORMAT_S32;
+	else
+		return false;
+
+	info->bigEndian = true;
+	info->numChannels = (uint8_t)numChannels;
+	info->numFrames = dataLen / ((bitDepth / 8) * numChannels);
+	info->dSampleRate = getAIFFSampleRate(&comm[8]);
+
+	return true;
+}
+
+static bool getIFFInfo(FILE *f, uint32_t filesize, bool sample16Bit, previewInfo_t *info)
+{
+	uint16_t sampleRate = 0;
+	uint32_t chunkID, chunkSize, dataLen = 0;
+
+	fseek(f, 12, SEEK_SET);
+	while (!feof(f) && (uint32_t)ftell(f) < filesize-8)
+	{
+		if (fread(&chunkID, 4, 1, f) != 1 || fread(&chunkSize, 4, 1, f) != 1)
+			break;
+
+		chunkID = SWAP32(chunkID);
+		chunkSize = SWAP32(chunkSize);
+
+		const uint32_t chunkPtr = ftell(f);
+		if (chunkID == 0x56484452 && chunkSize >= 20) // "VHDR"
+		{
+			fseek(f, 12, SEEK_CUR);
+			fread(&sampleRate, 2, 1, f); sampleRate = SWAP16(sampleRate);
+		}
+		else if (chunkID == 0x424F4459) // "BODY"
+		{
+			info->dataPtr = chunkPtr;
+			dataLen = chunkSize;
+		}
+
+		fseek(f, chunkPtr + chunkSize + (chunkSize & 1), SEEK_SET);
+	}
+
+	if (info->dataPtr == 0 || sampleRate == 0)
+		return false;
+
+	if (info->dataPtr+dataLen > filesize)
+		dataLen = filesize - info->dataPtr;
+
+	// 16SV data is stored in little-endian, like the IFF loader expects
+	info->format = sample16Bit ? PCM_FORMAT_S16 : PCM_FORMAT_S8;
+	info->bigEndian = false;
+	info->numChannels = 1;
+	info->numFrames = dataLen >> sample16Bit;
+	info->dSampleRate = sampleRate;
+
+	return true;
+}
+
+static void streamPCM(FILE *f, const previewInfo_t *info)
+{
+	pcmStream_t ps;
+
+	if (info->dSampleRate < 100.0 || info->numFrames == 0)
+		return;
+
+	dPreviewRate = info->dSampleRate;
+
+	uint32_t framesLeft = info->numFrames;
+	const uint32_t maxFrames = (uint32_t)(info->dSampleRate * PREVIEW_MAX_SECONDS);
+	if (framesLeft > maxFrames)
+		framesLeft = maxFrames;
+
+	fseek(f, info->dataPtr, SEEK_SET);
+	if (!openPCMStream(&ps, f, info->format, info->bigEndian, info->numChannels, STEREO_SAMPLE_CONVERT))
+		return;
+
+	while (framesLeft > 0 && !SDL_AtomicGet(&stopRequested))
+	{
+		uint32_t chunkFrames = (framesLeft > PCM_CHUNK_FRAMES) ? PCM_CHUNK_FRAMES : framesLeft;
+		if (chunkFrames > PREVIEW_RING_SIZE / 2)
+			chunkFrames = PREVIEW_RING_SIZE / 2;
+
+		chunkFrames = readPCMStreamFloat(&ps, fDecodeBuf, chunkFrames);
+		if (chunkFrames == 0 || !pushFrames(fDecodeBuf, chunkFrames))
+			break;
+
+		framesLeft -= chunkFrames;
+	}
+
+	closePCMStream(&ps);
+}
+
+#ifdef HAS_LIBFLAC
+typedef struct flacPreview_t
+{
+	FILE *f;
+	uint32_t bitDepth, framesLeft;
+} flacPreview_t;
+
+static FLAC__StreamDecoderReadStatus flacReadCallback(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data)
+{
+	FILE *file = ((flacPreview_t *)client_data)->f;
+	if (*bytes == 0)
+		return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
+
+	*bytes = fread(buffer, sizeof (FLAC__byte), *bytes, file);
+	if (ferror(file))
+		return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
+	else if (*bytes == 0)
+		return FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+
+	return FLAC__STREAM_DECODER_READ_STATUS_CONTINUE;
+
+	(void)decoder;
+}
+
+static void flacMetadataCallback(const FLAC__StreamDecoder *decoder, const FLAC__StreamMetadata *metadata, void *client_data)
+{
+	flacPreview_t *fp = (flacPreview_t *)client_data;
+
+	if (metadata->type == FLAC__METADATA_TYPE_STREAMINFO)
+	{
+		fp->bitDepth = metadata->data.stream_info.bits_per_sample;
+		dPreviewRate = metadata->data.stream_info.sample_rate;
+		fp->framesLeft = (uint32_t)(dPreviewRate * PREVIEW_MAX_SECONDS);
+	}
+
+	(void)decoder;
+}
+
+static FLAC__StreamDecoderWriteStatus flacWriteCallback(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[], void *client_data)
+{
+	flacPreview_t *fp = (flacPreview_t *)client_data;
+
+	const uint32_t numChannels = frame->header.channels;
+	if (fp->bitDepth < 4 || fp->bitDepth > 32 || numChannels == 0 || numChannels > 2 || dPreviewRate < 100.0)
+		return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+
+	uint32_t blockSize = frame->header.blocksize;
+	if (blockSize > fp->framesLeft)
+		blockSize = fp->framesLeft;
+
+	const float fScale = 1.0f / (float)(1ULL << (fp->bitDepth - 1));
+	const float fMonoScale = (numChannels == 2) ? (fScale * 0.5f) : fScale;
+	const FLAC__int32 *srcL = buffer[0];
+	const FLAC__int32 *srcR = buffer[numChannels-1];
+
+	uint32_t framesDone = 0;
+	while (framesDone < blockSize)
+	{
+		uint32_t chunkFrames = blockSize - framesDone;
+		if (chunkFrames > PREVIEW_RING_SIZE / 2)
+			chunkFrames = PREVIEW_RING_SIZE / 2;
+
+		if (numChannels == 2)
+		{
+			for (uint32_t i = 0; i < chunkFrames; i++)
+				fDecodeBuf[i] = ((float)srcL[framesDone+i] + (float)srcR[framesDone+i]) * fMonoScale;
+		}
+		else
+		{
+			for (uint32_t i = 0; i < chunkFrames; i++)
+				fDecodeBuf[i] = (float)srcL[framesDone+i] * fMonoScale;
+		}
+
+		if (!pushFrames(fDecodeBuf, chunkFrames))
+			return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+
+		framesDone += chunkFrames;
+	}
+
+	fp->framesLeft -= blockSize;
+	if (fp->framesLeft == 0)
+		return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT; // preview length reached
+
+	return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+
+	(void)decoder;
+}
+
+static void flacErrorCallback(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status, void *client_data)
+{
+	(void)decoder;
+	(void)status;
+	(void)client_data;
+}
+
+static void streamFLAC(FILE *f)
+{
+	flacPreview_t fp;
+	memset(&fp, 0, sizeof (fp));
+	fp.f = f;
+
+	FLAC__StreamDecoder *decoder = FLAC__stream_decoder_new();
+	if (decoder == NULL)
+		return;
+
+	rewind(f);
+	if (FLAC__stream_decoder_init_stream(decoder, flacReadCallback, NULL, NULL, NULL, NULL,
+		flacWriteCallback, flacMetadataCallback, flacErrorCallback, &fp) == FLAC__STREAM_DECODER_INIT_STATUS_OK)
+	{
+		FLAC__stream_decoder_process_until_end_of_stream(decoder);
+		FLAC__stream_decoder_finish(decoder);
+	}
+
+	FLAC__stream_decoder_delete(decoder);
+}
+#endif
+
+static int32_t SDLCALL previewThreadFunc(void *ptr)
+{
+	uint8_t hdr[12];
+	previewInfo_t info;
+
+	FILE *f = UNICHAR_FOPEN(previewFilenameU, "rb");
+	if (f == NULL)
+		goto done;
+
+	fseek(f, 0, SEEK_END);
+	const uint32_t filesize = (uint32_t)ftell(f);
+	rewind(f);
+
+	if (filesize < 12 || fread(hdr, 1, 12, f) != 12)
+	{
+		fclose(f);
+		goto done;
+	}
+
+	memset(&info, 0, sizeof (info));
+
+	if (!memcmp("fLaC", &hdr[0], 4))
+	{
+#ifdef HAS_LIBFLAC
+		streamFLAC(f);
+#endif
+	}
+	else if (!memcmp("RIFF", &hdr[0], 4) && !memcmp("WAVE", &hdr[8], 4))
+	{
+		if (getWAVInfo(f, filesize, &info))
+			streamPCM(f, &info);
+	}
+	else if (!memcmp("FORM", &hdr[0], 4) && (!memcmp("AIFF", &hdr[8], 4) || !memcmp("AIFC", &hdr[8], 4)))
+	{
+		if (getAIFFInfo(f, filesize, &info))
+			streamPCM(f, &info);
+	}
+	else if (!memcmp("FORM", &hdr[0], 4) && (!memcmp("8SVX", &hdr[8], 4) || !memcmp("16SV", &hdr[8], 4)))
+	{
+		if (getIFFInfo(f, filesize, hdr[8] == '1', &info))
+			streamPCM(f, &info);
+	}
+
+	fclose(f);
+
+done:
+	SDL_AtomicSet(&decodeDone, 1);
+	return true;
+
+	(void)ptr;
+}
+
+void stopSmpPreview(void)
+{
+	if (previewThread != NULL)
+	{
+		SDL_AtomicSet(&stopRequested, 1);
+		SDL_WaitThread(previewThread, NULL);
+		previewThread = NULL;
+	}
+
+	SDL_AtomicSet(&previewActive, 0);
+
+	if (previewFilenameU != NULL)
+	{
+		free(previewFilenameU);
+		previewFilenameU = NULL;
+	}
+}
+
+void startSmpPreview(UNICHAR *filenameU)
+{
+	stopSmpPreview();
+
+	if (filenameU == NULL || editor.wavIsRendering)
+		return;
+
+	previewFilenameU = (UNICHAR *)malloc((UNICHAR_STRLEN(filenameU) + 1) * sizeof (UNICHAR));
+	if (previewFilenameU == NULL)
+		return;
+
+	UNICHAR_STRCPY(previewFilenameU, filenameU);
+
+	// reset the ring buffer while the audio callback can't read it
+	lockAudio();
+	SDL_AtomicSet(&readPos, 0);
+	SDL_AtomicSet(&writePos, 0);
+	SDL_AtomicSet(&decodeDone, 0);
+	SDL_AtomicSet(&stopRequested, 0);
+	fPrevSmp = fCurrSmp = 0.0f;
+	dPreviewFrac = 1.0; // fetch the first frame right away
+	dPreviewRate = 0.0;
+	unlockAudio();
+
+	previewThread = SDL_CreateThread(previewThreadFunc, NULL, NULL);
+}
+
+bool smpPreviewIsPlaying(void)
+{
+	return SDL_AtomicGet(&previewActive) != 0;
+}
+
+void mixSmpPreview(float *fMixBufferL, float *fMixBufferR, int32_t samplesToMix)
+{
+	if (!SDL_AtomicGet(&previewActive) || audio.freq == 0)
+		return;
+
+	const double dDelta = dPreviewRate / audio.freq;
+
+	uint32_t rd = (uint32_t)SDL_AtomicGet(&readPos);
+	uint32_t wr = (uint32_t)SDL_AtomicGet(&writePos);
+
+	for (int32_t i = 0; i < samplesToMix; i++)
+	{
+		while (dPreviewFrac >= 1.0)
+		{
+			if (rd == wr)
+			{
+				// check "done" before the write position, so that we don't miss the last frames
+				const bool done = SDL_AtomicGet(&decodeDone);
+				wr = (uint32_t)SDL_AtomicGet(&writePos);
+				if (rd == wr)
+				{
+					if (done)
+						SDL_AtomicSet(&previewActive, 0);
+
+					break; // ran dry, continue in the next callback
+				}
+			}
+
+			fPrevSmp = fCurrSmp;
+			fCurrSmp = fRing[rd & PREVIEW_RING_MASK];
+			rd++;
+
+			dPreviewFrac -= 1.0;
+		}
+
+		if (dPreviewFrac >= 1.0)
+			break;
+
+		const float fSmp = (fPrevSmp + ((fCurrSmp - fPrevSmp) * (float)dPreviewFrac)) * PREVIEW_VOLUME;
+		fMixBufferL[i] += fSmp;
+		fMixBufferR[i] += fSmp;
+
+		dPreviewFrac += dDelta;
+	}
+
+	SDL_AtomicSet(&readPos, (int32_t)rd);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ft2_unicode.h"
+
+/* Disk Op. sample preview. Streams the start of a sample file into a small
+** ring buffer that the audio callback mixes in. Doesn't touch instr[].
+*/
+
+void startSmpPreview(UNICHAR *filenameU); // only call this from the main input/video thread
+void stopSmpPreview(void); // only call this from the main input/video thread
+bool smpPreviewIsPlaying(void);
+
+void mixSmpPreview(float *fMixBufferL, float *fMixBufferR, int32_t samplesToMix); // called from audio callback
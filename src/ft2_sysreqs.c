@@ -21,7 +21,7 @@ void (*loaderMsgBox)(const char *, ...);
 int16_t (*loaderSysReq)(int16_t, const char *, const char *, void (*)(void));
 // ----------------
 
-#define NUM_SYSREQ_TYPES 6
+#define NUM_SYSREQ_TYPES 7
 
 static char *buttonText[NUM_SYSREQ_TYPES][5] =
 {
@@ -33,7 +33,8 @@ static char *buttonText[NUM_SYSREQ_TYPES][5] =
 	// custom dialogs
 	{ "All", "Song", "Instruments", "Cancel", "" },   // "song clear" dialog
 	{ "Read left", "Read right", "Convert", "", "" }, // "stereo sample loader" dialog
-	{ "Mono", "Stereo", "Cancel", "","" }             // "audio sampling" dialog
+	{ "Mono", "Stereo", "Cancel", "","" },            // "audio sampling" dialog
+	{ "Samples", "Instruments", "Cancel", "","" }     // "batch sample import" dialog
 };
 
 static SDL_Keycode shortCut[NUM_SYSREQ_TYPES][5] =
@@ -47,6 +48,7 @@ static SDL_Keycode shortCut[NUM_SYSREQ_TYPES][5] =
 	{ SDLK_a, SDLK_s, SDLK_i, SDLK_c, 0 }, // "song clear" dialog
 	{ SDLK_l, SDLK_r, SDLK_c, 0,      0 }, // "stereo sample loader" dialog 
 	{ SDLK_m, SDLK_s, SDLK_c, 0,      0 }, // "audio sampling" dialog
+	{ SDLK_s, SDLK_i, SDLK_c, 0,      0 }, // "batch sample import" dialog
 };
 
 typedef struct quitType_t
@@ -84,7 +86,7 @@ void myLoaderMsgBoxThreadSafe(const char *fmt, ...)
 	vsnprintf(strBuf, sizeof (strBuf), fmt, args);
 	va_end(args);
 
-	okBoxThreadSafe(0, "System message", fmt, NULL);
+	okBoxThreadSafe(0, "System message", strBuf, NULL);
 }
 
 void myLoaderMsgBox(const char *fmt, ...)
@@ -97,7 +99,7 @@ void myLoaderMsgBox(const char *fmt, ...)
 	vsnprintf(strBuf, sizeof (strBuf), fmt, args);
 	va_end(args);
 
-	okBox(0, "System message", fmt, NULL);
+	okBox(0, "System message", strBuf, NULL);
 }
 
 static void drawWindow(uint16_t w)
@@ -275,7 +277,7 @@ int16_t okBox(int16_t type, const char *headline, const char *text, void (*check
 		readMouseXY();
 		setSyncedReplayerVars();
 
-		if (mouse.leftButtonPressed || mouse.rightButtonPressed)
+		if ((mouse.leftButtonPressed || mouse.rightButtonPressed) && video.uiTick)
 		{
 			if (mouse.lastUsedObjectType == OBJECT_PUSHBUTTON)
 				handlePushButtonsWhileMouseDown();
@@ -473,19 +473,7 @@ static void textOutBuf(uint8_t *dstBuffer, uint32_t dstWidth, uint8_t paletteInd
 		if (chr != ' ')
 		{
 			const uint8_t *srcPtr = &bmp.font1[chr * FONT1_CHAR_W];
-			uint8_t *dstPtr = &dstBuffer[currX];
-
-			for (uint32_t y = 0; y < FONT1_CHAR_H; y++)
-			{
-				for (uint32_t x = 0; x < FONT1_CHAR_W; x++)
-				{
-					if (srcPtr[x])
-						dstPtr[x] = paletteIndex;
-				}
-
-				srcPtr += FONT1_WIDTH;
-				dstPtr += dstWidth;
-			}
+			glyphBlit(&dstBuffer[currX], dstWidth, srcPtr, FONT1_WIDTH, FONT1_CHAR_W, FONT1_CHAR_H, paletteIndex);
 		}
 
 		currX += charWidth(chr);
@@ -564,7 +552,7 @@ void drawTextBox(uint16_t textBoxID)
 	textOutBuf(t->renderBuf, t->renderBufW, PAL_FORGRND, t->textPtr, t->maxChars);
 
 	// fill screen rect background color (not always needed, but I'm lazy)
-	pal = video.frameBuffer[(t->y * SCREEN_W) + t->x] >> 24; // get background palette (stored in alpha channel)
+	pal = video.frameBuffer[(t->y * SCREEN_W) + t->x]; // get background palette
 	fillRect(t->x + t->tx, t->y + t->ty, t->renderW, 10, pal); // 10 = tallest possible glyph/char height
 
 	// render visible part of text render buffer to screen
@@ -16,175 +16,264 @@
 #include "ft2_audio.h"
 #include "ft2_mouse.h"
 #include "ft2_structs.h"
+#include "ft2_undo.h"
 
-// this is truly a mess, but it works...
+/* The pattern side of the size calculation is done from the per-pattern
+** usage summaries (see getPattUsage()), so only edited patterns get
+** rescanned. The instrument side is counted directly from the instruments,
+** no copies are made.
+*/
 
-static char byteFormatBuffer[64], tmpInstrName[1 + MAX_INST][22 + 1], tmpInstName[MAX_INST][22 + 1];
+static char byteFormatBuffer[64], tmpInstName[MAX_INST][22 + 1];
 static bool removePatt, removeInst, removeSamp, removeChans, removeSmpDataAfterLoop, convSmpsTo8Bit;
 static uint8_t instrUsed[MAX_INST], instrOrder[MAX_INST], pattUsed[MAX_PATTERNS], pattOrder[MAX_PATTERNS];
-static int16_t oldPattLens[MAX_PATTERNS], tmpPattLens[MAX_PATTERNS];
+static int16_t oldPattLens[MAX_PATTERNS];
 static int64_t xmSize64 = -1, xmAfterTrimSize64 = -1, spaceSaved64 = -1;
-static note_t *oldPatts[MAX_PATTERNS], *tmpPatt[MAX_PATTERNS];
-static instr_t *tmpInstr[1 + MAX_INST], *tmpInst[MAX_INST]; // tmpInstr[x] = copy of instr[x] for "after trim" size calculation
+static note_t *oldPatts[MAX_PATTERNS];
+static instr_t *tmpInst[MAX_INST];
 static SDL_Thread *trimThread;
 
 void pbTrimCalc(void);
 
-static void freeTmpInstruments(void)
+static uint32_t getChannelMask(int32_t numChannels)
 {
-	for (int32_t i = 0; i <= MAX_INST; i++)
-	{
-		if (tmpInstr[i] != NULL)
-		{
-			// don't free samples, as the pointers are shared with main instruments...
+	if (numChannels >= 32)
+		return 0xFFFFFFFF;
 
-			free(tmpInstr[i]);
-			tmpInstr[i] = NULL;
-		}
+	return (1UL << numChannels) - 1;
+}
+
+static bool pattEmptyInChannels(uint16_t pattNum, int32_t numChannels)
+{
+	return (getPattUsage(pattNum)->usedChannels & getChannelMask(numChannels)) == 0;
+}
+
+static int32_t getPackedPattSize(uint16_t pattNum, int32_t numChannels)
+{
+	const pattUsage_t *u = getPattUsage(pattNum);
+
+	int32_t packedSize = 0;
+	for (int32_t i = 0; i < numChannels; i++)
+		packedSize += u->packedChnSize[i];
+
+	return packedSize;
+}
+
+static int32_t getPattDataSize(uint16_t pattNum, int32_t numChannels)
+{
+	int32_t pattSize = sizeof (xmPatHdr_t);
+	if (!pattEmptyInChannels(pattNum, numChannels))
+		pattSize += getPackedPattSize(pattNum, numChannels);
+
+	return pattSize;
+}
+
+// count number of patterns that would be saved
+static int16_t getNumPatts(int32_t numChannels)
+{
+	int16_t ap = MAX_PATTERNS;
+	while (ap > 0 && pattEmptyInChannels(ap - 1, numChannels))
+		ap--;
+
+	return ap;
+}
+
+// count number of instruments that would be saved
+static int16_t getNumInstrs(void)
+{
+	int16_t ai = MAX_INST;
+	while (ai > 0 && getUsedSamples(ai) == 0 && song.instrName[ai][0] == '\0')
+		ai--;
+
+	return ai;
+}
+
+// returns the number of channels after "remove unused channels"
+static int32_t getTrimmedNumChannels(int16_t ap)
+{
+	uint32_t usedChannels = 0;
+	for (int16_t i = 0; i < ap; i++)
+		usedChannels |= getPattUsage(i)->usedChannels;
+
+	usedChannels &= getChannelMask(song.numChannels);
+	if (usedChannels == 0)
+		return song.numChannels;
+
+	int32_t highestChan = 0;
+	while (usedChannels != 0)
+	{
+		highestChan++;
+		usedChannels >>= 1;
 	}
+
+	// make it an even number
+	if (highestChan & 1)
+		highestChan++;
+
+	return CLAMP(highestChan, 2, song.numChannels);
 }
 
-static bool setTmpInstruments(void)
+// flags the patterns that are in the order list, returns the number of patterns left
+static int16_t markUsedPatts(int16_t ap)
 {
-	freeTmpInstruments();
+	memset(pattUsed, 0, ap);
 
-	for (int32_t i = 0; i <= MAX_INST; i++)
+	int16_t newUsedPatts = 0;
+	for (int16_t i = 0; i < song.songLength; i++)
 	{
-		if (instr[i] != NULL)
+		const uint8_t pattNum = song.orders[i];
+		if (pattNum < ap && !pattUsed[pattNum])
 		{
-			tmpInstr[i] = (instr_t *)malloc(sizeof (instr_t));
-			if (tmpInstr[i] == NULL)
-			{
-				freeTmpInstruments();
-				return false;
-			}
-
-			*tmpInstr[i] = *instr[i];
+			pattUsed[pattNum] = true;
+			newUsedPatts++;
 		}
 	}
 
-	return true;
+	if (newUsedPatts == 0) // nothing to do, keep all patterns
+	{
+		memset(pattUsed, true, ap);
+		newUsedPatts = ap;
+	}
+
+	return newUsedPatts;
 }
 
-static void remapInstrInSong(uint8_t src, uint8_t dst, int32_t ap)
+// flags the instruments that are referenced in the patterns flagged in pattUsed[]
+static void markUsedInstrs(int16_t ap)
 {
-	for (int32_t i = 0; i < ap; i++)
+	uint32_t usedInstr[MAX_INST / 32];
+
+	memset(usedInstr, 0, sizeof (usedInstr));
+	for (int16_t i = 0; i < ap; i++)
 	{
-		note_t *pattPtr = pattern[i];
-		if (pattPtr == NULL)
+		if (!pattUsed[i])
 			continue;
 
-		const int32_t readLen = patternNumRows[i] * MAX_CHANNELS;
-
-		note_t *p = pattPtr;
-		for (int32_t j = 0; j < readLen; j++, p++)
-		{
-			if (p->instr == src)
-				p->instr = dst;
-		}
+		const pattUsage_t *u = getPattUsage(i);
+		for (int32_t j = 0; j < MAX_INST / 32; j++)
+			usedInstr[j] |= u->usedInstr[j];
 	}
+
+	for (int32_t i = 0; i < MAX_INST; i++)
+		instrUsed[i] = (usedInstr[i >> 5] >> (i & 31)) & 1;
 }
 
-static int16_t getUsedTempSamples(uint16_t insNum)
+/* Returns the number of samples an instrument would save with, and the size of their data.
+** If 'afterTrim' is set, this is what it would be after the enabled trim operations.
+*/
+static int16_t getSmpsAndDataSize(int16_t insNum, bool afterTrim, int64_t *smpDataSize64)
 {
-	if (tmpInstr[insNum] == NULL)
-		return 0;
+	*smpDataSize64 = 0;
 
-	instr_t *ins = tmpInstr[insNum];
+	instr_t *ins = instr[insNum];
+	if (ins == NULL)
+		return 0;
 
-	int16_t i = 16 - 1;
-	while (i >= 0 && ins->smp[i].dataPtr == NULL && ins->smp[i].name[0] == '\0')
-		i--;
+	const int16_t numSmps = getUsedSamples(insNum);
 
-	/* Yes, 'i' can be -1 here, and will be set to at least 0
-	** because of ins->ta values. Possibly an FT2 bug...
-	**/
-	for (int16_t j = 0; j < 96; j++)
+	int16_t newNumSmps = 0;
+	for (int16_t i = 0; i < numSmps; i++)
 	{
-		if (ins->note2SampleLUT[j] > i)
-			i = ins->note2SampleLUT[j];
+		if (afterTrim && removeSamp)
+		{
+			// check if sample is referenced in instrument
+			int16_t k;
+			for (k = 0; k < 96; k++)
+			{
+				if (ins->note2SampleLUT[k] == i)
+					break;
+			}
+
+			if (k == 96)
+				continue; // sample is unused (would be removed)
+		}
+
+		newNumSmps++;
+
+		sample_t *s = &ins->smp[i];
+		if (s->dataPtr == NULL || s->length <= 0)
+			continue;
+
+		int32_t length = s->length;
+		bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+
+		if (afterTrim)
+		{
+			if (removeSmpDataAfterLoop && GET_LOOPTYPE(s->flags) != LOOP_OFF && length > s->loopStart+s->loopLength)
+				length = s->loopStart + s->loopLength;
+
+			if (convSmpsTo8Bit)
+				sample16Bit = false;
+		}
+
+		if (length > 0)
+			*smpDataSize64 += (int64_t)length << sample16Bit;
 	}
 
-	return i+1;
+	return newNumSmps;
 }
 
-static int64_t getTempInsAndSmpSize(void)
+static int64_t getInsAndSmpSize(int16_t ai, bool afterTrim)
 {
-	int16_t j;
+	int16_t numSmps[MAX_INST];
+	int64_t smpDataSize64[MAX_INST];
 
-	int16_t ai = MAX_INST;
-	while (ai > 0 && getUsedTempSamples(ai) == 0 && tmpInstrName[ai][0] == '\0')
-		ai--;
+	// get the instruments that would be saved (in order)
+	int16_t numInsts = 0;
+	int16_t numSavedInsts = 0;
+	for (int16_t i = 1; i <= ai; i++)
+	{
+		if (afterTrim && removeInst && !instrUsed[i-1])
+			continue;
 
-	int64_t currSize64 = 0;
+		numSmps[numInsts] = getSmpsAndDataSize(i, afterTrim, &smpDataSize64[numInsts]);
+		numInsts++;
+
+		if (numSmps[numInsts-1] > 0 || song.instrName[i][0] != '\0')
+			numSavedInsts = numInsts;
+	}
 
 	// count instrument and sample data size in song
-	for (int16_t i = 1; i <= ai; i++)
+	int64_t currSize64 = 0;
+	for (int16_t i = 0; i < numSavedInsts; i++)
 	{
-		if (tmpInstr[i] == NULL)
-			j = 0;
-		else
-			j = i;
-
-		const int16_t a = getUsedTempSamples(i);
+		const int16_t a = numSmps[i];
 		if (a > 0)
 			currSize64 += INSTR_HEADER_SIZE + (a * sizeof (xmSmpHdr_t));
 		else
 			currSize64 += 22+11;
 
-		instr_t *ins = tmpInstr[j];
-		for (int16_t k = 0; k < a; k++)
-		{
-			sample_t *s = &ins->smp[k];
-			if (s->dataPtr != NULL && s->length > 0)
-			{
-				if (s->flags & SAMPLE_16BIT)
-					currSize64 += s->length << 1;
-				else
-					currSize64 += s->length;
-			}
-		}
+		currSize64 += smpDataSize64[i];
 	}
 
 	return currSize64;
 }
 
-static void wipeInstrUnused(bool testWipeSize, int16_t *ai, int32_t ap, int32_t antChn)
+static void remapInstrInSong(uint8_t src, uint8_t dst, int32_t ap)
 {
-	int16_t numRows;
-	int32_t i, j, k;
-	note_t *p;
-
-	int32_t numInsts = *ai;
-
-	// calculate what instruments are used
-	memset(instrUsed, 0, numInsts);
-	for (i = 0; i < ap; i++)
+	for (int32_t i = 0; i < ap; i++)
 	{
-		if (testWipeSize)
-		{
-			p = tmpPatt[i];
-			numRows = tmpPattLens[i];
-		}
-		else
-		{
-			p = pattern[i];
-			numRows = patternNumRows[i];
-		}
-
-		if (p == NULL)
+		note_t *pattPtr = pattern[i];
+		if (pattPtr == NULL)
 			continue;
 
-		for (j = 0; j < numRows; j++)
+		const int32_t readLen = patternNumRows[i] * MAX_CHANNELS;
+
+		note_t *p = pattPtr;
+		for (int32_t j = 0; j < readLen; j++, p++)
 		{
-			for (k = 0; k < antChn; k++)
-			{
-				uint8_t ins = p[(j * MAX_CHANNELS) + k].instr;
-				if (ins > 0 && ins <= MAX_INST)
-					instrUsed[ins-1] = true;
-			}
+			if (p->instr == src)
+				p->instr = dst;
 		}
 	}
+}
+
+// instrUsed[] has to be set up first (markUsedInstrs())
+static void wipeInstrUnused(int16_t *ai, int32_t ap)
+{
+	int32_t i;
+
+	int32_t numInsts = *ai;
 
 	int16_t instToDel = 0;
 	uint8_t newInst = 0;
@@ -207,40 +296,6 @@ static void wipeInstrUnused(bool testWipeSize, int16_t *ai, int32_t ap, int32_t
 	if (instToDel == 0)
 		return;
 
-	if (testWipeSize)
-	{
-		for (i = 0; i < numInsts; i++)
-		{
-			if (!instrUsed[i] && tmpInstr[1+i] != NULL)
-			{
-				free(tmpInstr[1+i]);
-				tmpInstr[1+i] = NULL;
-			}
-		}
-
-		// relocate instruments
-
-		memcpy(tmpInstName, &tmpInstrName[1], MAX_INST * sizeof (song.instrName[0]));
-		memcpy(tmpInst, &tmpInstr[1], MAX_INST * sizeof (instr[0]));
-
-		memset(&tmpInstr[1], 0, numInsts * sizeof (tmpInstr[0]));
-		memset(&tmpInstrName[1], 0, numInsts * sizeof (tmpInstrName[0]));
-
-		for (i = 0; i < numInsts; i++)
-		{
-			if (instrUsed[i])
-			{
-				newInst = instrOrder[i];
-
-				memcpy(&tmpInstr[1+newInst], &tmpInst[i], sizeof (tmpInst[0]));
-				strcpy(tmpInstrName[1+newInst], tmpInstName[i]);
-			}
-		}
-
-		*ai = newNumInsts;
-		return;
-	}
-
 	// clear unused instruments
 	for (i = 0; i < numInsts; i++)
 	{
@@ -269,31 +324,16 @@ static void wipeInstrUnused(bool testWipeSize, int16_t *ai, int32_t ap, int32_t
 	}
 
 	*ai = newNumInsts;
-
-	setTmpInstruments();
 }
 
-static void wipePattsUnused(bool testWipeSize, int16_t *ap)
+// pattUsed[] has to be set up first (markUsedPatts())
+static void wipePattsUnused(int16_t *ap, int16_t newUsedPatts)
 {
 	uint8_t newPatt;
-	int16_t i, *pLens;
-	note_t **p;
+	int16_t i;
 
 	int16_t usedPatts = *ap;
-	memset(pattUsed, 0, usedPatts);
-
-	int16_t newUsedPatts = 0;
-	for (i = 0; i < song.songLength; i++)
-	{
-		newPatt = song.orders[i];
-		if (newPatt < usedPatts && !pattUsed[newPatt])
-		{
-			pattUsed[newPatt] = true;
-			newUsedPatts++;
-		}
-	}
-
-	if (newUsedPatts == 0 || newUsedPatts == usedPatts)
+	if (newUsedPatts == usedPatts)
 		return; // nothing to do!
 
 	newPatt = 0;
@@ -304,30 +344,19 @@ static void wipePattsUnused(bool testWipeSize, int16_t *ap)
 			pattOrder[i] = newPatt++;
 	}
 
-	if (testWipeSize)
-	{
-		p = tmpPatt;
-		pLens = tmpPattLens;
-	}
-	else
-	{
-		p = pattern;
-		pLens = patternNumRows;
-	}
-
-	memcpy(oldPatts, p, usedPatts * sizeof (note_t *));
-	memcpy(oldPattLens, pLens, usedPatts * sizeof (int16_t));
-	memset(p, 0, usedPatts * sizeof (note_t *));
-	memset(pLens, 0, usedPatts * sizeof (int16_t));
+	memcpy(oldPatts, pattern, usedPatts * sizeof (note_t *));
+	memcpy(oldPattLens, patternNumRows, usedPatts * sizeof (int16_t));
+	memset(pattern, 0, usedPatts * sizeof (note_t *));
+	memset(patternNumRows, 0, usedPatts * sizeof (int16_t));
 
 	// relocate patterns
 	for (i = 0; i < usedPatts; i++)
 	{
-		p[i] = NULL;
+		pattern[i] = NULL;
 
 		if (!pattUsed[i])
 		{
-			if (!testWipeSize && oldPatts[i] != NULL)
+			if (oldPatts[i] != NULL)
 			{
 				free(oldPatts[i]);
 				oldPatts[i] = NULL;
@@ -336,61 +365,44 @@ static void wipePattsUnused(bool testWipeSize, int16_t *ap)
 		else
 		{
 			newPatt = pattOrder[i];
-			p[newPatt] = oldPatts[i];
-			pLens[newPatt] = oldPattLens[i];
+			pattern[newPatt] = oldPatts[i];
+			patternNumRows[newPatt] = oldPattLens[i];
 		}
 	}
 
-	if (!testWipeSize)
+	for (i = 0; i < MAX_PATTERNS; i++)
 	{
-		for (i = 0; i < MAX_PATTERNS; i++)
-		{
-			if (pattern[i] == NULL)
-				patternNumRows[i] = 64;
-		}
+		if (pattern[i] == NULL)
+			patternNumRows[i] = 64;
+	}
 
-		// reorder order list (and clear unused entries)
-		for (i = 0; i < 256; i++)
-		{
-			if (i < song.songLength)
-				song.orders[i] = pattOrder[song.orders[i]];
-			else
-				song.orders[i] = 0;
-		}
+	// reorder order list (and clear unused entries)
+	for (i = 0; i < 256; i++)
+	{
+		if (i < song.songLength)
+			song.orders[i] = pattOrder[song.orders[i]];
+		else
+			song.orders[i] = 0;
 	}
 
 	*ap = newUsedPatts;
 }
 
-static void wipeSamplesUnused(bool testWipeSize, int16_t ai)
+static void wipeSamplesUnused(int16_t ai)
 {
 	uint8_t smpUsed[16], smpOrder[16];
 	int16_t j, k, l;
-	instr_t *ins;
 	sample_t tempSamples[16];
 
 	for (int16_t i = 1; i <= ai; i++)
 	{
-		if (!testWipeSize)
-		{
-			if (instr[i] == NULL)
-				l = 0;
-			else
-				l = i;
-
-			ins = instr[l];
-			l = getUsedSamples(i);
-		}
+		if (instr[i] == NULL)
+			l = 0;
 		else
-		{
-			if (tmpInstr[i] == NULL)
-				l = 0;
-			else
-				l = i;
+			l = i;
 
-			ins = tmpInstr[l];
-			l = getUsedTempSamples(i);
-		}
+		instr_t *ins = instr[l];
+		l = getUsedSamples(i);
 
 		memset(smpUsed, 0, l);
 		if (l > 0)
@@ -412,7 +424,7 @@ static void wipeSamplesUnused(bool testWipeSize, int16_t ai)
 				{
 					// sample is unused
 
-					if (s->dataPtr != NULL && !testWipeSize)
+					if (s->dataPtr != NULL)
 						freeSmpData(s);
 
 					memset(s, 0, sizeof (sample_t));
@@ -452,185 +464,78 @@ static void wipeSamplesUnused(bool testWipeSize, int16_t ai)
 	}
 }
 
-static void wipeSmpDataAfterLoop(bool testWipeSize, int16_t ai)
+static void wipeSmpDataAfterLoop(int16_t ai)
 {
 	int16_t l;
-	instr_t *ins;
 
 	for (int16_t i = 1; i <= ai; i++)
 	{
-		if (!testWipeSize)
-		{
-			if (instr[i] == NULL)
-				l = 0;
-			else
-				l = i;
-
-			ins = instr[l];
-			l = getUsedSamples(i);
-		}
+		if (instr[i] == NULL)
+			l = 0;
 		else
-		{
-			if (tmpInstr[i] == NULL)
-				l = 0;
-			else
-				l = i;
+			l = i;
 
-			ins = tmpInstr[l];
-			l = getUsedTempSamples(i);
-		}
+		instr_t *ins = instr[l];
+		l = getUsedSamples(i);
 
 		sample_t *s = ins->smp;
 		for (int16_t j = 0; j < l; j++, s++)
 		{
 			if (s->dataPtr != NULL && GET_LOOPTYPE(s->flags) != LOOP_OFF && s->length > 0 && s->length > s->loopStart+s->loopLength)
 			{
-				if (!testWipeSize)
-					unfixSample(s);
+				unfixSample(s);
 
 				s->length = s->loopStart + s->loopLength;
-				if (!testWipeSize)
+				if (s->length <= 0)
 				{
-					if (s->length <= 0)
-					{
-						s->length = 0;
-						freeSmpData(s);
-					}
-					else
-					{
-						reallocateSmpData(s, s->length, !!(s->flags & SAMPLE_16BIT));
-					}
+					s->length = 0;
+					freeSmpData(s);
+				}
+				else
+				{
+					reallocateSmpData(s, s->length, !!(s->flags & SAMPLE_16BIT));
 				}
 
-				if (!testWipeSize)
-					fixSample(s);
+				fixSample(s);
 			}
 		}
 	}
 }
 
-static void convertSamplesTo8bit(bool testWipeSize, int16_t ai)
+static void convertSamplesTo8bit(int16_t ai)
 {
 	int16_t k;
-	instr_t *ins;
 
 	for (int16_t i = 1; i <= ai; i++)
 	{
-		if (!testWipeSize)
-		{
-			if (instr[i] == NULL)
-				k = 0;
-			else
-				k = i;
-
-			ins = instr[k];
-			k = getUsedSamples(i);
-		}
+		if (instr[i] == NULL)
+			k = 0;
 		else
-		{
-			if (tmpInstr[i] == NULL)
-				k = 0;
-			else
-				k = i;
+			k = i;
 
-			ins = tmpInstr[k];
-			k = getUsedTempSamples(i);
-		}
+		instr_t *ins = instr[k];
+		k = getUsedSamples(i);
 
 		sample_t *s = ins->smp;
 		for (int16_t j = 0; j < k; j++, s++)
 		{
 			if (s->dataPtr != NULL && s->length > 0 && (s->flags & SAMPLE_16BIT))
 			{
-				if (testWipeSize)
-				{
-					s->flags &= ~SAMPLE_16BIT;
-				}
-				else
-				{
-					unfixSample(s);
-
-					const int16_t *src16 = (const int16_t *)s->dataPtr;
-					int8_t *dst8 = s->dataPtr;
-
-					for (int32_t a = 0; a < s->length; a++)
-						dst8[a] = src16[a] >> 8;
-
-					s->flags &= ~SAMPLE_16BIT;
-
-					reallocateSmpData(s, s->length, true);
-					fixSample(s);
-				}
-			}
-		}
-	}
-}
-
-static uint16_t getPackedPattSize(note_t *p, int32_t numRows, int32_t antChn)
-{
-	uint8_t bytes[sizeof (note_t)];
+				unfixSample(s);
 
-	uint16_t totalPackLen = 0;
-	uint8_t *pattPtr = (uint8_t *)p;
-	uint8_t *writePtr = pattPtr;
+				const int16_t *src16 = (const int16_t *)s->dataPtr;
+				int8_t *dst8 = s->dataPtr;
 
-	for (int32_t row = 0; row < numRows; row++)
-	{
-		for (int32_t chn = 0; chn < antChn; chn++)
-		{
-			bytes[0] = *pattPtr++;
-			bytes[1] = *pattPtr++;
-			bytes[2] = *pattPtr++;
-			bytes[3] = *pattPtr++;
-			bytes[4] = *pattPtr++;
+				for (int32_t a = 0; a < s->length; a++)
+					dst8[a] = src16[a] >> 8;
 
-			uint8_t *firstBytePtr = writePtr++;
+				s->flags &= ~SAMPLE_16BIT;
 
-			uint8_t packBits = 0;
-			if (bytes[0] > 0) { packBits |= 1; writePtr++; } // note
-			if (bytes[1] > 0) { packBits |= 2; writePtr++; } // instrument
-			if (bytes[2] > 0) { packBits |= 4; writePtr++; } // volume column
-			if (bytes[3] > 0) { packBits |= 8; writePtr++; } // effect
-
-			if (packBits == 15) // first four bits set?
-			{
-				// no packing needed, write pattern data as is
-				totalPackLen += 5;
-				writePtr += 5;
-				continue;
+				reallocateSmpData(s, s->length, true);
+				fixSample(s);
 			}
-
-			if (bytes[4] > 0) writePtr++; // effect parameter
-
-			totalPackLen += (uint16_t)(writePtr - firstBytePtr); // bytes writen
-		}
-
-		// skip unused channels
-		pattPtr += sizeof (note_t) * (MAX_CHANNELS - antChn);
-	}
-
-	return totalPackLen;
-}
-
-static bool tmpPatternEmpty(uint16_t pattNum, int32_t numChannels)
-{
-	if (tmpPatt[pattNum] == NULL)
-		return true;
-
-	uint8_t *scanPtr = (uint8_t *)tmpPatt[pattNum];
-	int32_t scanLen = numChannels * sizeof (note_t);
-	int32_t numRows = tmpPattLens[pattNum];
-
-	for (int32_t i = 0; i < numRows; i++, scanPtr += TRACK_WIDTH)
-	{
-		for (int32_t j = 0; j < scanLen; j++)
-		{
-			if (scanPtr[j] != 0)
-				return false;
 		}
 	}
-
-	return true;
 }
 
 static int64_t calculateXMSize(void)
@@ -638,171 +543,51 @@ static int64_t calculateXMSize(void)
 	// count header size in song
 	int64_t currSize64 = sizeof (xmHdr_t);
 
-	// count number of patterns that would be saved
-	int16_t ap = MAX_PATTERNS;
-	do
-	{
-		if (patternEmpty(ap - 1))
-			ap--;
-		else
-			break;
-	}
-	while (ap > 0);
-
-	// count number of instruments
-	int16_t ai = 128;
-	while (ai > 0 && getUsedSamples(ai) == 0 && song.instrName[ai][0] == '\0')
-		ai--;
+	const int16_t ap = getNumPatts(MAX_CHANNELS);
+	const int16_t ai = getNumInstrs();
 
 	// count packed pattern data size in song
 	for (int16_t i = 0; i < ap; i++)
 	{
 		currSize64 += sizeof (xmPatHdr_t);
-		if (!patternEmpty(i))
-			currSize64 += getPackedPattSize(pattern[i], patternNumRows[i], song.numChannels);
+		if (!pattEmptyInChannels(i, MAX_CHANNELS))
+			currSize64 += getPackedPattSize(i, song.numChannels);
 	}
 
 	// count instrument and sample data size in song
-	for (int16_t i = 1; i <= ai; i++)
-	{
-		int16_t j;
-		if (instr[i] == NULL)
-			j = 0;
-		else
-			j = i;
-
-		const int16_t a = getUsedSamples(i);
-		if (a > 0)
-			currSize64 += INSTR_HEADER_SIZE + (a * sizeof (xmSmpHdr_t));
-		else
-			currSize64 += 22+11;
-
-		instr_t *ins = instr[j];
-		for (int16_t k = 0; k < a; k++)
-		{
-			sample_t* s = &ins->smp[k];
-			if (s->dataPtr != NULL && s->length > 0)
-			{
-				if (s->flags & SAMPLE_16BIT)
-					currSize64 += s->length << 1;
-				else
-					currSize64 += s->length;
-			}
-		}
-	}
+	currSize64 += getInsAndSmpSize(ai, false);
 
 	return currSize64;
 }
 
 static int64_t calculateTrimSize(void)
 {
-	int16_t i, j, k;
-
 	int32_t numChannels = song.numChannels;
-	int32_t pattDataLen = 0;
-	int32_t newPattDataLen = 0;
 	int64_t bytes64 = 0;
-	int64_t oldInstrSize64 = 0;
-
-	// copy over temp data
-	memcpy(tmpPatt, pattern, sizeof (tmpPatt));
-	memcpy(tmpPattLens, patternNumRows, sizeof (tmpPattLens));
-	memcpy(tmpInstrName, song.instrName, sizeof (tmpInstrName));
-
-	if (!setTmpInstruments())
-	{
-		okBox(0, "System message", "Not enough memory!", NULL);
-		return 0;
-	}
-
-	// get current size of all instruments and their samples
-	if (removeInst || removeSamp || removeSmpDataAfterLoop || convSmpsTo8Bit)
-		oldInstrSize64 = getTempInsAndSmpSize();
-
-	// count number of patterns that would be saved
-	int16_t ap = MAX_PATTERNS;
-	do
-	{
-		if (tmpPatternEmpty(ap - 1, numChannels))
-			ap--;
-		else
-			break;
-	}
-	while (ap > 0);
-
-	// count number of instruments that would be saved
-	int16_t ai = MAX_INST;
-	while (ai > 0 && getUsedTempSamples(ai) == 0 && tmpInstrName[ai][0] == '\0')
-		ai--;
-
-	// calculate "remove unused samples" size
-	if (removeSamp) wipeSamplesUnused(true, ai);
 
-	// calculate "remove sample data after loop" size
-	if (removeSmpDataAfterLoop) wipeSmpDataAfterLoop(true, ai);
+	const int16_t ap = getNumPatts(numChannels);
+	const int16_t ai = getNumInstrs();
 
-	// calculate "convert samples to 8-bit" size
-	if (convSmpsTo8Bit) convertSamplesTo8bit(true, ai);
-
-	// get old pattern data length
+	// calculate "remove unused channels" and "remove unused patterns" size
 	if (removeChans || removePatt)
 	{
-		for (i = 0; i < ap; i++)
-		{
-			pattDataLen += sizeof (xmPatHdr_t);
-			if (!tmpPatternEmpty(i, numChannels))
-				pattDataLen += getPackedPattSize(tmpPatt[i], tmpPattLens[i], numChannels);
-		}
-	}
-
-	// calculate "remove unused channels" size
-	if (removeChans)
-	{
-		// get real number of channels
-		int16_t highestChan = -1;
-		for (i = 0; i < ap; i++)
-		{
-			note_t *pattPtr = tmpPatt[i];
-			if (pattPtr == NULL)
-				continue;
-
-			const int16_t numRows = tmpPattLens[i];
-			for (j = 0; j < numRows; j++)
-			{
-				for (k = 0; k < numChannels; k++)
-				{
-					note_t *p = &pattPtr[(j * MAX_CHANNELS) + k];
-					if (p->note > 0 || p->instr > 0 || p->vol > 0 || p->efx > 0 || p->efxData > 0)
-					{
-						if (k > highestChan)
-							highestChan = k;
-					}
-				}
-			}
-		}
-
-		// set new number of channels (and make it an even number)
-		if (highestChan >= 0)
-		{
-			highestChan++;
-			if (highestChan & 1)
-				highestChan++;
+		int32_t pattDataLen = 0;
+		for (int16_t i = 0; i < ap; i++)
+			pattDataLen += getPattDataSize(i, numChannels);
 
-			numChannels = (uint8_t)(CLAMP(highestChan, 2, numChannels));
-		}
-	}
+		if (removeChans)
+			numChannels = getTrimmedNumChannels(ap);
 
-	// calculate "remove unused patterns" size
-	if (removePatt) wipePattsUnused(true, &ap);
+		if (removePatt)
+			markUsedPatts(ap);
+		else
+			memset(pattUsed, true, ap);
 
-	// calculate new pattern data size
-	if (removeChans || removePatt)
-	{
-		for (i = 0; i < ap; i++)
+		int32_t newPattDataLen = 0;
+		for (int16_t i = 0; i < ap; i++)
 		{
-			newPattDataLen += sizeof (xmPatHdr_t);
-			if (!tmpPatternEmpty(i, numChannels))
-				newPattDataLen += getPackedPattSize(tmpPatt[i], tmpPattLens[i], numChannels);
+			if (pattUsed[i])
+				newPattDataLen += getPattDataSize(i, numChannels);
 		}
 
 		assert(pattDataLen >= newPattDataLen);
@@ -810,125 +595,93 @@ static int64_t calculateTrimSize(void)
 		if (pattDataLen > newPattDataLen)
 			bytes64 += (pattDataLen - newPattDataLen);
 	}
+	else
+	{
+		memset(pattUsed, true, ap);
+	}
 
-	// calculate "remove unused instruments" size
-	if (removeInst) wipeInstrUnused(true, &ai, ap, numChannels);
-
-	// calculate new instruments and samples size
+	// calculate "remove unused instruments/samples", "remove sample data after loop" and "convert samples to 8-bit" size
 	if (removeInst || removeSamp || removeSmpDataAfterLoop || convSmpsTo8Bit)
 	{
-		int64_t newInstrSize64 = getTempInsAndSmpSize();
+		const int64_t oldInstrSize64 = getInsAndSmpSize(ai, false);
+
+		if (removeInst)
+			markUsedInstrs(ap);
+
+		const int64_t newInstrSize64 = getInsAndSmpSize(ai, true);
 
 		assert(oldInstrSize64 >= newInstrSize64);
 		if (oldInstrSize64 > newInstrSize64)
 			bytes64 += (oldInstrSize64 - newInstrSize64);
 	}
 
-	freeTmpInstruments();
 	return bytes64;
 }
 
 static int32_t SDLCALL trimThreadFunc(void *ptr)
 {
-	int16_t i, j, k;
-
-	if (!setTmpInstruments())
-	{
-		okBoxThreadSafe(0, "System message", "Not enough memory!", NULL);
-		return true;
-	}
-
 	// audio callback is not running now, so we're safe
 
-	// count number of patterns
-	int16_t ap = MAX_PATTERNS;
-	do
-	{
-		if (patternEmpty(ap - 1))
-			ap--;
-		else
-			break;
-	}
-	while (ap > 0);
+	// don't trust the usage summaries for destructive operations, rebuild them
+	allPattUsageChanged();
 
-	// count number of instruments
-	int16_t ai = MAX_INST;
-	while (ai > 0 && getUsedSamples(ai) == 0 && song.instrName[ai][0] == '\0')
-		ai--;
+	int16_t ap = getNumPatts(MAX_CHANNELS);
+	int16_t ai = getNumInstrs();
 
 	// remove unused samples
 	if (removeSamp)
-		wipeSamplesUnused(false, ai);
+		wipeSamplesUnused(ai);
 
 	// remove sample data after loop
 	if (removeSmpDataAfterLoop)
-		wipeSmpDataAfterLoop(false, ai);
+		wipeSmpDataAfterLoop(ai);
 
 	// convert samples to 8-bit
 	if (convSmpsTo8Bit)
-		convertSamplesTo8bit(false, ai);
+		convertSamplesTo8bit(ai);
 
 	// removed unused channels
 	if (removeChans)
 	{
-		// count used channels
-		int16_t highestChan = -1;
-		for (i = 0; i < ap; i++)
-		{
-			note_t *pattPtr = pattern[i];
-			if (pattPtr == NULL)
-				continue;
-
-			const int16_t numRows = patternNumRows[i];
-			for (j = 0; j < numRows; j++)
-			{
-				for (k = 0; k < song.numChannels; k++)
-				{
-					note_t *p = &pattPtr[(j * MAX_CHANNELS) + k];
-					if (p->note > 0 || p->vol > 0 || p->instr > 0 || p->efx > 0 || p->efxData > 0)
-					{
-						if (k > highestChan)
-							highestChan = k;
-					}
-				}
-			}
-		}
-
-		// set new 'channels used' number
-		if (highestChan >= 0)
-		{
-			highestChan++;
-			if (highestChan & 1)
-				highestChan++;
-
-			song.numChannels = (uint8_t)(CLAMP(highestChan, 2, song.numChannels));
-		}
+		song.numChannels = (uint8_t)getTrimmedNumChannels(ap);
 
 		// clear potentially unused channel data
 		if (song.numChannels < MAX_CHANNELS)
 		{
-			for (i = 0; i < MAX_PATTERNS; i++)
+			for (int16_t i = 0; i < MAX_PATTERNS; i++)
 			{
 				note_t *p = pattern[i];
 				if (p == NULL)
 					continue;
 
 				const int16_t numRows = patternNumRows[i];
-				for (j = 0; j < numRows; j++)
+				for (int16_t j = 0; j < numRows; j++)
 					memset(&p[(j * MAX_CHANNELS) + song.numChannels], 0, sizeof (note_t) * (MAX_CHANNELS - song.numChannels));
 			}
+
+			allPattUsageChanged();
 		}
 	}
 
+	// find used patterns and instruments (before the patterns are relocated)
+	int16_t newUsedPatts = ap;
+	if (removePatt)
+		newUsedPatts = markUsedPatts(ap);
+	else
+		memset(pattUsed, true, ap);
+
+	if (removeInst)
+		markUsedInstrs(ap);
+
 	// clear unused patterns
 	if (removePatt)
-		wipePattsUnused(false, &ap);
+		wipePattsUnused(&ap, newUsedPatts);
 
 	// remove unused instruments
 	if (removeInst)
-		wipeInstrUnused(false, &ai, ap, song.numChannels);
+		wipeInstrUnused(&ai, ap);
 
-	freeTmpInstruments();
+	allPattUsageChanged();
 	editor.trimThreadWasDone = true;
 
 	return true;
@@ -1187,6 +940,8 @@ void pbTrimDoTrim(void)
 	if (okBox(2, "System request", "Are you sure you want to trim the song? Making a backup of the song first is recommended.", NULL) != 1)
 		return;
 
+	clearUndoJournal(); // trimming renumbers patterns/instruments
+
 	mouseAnimOn();
 	pauseAudio();
 
@@ -0,0 +1,925 @@
+// for finding memory leaks in debug mode with Visual Studio
+#if defined _DEBUG && defined _MSC_VER
+#include <crtdbg.h>
+#endif
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ft2_header.h"
+#include "ft2_replayer.h"
+#include "ft2_pattern_ed.h"
+#include "ft2_sample_ed.h"
+#include "ft2_inst_ed.h"
+#include "ft2_sysreqs.h"
+#include "ft2_structs.h"
+#include "ft2_audio.h"
+#include "mixer/ft2_mix.h" // MAX_RIGHT_TAPS
+#include "ft2_undo.h"
+
+#define SPILL_COPY_CHUNK (1024 * 1024)
+
+enum
+{
+	UNDO_PATTERN = 0,
+	UNDO_SAMPLE = 1
+};
+
+enum
+{
+	SWAP_OK = 0,
+	SWAP_INVALID = 1,
+	SWAP_NO_MEMORY = 2,
+	SWAP_IO_ERROR = 3
+};
+
+typedef struct undoCell_t
+{
+	uint8_t pattNum, row, ch;
+	note_t note;
+} undoCell_t;
+
+typedef struct undoPattLen_t
+{
+	int16_t pattNum, numRows;
+} undoPattLen_t;
+
+typedef struct undoStep_t
+{
+	uint8_t type;
+	bool onDisk;
+	uint8_t *data; // NULL if on disk
+	int32_t dataSize;
+	long diskOffset;
+
+	// UNDO_PATTERN: data = undoPattLen_t[numLens] followed by undoCell_t[numCells]
+	int32_t numLens, numCells;
+
+	// UNDO_SAMPLE: data = the other version of the edited sample range
+	int16_t insNum, smpNum;
+	int32_t prefixLen, suffixLen; // unchanged sample points before/after the edited range
+	uint8_t hdrFields; // the SMP_HDR_* fields that the edit changed, the rest of otherSmp's header isn't applied
+	uint32_t curVersion, otherVersion;
+	sample_t otherSmp; // the other version's header (no data pointers)
+} undoStep_t;
+
+static bool applyingStep;
+static int32_t numSteps, undoPos; // steps below undoPos can be undone, the rest can be redone
+static int64_t memUsed;
+static long spillFileLen;
+static uint32_t versionCounter;
+static FILE *spillFile;
+static SDL_mutex *journalMutex;
+static undoStep_t *steps[MAX_UNDO_STEPS];
+
+/* The last journaled state of every sample slot. If the data generation doesn't
+** match anymore, the sample was replaced outside of the journal (loaded,
+** sampled, drawn etc.), and the steps for that slot can't be applied.
+** (not the data pointer, the allocator can hand out the same address again)
+*/
+static uint32_t slotDataGen[MAX_INST+1][MAX_SMP_PER_INST];
+static uint32_t slotVersion[MAX_INST+1][MAX_SMP_PER_INST];
+
+static bool anyStepOnDisk(void)
+{
+	for (int32_t i = 0; i < numSteps; i++)
+	{
+		if (steps[i]->onDisk)
+			return true;
+	}
+
+	return false;
+}
+
+static void dropStep(int32_t index)
+{
+	undoStep_t *step = steps[index];
+
+	if (step->data != NULL)
+	{
+		memUsed -= step->dataSize;
+		free(step->data);
+	}
+	free(step);
+
+	memmove(&steps[index], &steps[index+1], (numSteps - (index+1)) * sizeof (undoStep_t *));
+	numSteps--;
+
+	if (index < undoPos)
+		undoPos--;
+
+	if (!anyStepOnDisk())
+		spillFileLen = 0; // all of the temp file is unused now
+}
+
+static bool copyFileData(FILE *dst, long dstOffset, FILE *src, long srcOffset, int32_t length, uint8_t *buffer)
+{
+	while (length > 0)
+	{
+		const int32_t bytes = MIN(length, SPILL_COPY_CHUNK);
+
+		if (fseek(src, srcOffset, SEEK_SET) != 0 || fread(buffer, 1, bytes, src) != (size_t)bytes)
+			return false;
+
+		if (fseek(dst, dstOffset, SEEK_SET) != 0 || fwrite(buffer, 1, bytes, dst) != (size_t)bytes)
+			return false;
+
+		srcOffset += bytes;
+		dstOffset += bytes;
+		length -= bytes;
+	}
+
+	return true;
+}
+
+// rewrites the temp file without the space used by dropped/reloaded steps
+static void compactSpillFile(void)
+{
+	long newOffsets[MAX_UNDO_STEPS];
+
+	uint8_t *buffer = (uint8_t *)malloc(SPILL_COPY_CHUNK);
+	if (buffer == NULL)
+		return;
+
+	FILE *f = tmpfile();
+	if (f == NULL)
+	{
+		free(buffer);
+		return;
+	}
+
+	long newLength = 0;
+	for (int32_t i = 0; i < numSteps; i++)
+	{
+		undoStep_t *step = steps[i];
+		if (!step->onDisk)
+			continue;
+
+		if (!copyFileData(f, newLength, spillFile, step->diskOffset, step->dataSize, buffer))
+		{
+			fclose(f);
+			free(buffer);
+			return;
+		}
+
+		newOffsets[i] = newLength;
+		newLength += step->dataSize;
+	}
+
+	for (int32_t i = 0; i < numSteps; i++)
+	{
+		if (steps[i]->onDisk)
+			steps[i]->diskOffset = newOffsets[i];
+	}
+
+	fclose(spillFile);
+	spillFile = f;
+	spillFileLen = newLength;
+
+	free(buffer);
+}
+
+static bool spillStep(undoStep_t *step)
+{
+	if (step->data == NULL || step->dataSize <= 0)
+		return false;
+
+	if (spillFile == NULL)
+	{
+		spillFile = tmpfile();
+		if (spillFile == NULL)
+			return false;
+
+		spillFileLen = 0;
+	}
+
+	if ((int64_t)spillFileLen+step->dataSize > UNDO_DISK_LIMIT)
+	{
+		compactSpillFile();
+		if ((int64_t)spillFileLen+step->dataSize > UNDO_DISK_LIMIT)
+			return false;
+	}
+
+	if (fseek(spillFile, spillFileLen, SEEK_SET) != 0 || fwrite(step->data, 1, step->dataSize, spillFile) != (size_t)step->dataSize)
+		return false;
+
+	step->diskOffset = spillFileLen;
+	spillFileLen += step->dataSize;
+
+	free(step->data);
+	step->data = NULL;
+	step->onDisk = true;
+	memUsed -= step->dataSize;
+
+	return true;
+}
+
+static bool loadStep(undoStep_t *step)
+{
+	if (!step->onDisk)
+		return true;
+
+	uint8_t *data = (uint8_t *)malloc(step->dataSize);
+	if (data == NULL)
+		return false;
+
+	if (fseek(spillFile, step->diskOffset, SEEK_SET) != 0 || fread(data, 1, step->dataSize, spillFile) != (size_t)step->dataSize)
+	{
+		free(data);
+		return false;
+	}
+
+	step->data = data;
+	step->onDisk = false;
+	memUsed += step->dataSize;
+
+	return true;
+}
+
+static void enforceMemLimit(void)
+{
+	while (memUsed > UNDO_MEM_LIMIT && numSteps > 0)
+	{
+		// move the oldest step that is still in RAM to the temp file
+		int32_t i;
+		for (i = 0; i < numSteps; i++)
+		{
+			if (steps[i]->data != NULL && steps[i]->dataSize > 0)
+				break;
+		}
+
+		if (i == numSteps)
+			break;
+
+		if (!spillStep(steps[i]))
+		{
+			// no temp file (or it's full), forget the oldest step instead
+			dropStep((undoPos > 0) ? 0 : numSteps-1);
+		}
+	}
+}
+
+static void addStep(undoStep_t *step)
+{
+	// a new edit ends the redo history
+	while (numSteps > undoPos)
+		dropStep(numSteps-1);
+
+	if (numSteps == MAX_UNDO_STEPS)
+		dropStep(0);
+
+	steps[numSteps++] = step;
+	undoPos = numSteps;
+	memUsed += step->dataSize;
+
+	enforceMemLimit();
+}
+
+bool initUndoJournal(void)
+{
+	journalMutex = SDL_CreateMutex();
+	return (journalMutex != NULL);
+}
+
+void clearUndoJournal(void)
+{
+	if (journalMutex == NULL)
+		return;
+
+	SDL_LockMutex(journalMutex);
+
+	while (numSteps > 0)
+		dropStep(numSteps-1);
+
+	undoPos = 0;
+	memUsed = 0;
+
+	if (spillFile != NULL)
+	{
+		fclose(spillFile);
+		spillFile = NULL;
+	}
+	spillFileLen = 0;
+
+	memset(slotDataGen, 0, sizeof (slotDataGen));
+	memset(slotVersion, 0, sizeof (slotVersion));
+
+	SDL_UnlockMutex(journalMutex);
+}
+
+void freeUndoJournal(void)
+{
+	clearUndoJournal();
+
+	if (journalMutex != NULL)
+	{
+		SDL_DestroyMutex(journalMutex);
+		journalMutex = NULL;
+	}
+}
+
+// ----- PATTERN EDITS -----
+
+void undoPattBegin(undoPattSnap_t *snap, int32_t pattNum)
+{
+	memset(snap, 0, sizeof (undoPattSnap_t));
+
+	if (pattNum < 0)
+	{
+		for (int32_t i = 0; i < MAX_PATTERNS; i++)
+			undoPattAdd(snap, i);
+	}
+	else
+	{
+		undoPattAdd(snap, pattNum);
+	}
+}
+
+void undoPattAdd(undoPattSnap_t *snap, int32_t pattNum)
+{
+	if (pattNum < 0 || pattNum >= MAX_PATTERNS || snap->taken[pattNum])
+		return;
+
+	snap->taken[pattNum] = true;
+	snap->numRows[pattNum] = patternNumRows[pattNum];
+
+	if (pattern[pattNum] != NULL)
+	{
+		snap->data[pattNum] = (note_t *)malloc(MAX_PATT_LEN * TRACK_WIDTH);
+		if (snap->data[pattNum] == NULL)
+		{
+			snap->failed = true;
+			return;
+		}
+
+		memcpy(snap->data[pattNum], pattern[pattNum], MAX_PATT_LEN * TRACK_WIDTH);
+	}
+}
+
+// returns the number of changed cells, and stores them (with the old note) if 'cells' is not NULL
+static int32_t diffPattern(const undoPattSnap_t *snap, int32_t pattNum, undoCell_t *cells)
+{
+	static const note_t emptyRow[MAX_CHANNELS];
+
+	const note_t *oldPatt = snap->data[pattNum];
+	const note_t *newPatt = pattern[pattNum];
+	if (oldPatt == NULL && newPatt == NULL)
+		return 0;
+
+	int32_t numCells = 0;
+	for (int32_t row = 0; row < MAX_PATT_LEN; row++)
+	{
+		const note_t *oldRow = (oldPatt == NULL) ? emptyRow : &oldPatt[row * MAX_CHANNELS];
+		const note_t *newRow = (newPatt == NULL) ? emptyRow : &newPatt[row * MAX_CHANNELS];
+
+		if (memcmp(oldRow, newRow, TRACK_WIDTH) == 0)
+			continue;
+
+		for (int32_t ch = 0; ch < MAX_CHANNELS; ch++)
+		{
+			if (memcmp(&oldRow[ch], &newRow[ch], sizeof (note_t)) == 0)
+				continue;
+
+			if (cells != NULL)
+			{
+				cells[numCells].pattNum = (uint8_t)pattNum;
+				cells[numCells].row = (uint8_t)row;
+				cells[numCells].ch = (uint8_t)ch;
+				cells[numCells].note = oldRow[ch];
+			}
+
+			numCells++;
+		}
+	}
+
+	return numCells;
+}
+
+void undoPattEnd(undoPattSnap_t *snap)
+{
+	int32_t numLens = 0, numCells = 0;
+
+	if (!snap->failed && journalMutex != NULL)
+	{
+		for (int32_t i = 0; i < MAX_PATTERNS; i++)
+		{
+			if (!snap->taken[i])
+				continue;
+
+			if (snap->numRows[i] != patternNumRows[i])
+				numLens++;
+
+			numCells += diffPattern(snap, i, NULL);
+		}
+	}
+
+	if (numLens+numCells > 0)
+	{
+		undoStep_t *step = (undoStep_t *)calloc(1, sizeof (undoStep_t));
+		if (step != NULL)
+		{
+			step->type = UNDO_PATTERN;
+			step->numLens = numLens;
+			step->numCells = numCells;
+			step->dataSize = (numLens * sizeof (undoPattLen_t)) + (numCells * sizeof (undoCell_t));
+			step->data = (uint8_t *)malloc(step->dataSize);
+
+			if (step->data == NULL)
+			{
+				free(step);
+			}
+			else
+			{
+				undoPattLen_t *lens = (undoPattLen_t *)step->data;
+				undoCell_t *cells = (undoCell_t *)&step->data[numLens * sizeof (undoPattLen_t)];
+
+				for (int32_t i = 0; i < MAX_PATTERNS; i++)
+				{
+					if (!snap->taken[i])
+						continue;
+
+					if (snap->numRows[i] != patternNumRows[i])
+					{
+						lens->pattNum = (int16_t)i;
+						lens->numRows = snap->numRows[i];
+						lens++;
+					}
+
+					cells += diffPattern(snap, i, cells);
+				}
+
+				SDL_LockMutex(journalMutex);
+				addStep(step);
+				SDL_UnlockMutex(journalMutex);
+			}
+		}
+	}
+
+	for (int32_t i = 0; i < MAX_PATTERNS; i++)
+	{
+		if (snap->data[i] != NULL)
+		{
+			free(snap->data[i]);
+			snap->data[i] = NULL;
+		}
+	}
+}
+
+static int32_t swapPattStep(undoStep_t *step)
+{
+	bool touched[MAX_PATTERNS];
+
+	undoPattLen_t *lens = (undoPattLen_t *)step->data;
+	undoCell_t *cells = (undoCell_t *)&step->data[step->numLens * sizeof (undoPattLen_t)];
+
+	memset(touched, 0, sizeof (touched));
+	for (int32_t i = 0; i < step->numLens; i++)
+		touched[lens[i].pattNum] = true;
+
+	for (int32_t i = 0; i < step->numCells; i++)
+		touched[cells[i].pattNum] = true;
+
+	// allocate first, so that nothing is changed if we run out of memory
+	for (int32_t i = 0; i < MAX_PATTERNS; i++)
+	{
+		if (touched[i] && !allocatePattern((uint16_t)i))
+		{
+			for (int32_t j = 0; j < i; j++)
+			{
+				if (touched[j])
+					killPatternIfUnused((uint16_t)j);
+			}
+
+			return SWAP_NO_MEMORY;
+		}
+	}
+
+	pauseMusic();
+	for (int32_t i = 0; i < step->numCells; i++)
+	{
+		undoCell_t *c = &cells[i];
+		note_t *p = &pattern[c->pattNum][(c->row * MAX_CHANNELS) + c->ch];
+
+		const note_t tmpNote = *p;
+		*p = c->note;
+		c->note = tmpNote;
+	}
+	resumeMusic();
+
+	for (int32_t i = 0; i < step->numLens; i++)
+	{
+		const int16_t pattNum = lens[i].pattNum;
+		const int16_t numRows = patternNumRows[pattNum];
+
+		if (pattNum == editor.editPattern)
+		{
+			setPatternLen(pattNum, lens[i].numRows); // also clamps the cursor/mark
+		}
+		else
+		{
+			lockAudio();
+			patternNumRows[pattNum] = lens[i].numRows;
+			pattUsageChanged(pattNum);
+			unlockAudio();
+		}
+
+		lens[i].numRows = numRows;
+	}
+
+	for (int32_t i = 0; i < MAX_PATTERNS; i++)
+	{
+		if (touched[i])
+			killPatternIfUnused((uint16_t)i); // also flags the pattern usage as changed
+	}
+
+	return SWAP_OK;
+}
+
+// ----- SAMPLE EDITS -----
+
+static bool findSmpSlot(const sample_t *s, int16_t *insNum, int16_t *smpNum)
+{
+	for (int16_t i = 1; i <= MAX_INST; i++)
+	{
+		if (instr[i] == NULL)
+			continue;
+
+		for (int16_t j = 0; j < MAX_SMP_PER_INST; j++)
+		{
+			if (&instr[i]->smp[j] == s)
+			{
+				*insNum = i;
+				*smpNum = j;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static void stripSmpHeader(sample_t *dst, const sample_t *src)
+{
+	*dst = *src;
+	dst->dataPtr = dst->origDataPtr = NULL;
+	dst->dataGen = 0;
+	dst->isFixed = false;
+	dst->fixedPos = 0;
+
+	if (src->dataPtr == NULL)
+		dst->length = 0;
+}
+
+// the SMP_HDR_* fields in 'hdrFields' that differ between the headers
+static uint8_t changedHdrFields(const sample_t *a, const sample_t *b, uint8_t hdrFields)
+{
+	uint8_t changed = 0;
+
+	if (strcmp(a->name, b->name))           changed |= SMP_HDR_NAME;
+	if (a->volume != b->volume)             changed |= SMP_HDR_VOLUME;
+	if (a->panning != b->panning)           changed |= SMP_HDR_PANNING;
+	if (a->finetune != b->finetune)         changed |= SMP_HDR_FINETUNE;
+	if (a->relativeNote != b->relativeNote) changed |= SMP_HDR_RELNOTE;
+
+	return changed & hdrFields;
+}
+
+static bool smpDataHeadersEqual(const sample_t *a, const sample_t *b)
+{
+	return a->flags == b->flags && a->length == b->length && a->loopStart == b->loopStart && a->loopLength == b->loopLength;
+}
+
+// copies sample points, with the ones that fixSample() replaced restored
+static void copyUnfixedSmpData(int8_t *dst, const sample_t *s, int32_t pos, int32_t length)
+{
+	if (length <= 0)
+		return;
+
+	const bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
+	memcpy(dst, &s->dataPtr[(size_t)pos << sample16Bit], (size_t)length << sample16Bit);
+
+	if (!s->isFixed)
+		return;
+
+	for (int32_t i = 0; i < MAX_RIGHT_TAPS; i++)
+	{
+		const int32_t fixedPos = s->fixedPos + i;
+		if (fixedPos < pos || fixedPos >= pos+length || fixedPos >= s->length)
+			continue;
+
+		if (sample16Bit)
+			((int16_t *)dst)[fixedPos-pos] = s->fixedSmp[i];
+		else
+			dst[fixedPos-pos] = (int8_t)s->fixedSmp[i];
+	}
+}
+
+static int32_t equalPrefixBytes(const int8_t *a, const int8_t *b, int32_t numBytes)
+{
+	int32_t i = 0;
+	while (i < numBytes)
+	{
+		const int32_t bytes = MIN(numBytes - i, 4096);
+		if (memcmp(&a[i], &b[i], bytes) != 0)
+			break;
+
+		i += bytes;
+	}
+
+	while (i < numBytes && a[i] == b[i])
+		i++;
+
+	return i;
+}
+
+// 'aEnd' and 'bEnd' point past the last byte
+static int32_t equalSuffixBytes(const int8_t *aEnd, const int8_t *bEnd, int32_t numBytes)
+{
+	int32_t i = 0;
+	while (i < numBytes)
+	{
+		const int32_t bytes = MIN(numBytes - i, 4096);
+		if (memcmp(aEnd - i - bytes, bEnd - i - bytes, bytes) != 0)
+			break;
+
+		i += bytes;
+	}
+
+	while (i < numBytes && aEnd[-1-i] == bEnd[-1-i])
+		i++;
+
+	return i;
+}
+
+void undoRecordSmpEdit(const sample_t *s, const sample_t *editSmp, uint8_t hdrFields)
+{
+	int16_t insNum, smpNum;
+	sample_t oldHdr, newHdr;
+
+	if (journalMutex == NULL)
+		return;
+
+	SDL_LockMutex(journalMutex);
+
+	if (applyingStep || !findSmpSlot(s, &insNum, &smpNum))
+	{
+		SDL_UnlockMutex(journalMutex);
+		return;
+	}
+
+	stripSmpHeader(&oldHdr, s);
+	stripSmpHeader(&newHdr, editSmp);
+
+	const bool old16Bit = !!(oldHdr.flags & SAMPLE_16BIT);
+	const bool new16Bit = !!(newHdr.flags & SAMPLE_16BIT);
+	const int32_t oldLen = oldHdr.length;
+	const int32_t newLen = newHdr.length;
+
+	// find the unchanged start and end of the sample data, only the range between them is stored
+	int32_t prefixLen = 0, suffixLen = 0;
+	if (old16Bit == new16Bit && oldLen > 0 && newLen > 0)
+	{
+		const int32_t minLen = MIN(oldLen, newLen);
+
+		prefixLen = equalPrefixBytes(s->dataPtr, editSmp->dataPtr, minLen << old16Bit) >> old16Bit;
+		suffixLen = equalSuffixBytes(&s->dataPtr[oldLen << old16Bit], &editSmp->dataPtr[newLen << new16Bit],
+			(minLen - prefixLen) << old16Bit) >> old16Bit;
+
+		if (s->isFixed) // the fixed sample points aren't the real data, keep them in the stored range
+		{
+			const int32_t fixedEnd = MIN(s->fixedPos + MAX_RIGHT_TAPS, oldLen);
+
+			prefixLen = MIN(prefixLen, s->fixedPos);
+			suffixLen = MIN(suffixLen, oldLen - fixedEnd);
+		}
+	}
+
+	const int32_t oldMidLen = oldLen - (prefixLen + suffixLen);
+	const int32_t newMidLen = newLen - (prefixLen + suffixLen);
+
+	hdrFields = changedHdrFields(&oldHdr, &newHdr, hdrFields);
+	if (oldMidLen == 0 && newMidLen == 0 && hdrFields == 0 && smpDataHeadersEqual(&oldHdr, &newHdr))
+	{
+		SDL_UnlockMutex(journalMutex);
+		return; // nothing was changed
+	}
+
+	undoStep_t *step = (undoStep_t *)calloc(1, sizeof (undoStep_t));
+	if (step == NULL)
+	{
+		SDL_UnlockMutex(journalMutex);
+		return;
+	}
+
+	step->dataSize = oldMidLen << old16Bit;
+	if (step->dataSize > 0)
+	{
+		step->data = (uint8_t *)malloc(step->dataSize);
+		if (step->data == NULL)
+		{
+			free(step);
+			SDL_UnlockMutex(journalMutex);
+			return;
+		}
+
+		copyUnfixedSmpData((int8_t *)step->data, s, prefixLen, oldMidLen);
+	}
+
+	step->type = UNDO_SAMPLE;
+	step->insNum = insNum;
+	step->smpNum = smpNum;
+	step->prefixLen = prefixLen;
+	step->suffixLen = suffixLen;
+	step->hdrFields = hdrFields;
+	step->otherSmp = oldHdr;
+
+	// give the state before the edit a new version if the sample was replaced outside of the journal
+	if (slotDataGen[insNum][smpNum] != s->dataGen || slotVersion[insNum][smpNum] == 0)
+		slotVersion[insNum][smpNum] = ++versionCounter;
+
+	step->otherVersion = slotVersion[insNum][smpNum];
+	step->curVersion = ++versionCounter;
+
+	slotVersion[insNum][smpNum] = step->curVersion;
+	slotDataGen[insNum][smpNum] = editSmp->dataGen; // the sample has this data generation after commitSmpEdit()
+
+	addStep(step);
+
+	SDL_UnlockMutex(journalMutex);
+}
+
+static int32_t swapSmpStep(undoStep_t *step)
+{
+	const int16_t insNum = step->insNum;
+	const int16_t smpNum = step->smpNum;
+
+	if (instr[insNum] == NULL)
+		return SWAP_INVALID;
+
+	sample_t *s = &instr[insNum]->smp[smpNum];
+	if (s->dataGen != slotDataGen[insNum][smpNum] || slotVersion[insNum][smpNum] != step->curVersion)
+		return SWAP_INVALID;
+
+	const bool cur16Bit = !!(s->flags & SAMPLE_16BIT);
+	const bool other16Bit = !!(step->otherSmp.flags & SAMPLE_16BIT);
+	const int32_t prefixLen = step->prefixLen;
+	const int32_t suffixLen = step->suffixLen;
+	const int32_t curLen = (s->dataPtr == NULL) ? 0 : s->length;
+	const int32_t otherLen = step->otherSmp.length;
+	const int32_t curMidLen = curLen - (prefixLen + suffixLen);
+	const int32_t otherMidLen = otherLen - (prefixLen + suffixLen);
+
+	if (curMidLen < 0 || otherMidLen < 0 || (otherMidLen << other16Bit) != step->dataSize)
+		return SWAP_INVALID;
+
+	// the current version of the edited range, this step holds it after the swap
+	int8_t *curMid = NULL;
+	const int32_t curMidSize = curMidLen << cur16Bit;
+	if (curMidSize > 0)
+	{
+		curMid = (int8_t *)malloc(curMidSize);
+		if (curMid == NULL)
+			return SWAP_NO_MEMORY;
+
+		copyUnfixedSmpData(curMid, s, prefixLen, curMidLen);
+	}
+
+	sample_t newSmp = step->otherSmp;
+	if (otherLen > 0)
+	{
+		if (!allocateSmpData(&newSmp, otherLen, other16Bit))
+		{
+			if (curMid != NULL)
+				free(curMid);
+
+			return SWAP_NO_MEMORY;
+		}
+
+		copyUnfixedSmpData(newSmp.dataPtr, s, 0, prefixLen);
+		if (step->dataSize > 0)
+			memcpy(&newSmp.dataPtr[prefixLen << other16Bit], step->data, step->dataSize);
+		copyUnfixedSmpData(&newSmp.dataPtr[(otherLen - suffixLen) << other16Bit], s, curLen - suffixLen, suffixLen);
+	}
+
+	stripSmpHeader(&step->otherSmp, s);
+
+	if (step->data != NULL)
+		free(step->data);
+
+	memUsed += curMidSize - step->dataSize;
+	step->data = (uint8_t *)curMid;
+	step->dataSize = curMidSize;
+
+	// only the header fields that the edit changed, the others may have been changed by the user since
+	commitSmpEditHdr(s, &newSmp, step->hdrFields);
+
+	const uint32_t version = step->curVersion;
+	step->curVersion = step->otherVersion;
+	step->otherVersion = version;
+
+	slotVersion[insNum][smpNum] = step->curVersion;
+	slotDataGen[insNum][smpNum] = s->dataGen;
+
+	return SWAP_OK;
+}
+
+// ----- UNDO/REDO -----
+
+static void applyStep(bool undo)
+{
+	if (journalMutex == NULL)
+		return;
+
+	SDL_LockMutex(journalMutex);
+
+	if ((undo && undoPos == 0) || (!undo && undoPos == numSteps))
+	{
+		SDL_UnlockMutex(journalMutex);
+		return; // nothing to undo/redo
+	}
+
+	const int32_t index = undo ? (undoPos - 1) : undoPos;
+	undoStep_t *step = steps[index];
+
+	const uint8_t type = step->type;
+	const int16_t insNum = step->insNum;
+	const int16_t smpNum = step->smpNum;
+
+	int32_t result;
+	if (!loadStep(step))
+	{
+		result = step->onDisk ? SWAP_IO_ERROR : SWAP_NO_MEMORY;
+	}
+	else
+	{
+		applyingStep = true;
+		result = (type == UNDO_PATTERN) ? swapPattStep(step) : swapSmpStep(step);
+		applyingStep = false;
+	}
+
+	if (result == SWAP_OK)
+	{
+		undoPos += undo ? -1 : 1;
+		enforceMemLimit();
+	}
+	else if (result == SWAP_INVALID)
+	{
+		dropStep(index); // the sample was replaced by something else, this step can't be used anymore
+	}
+
+	SDL_UnlockMutex(journalMutex);
+
+	switch (result)
+	{
+		case SWAP_OK:
+		{
+			if (type == UNDO_PATTERN)
+			{
+				ui.updatePatternEditor = true;
+				ui.updatePosSections = true;
+			}
+			else if (insNum == editor.curInstr && smpNum == editor.curSmp)
+			{
+				updateNewSample();
+			}
+			else if (ui.instrSwitcherShown)
+			{
+				updateInstrumentSwitcher();
+			}
+
+			setSongModifiedFlag();
+		}
+		break;
+
+		case SWAP_INVALID:
+		{
+			if (undo)
+				okBox(0, "System message", "Can't undo, the sample was replaced after the edit!", NULL);
+			else
+				okBox(0, "System message", "Can't redo, the sample was replaced after the undo!", NULL);
+		}
+		break;
+
+		case SWAP_NO_MEMORY:
+			okBox(0, "System message", "Not enough memory!", NULL);
+		break;
+
+		case SWAP_IO_ERROR:
+			okBox(0, "System message", "General I/O error while reading the undo data!", NULL);
+		break;
+
+		default: break;
+	}
+}
+
+void undoEdit(void)
+{
+	applyStep(true);
+}
+
+void redoEdit(void)
+{
+	applyStep(false);
+}
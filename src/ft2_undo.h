@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ft2_replayer.h"
+
+/* Undo/redo journal for pattern and sample edits.
+**
+** Every step only stores what the edit changed: the changed pattern cells,
+** or the changed middle part of a sample (the unchanged start/end is kept
+** by the sample itself). Undoing swaps the stored data with the current
+** data, so the same step is then a redo step. Steps are moved to a temp
+** file when the journal uses more than UNDO_MEM_LIMIT bytes of RAM.
+*/
+
+#define MAX_UNDO_STEPS 256
+#define UNDO_MEM_LIMIT (64 * 1024 * 1024)
+#define UNDO_DISK_LIMIT (1024 * 1024 * 1024)
+
+// pattern state before an edit (filled by undoPattBegin(), freed by undoPattEnd())
+typedef struct undoPattSnap_t
+{
+	bool taken[MAX_PATTERNS], failed;
+	int16_t numRows[MAX_PATTERNS];
+	note_t *data[MAX_PATTERNS]; // NULL = pattern was empty
+} undoPattSnap_t;
+
+bool initUndoJournal(void);
+void freeUndoJournal(void);
+void clearUndoJournal(void); // call when the song/instruments are replaced
+
+/* Wrap pattern edits in these. pattNum -1 takes all patterns (song-wide edits),
+** undoPattAdd() takes one more pattern if the edit turns out to touch it.
+*/
+void undoPattBegin(undoPattSnap_t *snap, int32_t pattNum);
+void undoPattAdd(undoPattSnap_t *snap, int32_t pattNum);
+void undoPattEnd(undoPattSnap_t *snap);
+
+// called by commitSmpEdit() before the edited copy is swapped in (editSmp is not fixed yet), hdrFields = SMP_HDR_*
+void undoRecordSmpEdit(const sample_t *s, const sample_t *editSmp, uint8_t hdrFields);
+
+void undoEdit(void);
+void redoEdit(void);
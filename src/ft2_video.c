@@ -48,6 +48,11 @@ video_t video; // globalized
 static bool songIsModified;
 static char wndTitle[256];
 static sprite_t sprites[SPRITE_NUM];
+static uint32_t paletteLUT[256]; // all 256 entries, so that a bad pixel value can't read out of bounds
+
+// true-color layer (only used by the About screen), shown where the framebuffer is PAL_TRUECOL
+static const uint32_t *trueColorLayer;
+static int32_t trueColorX, trueColorY, trueColorW, trueColorH;
 
 // for FPS counter
 #define FPS_LINES 15
@@ -58,7 +63,8 @@ static sprite_t sprites[SPRITE_NUM];
 #define FPS_RENDER_Y 2
 
 static char fpsTextBuf[1024];
-static uint64_t frameStartTime;
+static uint32_t framesRendered;
+static uint64_t frameStartTime, uiTickTime64, uiTickDuration64;
 static double dRunningFrameDuration, dAvgFPS;
 // ------------------
 
@@ -67,6 +73,7 @@ static void drawReplayerData(void);
 void resetFPSCounter(void)
 {
 	editor.framesPassed = 0;
+	framesRendered = 0;
 	fpsTextBuf[0] = '\0';
 	dRunningFrameDuration = 1000.0 / VBLANK_HZ;
 }
@@ -83,7 +90,7 @@ static void drawFPSCounter(void)
 
 	SDL_GetVersion(&SDLVer);
 
-	if (editor.framesPassed >= FPS_SCAN_FRAMES && (editor.framesPassed % FPS_SCAN_FRAMES) == 0)
+	if (framesRendered >= FPS_SCAN_FRAMES && (framesRendered % FPS_SCAN_FRAMES) == 0)
 	{
 		dAvgFPS = 1000.0 / (dRunningFrameDuration / FPS_SCAN_FRAMES);
 		if (dAvgFPS < 0.0 || dAvgFPS > 99999999.9999)
@@ -99,7 +106,7 @@ static void drawFPSCounter(void)
 	hLineDouble(FPS_RENDER_X+1, FPS_RENDER_Y+FPS_RENDER_H+2, FPS_RENDER_W, PAL_FORGRND);
 
 	// if enough frame data isn't collected yet, show a message
-	if (editor.framesPassed < FPS_SCAN_FRAMES)
+	if (framesRendered < FPS_SCAN_FRAMES)
 	{
 		const char *text = "Gathering frame information...";
 		const uint16_t textW = textWidth(text);
@@ -115,7 +122,7 @@ static void drawFPSCounter(void)
 	             "SDL version: %u.%u.%u\n" \
 	             "Frames per second: %.3f\n" \
 	             "Monitor refresh rate: %.1fHz (+/-)\n" \
-	             "59..61Hz GPU VSync used: %s\n" \
+	             "GPU VSync used: %s (%.1fHz target)\n" \
 	             "HPC frequency (timer): %.4fMHz\n" \
 	             "Audio frequency: %.1fkHz (expected %.1fkHz)\n" \
 	             "Audio buffer samples: %d (expected %d)\n" \
@@ -130,7 +137,7 @@ static void drawFPSCounter(void)
 	             SDLVer.major, SDLVer.minor, SDLVer.patch,
 	             dAvgFPS,
 	             dRefreshRate,
-	             video.vsync60HzPresent ? "yes" : "no",
+	             video.vsyncPresent ? "yes" : "no", video.dFrameRateHz,
 	             hpcFreq.freq64 / (1000.0 * 1000.0),
 	             audio.haveFreq / 1000.0, audio.wantFreq / 1000.0,
 	             audio.haveSamples, audio.wantSamples,
@@ -167,7 +174,7 @@ static void drawFPSCounter(void)
 	const uint16_t symbolEnd = 115;
 
 	// ping-pong movement
-	uint16_t x = editor.framesPassed % (symbolEnd * 2);
+	uint16_t x = framesRendered % (symbolEnd * 2);
 	if (x >= symbolEnd)
 		x = (symbolEnd * 2) - x;
 
@@ -186,6 +193,66 @@ void endFPSCounter(void)
 	}
 }
 
+void setTrueColorLayer(const uint32_t *buffer, int32_t x, int32_t y, int32_t w, int32_t h)
+{
+	assert(buffer == NULL || (x >= 0 && y >= 0 && x+w <= SCREEN_W && y+h <= SCREEN_H));
+
+	trueColorLayer = buffer;
+	trueColorX = x;
+	trueColorY = y;
+	trueColorW = w;
+	trueColorH = h;
+}
+
+/* The GUI draws palette indices into video.frameBuffer (1 byte per pixel),
+** here they are expanded to ARGB straight into the texture. Palette changes
+** are therefore free, they show up on the next frame without a redraw.
+** There is no byte gather in SSE2, so this is a plain (unrolled) table lookup.
+*/
+static void expandFrameBuffer(void)
+{
+	void *pixels;
+	int32_t pitch;
+
+	memcpy(paletteLUT, video.palette, sizeof (video.palette));
+
+	if (SDL_LockTexture(video.texture, NULL, &pixels, &pitch) != 0)
+		return;
+
+	const uint8_t *src8 = video.frameBuffer;
+	uint32_t *dst32 = (uint32_t *)pixels;
+
+	for (int32_t y = 0; y < SCREEN_H; y++)
+	{
+		for (int32_t x = 0; x < SCREEN_W; x += 8) // SCREEN_W is a multiple of 8
+		{
+			dst32[x+0] = paletteLUT[src8[x+0]];
+			dst32[x+1] = paletteLUT[src8[x+1]];
+			dst32[x+2] = paletteLUT[src8[x+2]];
+			dst32[x+3] = paletteLUT[src8[x+3]];
+			dst32[x+4] = paletteLUT[src8[x+4]];
+			dst32[x+5] = paletteLUT[src8[x+5]];
+			dst32[x+6] = paletteLUT[src8[x+6]];
+			dst32[x+7] = paletteLUT[src8[x+7]];
+		}
+
+		if (trueColorLayer != NULL && y >= trueColorY && y < trueColorY+trueColorH)
+		{
+			const uint32_t *layer32 = &trueColorLayer[(y - trueColorY) * trueColorW];
+			for (int32_t x = 0; x < trueColorW; x++)
+			{
+				if (src8[trueColorX+x] == PAL_TRUECOL)
+					dst32[trueColorX+x] = layer32[x];
+			}
+		}
+
+		src8 += SCREEN_W;
+		dst32 = (uint32_t *)((uint8_t *)dst32 + pitch);
+	}
+
+	SDL_UnlockTexture(video.texture);
+}
+
 void flipFrame(void)
 {
 	const uint32_t windowFlags = SDL_GetWindowFlags(video.window);
@@ -196,7 +263,7 @@ void flipFrame(void)
 	if (video.showFPSCounter)
 		drawFPSCounter();
 
-	SDL_UpdateTexture(video.texture, NULL, video.frameBuffer, SCREEN_W * sizeof (int32_t));
+	expandFrameBuffer();
 
 	// SDL 2.0.14 bug on Windows (?): This function consumes ever-increasing memory if the program is minimized
 	if (!minimized)
@@ -211,9 +278,9 @@ void flipFrame(void)
 
 	eraseSprites();
 
-	if (!video.vsync60HzPresent)
+	if (!video.vsyncPresent)
 	{
-		// we have no VSync, do crude thread sleeping to sync to ~60Hz
+		// we have no VSync, do crude thread sleeping to sync to ~60Hz (or the display's refresh rate)
 		hpc_Wait(&video.vblankHpc);
 	}
 	else
@@ -239,7 +306,30 @@ void flipFrame(void)
 #endif
 	}
 
-	editor.framesPassed++;
+	framesRendered++;
+
+	/* UI logic that counts frames (button repeat, text cursor blinking, About screen,
+	** Nibbles etc.) is timed for 60Hz. When presenting at a higher refresh rate, only
+	** run it when a 60Hz tick (derived from the performance counter) has passed.
+	** Things synced to the audio (pattern/position display, scopes) are timestamp
+	** driven and get updated on every frame. At 60Hz (also with --high-refresh on a
+	** 60Hz display) every frame is a UI tick.
+	*/
+	if (video.dFrameRateHz > VBLANK_HZ)
+	{
+		const uint64_t time64 = SDL_GetPerformanceCounter();
+
+		video.uiTick = (time64 >= uiTickTime64);
+		if (video.uiTick)
+		{
+			uiTickTime64 += uiTickDuration64;
+			if (uiTickTime64 <= time64) // we fell behind (or this is the first frame), don't try to catch up
+				uiTickTime64 = time64 + uiTickDuration64;
+		}
+	}
+
+	if (video.uiTick)
+		editor.framesPassed++;
 
 	/* Reset audio/video sync timestamp every half an hour to prevent
 	** possible sync drifting after hours of playing a song without
@@ -416,7 +506,7 @@ bool setupSprites(void)
 	s = sprites;
 	for (uint32_t i = 0; i < SPRITE_NUM; i++, s++)
 	{
-		s->refreshBuffer = (uint32_t *)malloc(s->w * s->h * sizeof (int32_t));
+		s->refreshBuffer = (uint8_t *)malloc(s->w * s->h);
 		if (s->refreshBuffer == NULL)
 			return false;
 	}
@@ -427,7 +517,7 @@ bool setupSprites(void)
 void changeSpriteData(int32_t sprite, const uint8_t *data)
 {
 	sprites[sprite].data = data;
-	memset(sprites[sprite].refreshBuffer, 0, sprites[sprite].w * sprites[sprite].h * sizeof (int32_t));
+	memset(sprites[sprite].refreshBuffer, 0, sprites[sprite].w * sprites[sprite].h);
 }
 
 void freeSprites(void)
@@ -498,8 +588,8 @@ void eraseSprites(void)
 			sy = 0;
 		}
 
-		const uint32_t *src32 = s->refreshBuffer;
-		uint32_t *dst32 = &video.frameBuffer[(sy * SCREEN_W) + sx];
+		const uint8_t *src8 = s->refreshBuffer;
+		uint8_t *dst8 = &video.frameBuffer[(sy * SCREEN_W) + sx];
 
 		// handle x/y clipping
 		if (sx+sw >= SCREEN_W) sw = SCREEN_W - sx;
@@ -511,10 +601,10 @@ void eraseSprites(void)
 		for (int32_t y = 0; y < sh; y++)
 		{
 			for (int32_t x = 0; x < sw; x++)
-				*dst32++ = *src32++;
+				*dst8++ = *src8++;
 
-			src32 += srcPitch;
-			dst32 += dstPitch;
+			src8 += srcPitch;
+			dst8 += dstPitch;
 		}
 	}
 }
@@ -570,8 +660,8 @@ void renderSprites(void)
 		if (sw <= 0 || sh <= 0) // sprite is hidden, don't draw nor fill clear buffer
 			continue;
 
-		uint32_t *dst32 = &video.frameBuffer[(sy * SCREEN_W) + sx];
-		uint32_t *clr32 = s->refreshBuffer;
+		uint8_t *dst8 = &video.frameBuffer[(sy * SCREEN_W) + sx];
+		uint8_t *clr8 = s->refreshBuffer;
 
 		// handle x/y clipping
 		if (sx+sw >= SCREEN_W) sw = SCREEN_W - sx;
@@ -587,23 +677,23 @@ void renderSprites(void)
 			{
 				for (int32_t x = 0; x < sw; x++)
 				{
-					*clr32++ = *dst32; // fill clear buffer
+					*clr8++ = *dst8; // fill clear buffer
 
 					if (*src8 != PAL_TRANSPR)
 					{
-						if (!(*dst32 & 0xFFFFFF) || *dst32 == video.palette[PAL_TEXTMRK])
-							*dst32 = 0xB3DBF6;
+						if (!(video.palette[*dst8] & 0xFFFFFF) || *dst8 == PAL_TEXTMRK)
+							*dst8 = PAL_TEXTPTR1;
 						else
-							*dst32 = 0x004ECE;
+							*dst8 = PAL_TEXTPTR2;
 					}
 
-					dst32++;
+					dst8++;
 					src8++;
 				}
 
-				clr32 += srcPitch;
+				clr8 += srcPitch;
 				src8 += srcPitch;
-				dst32 += dstPitch;
+				dst8 += dstPitch;
 			}
 		}
 		else
@@ -613,21 +703,21 @@ void renderSprites(void)
 			{
 				for (int32_t x = 0; x < sw; x++)
 				{
-					*clr32++ = *dst32; // fill clear buffer
+					*clr8++ = *dst8; // fill clear buffer
 
 					if (*src8 != PAL_TRANSPR)
 					{
 						assert(*src8 < PAL_NUM);
-						*dst32 = video.palette[*src8];
+						*dst8 = *src8;
 					}
 
-					dst32++;
+					dst8++;
 					src8++;
 				}
 
-				clr32 += srcPitch;
+				clr8 += srcPitch;
 				src8 += srcPitch;
-				dst32 += dstPitch;
+				dst8 += dstPitch;
 			}
 		}
 	}
@@ -637,7 +727,7 @@ void renderLoopPins(void)
 {
 	const uint8_t *src8;
 	int32_t sx, x, y, sw, sh, srcPitch, dstPitch;
-	uint32_t *clr32, *dst32;
+	uint8_t *clr8, *dst8;
 
 	// left loop pin
 
@@ -655,7 +745,7 @@ void renderLoopPins(void)
 		sx = s->x;
 
 		src8 = s->data;
-		clr32 = s->refreshBuffer;
+		clr8 = s->refreshBuffer;
 
 		// if x is negative, adjust variables
 		if (sx < 0)
@@ -665,7 +755,7 @@ void renderLoopPins(void)
 			sx = 0;
 		}
 
-		dst32 = &video.frameBuffer[(s->y * SCREEN_W) + sx];
+		dst8 = &video.frameBuffer[(s->y * SCREEN_W) + sx];
 
 		// handle x clipping
 		if (sx+sw >= SCREEN_W) sw = SCREEN_W - sx;
@@ -677,21 +767,21 @@ void renderLoopPins(void)
 		{
 			for (x = 0; x < sw; x++)
 			{
-				*clr32++ = *dst32; // fill clear buffer
+				*clr8++ = *dst8; // fill clear buffer
 
 				if (*src8 != PAL_TRANSPR)
 				{
 					assert(*src8 < PAL_NUM);
-					*dst32 = video.palette[*src8];
+					*dst8 = *src8;
 				}
 
-				dst32++;
+				dst8++;
 				src8++;
 			}
 
 			src8 += srcPitch;
-			clr32 += srcPitch;
-			dst32 += dstPitch;
+			clr8 += srcPitch;
+			dst8 += dstPitch;
 		}
 	}
 
@@ -714,7 +804,7 @@ void renderLoopPins(void)
 		sx = s->x;
 
 		src8 = s->data;
-		clr32 = s->refreshBuffer;
+		clr8 = s->refreshBuffer;
 
 		// if x is negative, adjust variables
 		if (sx < 0)
@@ -724,7 +814,7 @@ void renderLoopPins(void)
 			sx = 0;
 		}
 
-		dst32 = &video.frameBuffer[(s->y * SCREEN_W) + sx];
+		dst8 = &video.frameBuffer[(s->y * SCREEN_W) + sx];
 
 		// handle x clipping
 		if (sx+sw >= SCREEN_W) sw = SCREEN_W - sx;
@@ -736,7 +826,7 @@ void renderLoopPins(void)
 		{
 			for (x = 0; x < sw; x++)
 			{
-				*clr32++ = *dst32;
+				*clr8++ = *dst8;
 
 				if (*src8 != PAL_TRANSPR)
 				{
@@ -744,23 +834,23 @@ void renderLoopPins(void)
 					if (y < 9 && *src8 == PAL_LOOPPIN)
 					{
 						// don't draw marker line on top of left loop pin's thumb graphics
-						const uint8_t pal = *dst32 >> 24;
+						const uint8_t pal = *dst8;
 						if (pal != PAL_DESKTOP && pal != PAL_DSKTOP1 && pal != PAL_DSKTOP2)
-							*dst32 = video.palette[*src8];
+							*dst8 = *src8;
 					}
 					else
 					{
-						*dst32 = video.palette[*src8];
+						*dst8 = *src8;
 					}
 				}
 
-				dst32++;
+				dst8++;
 				src8++;
 			}
 
 			src8 += srcPitch;
-			clr32 += srcPitch;
-			dst32 += dstPitch;
+			clr8 += srcPitch;
+			dst8 += dstPitch;
 		}
 	}
 }
@@ -903,7 +993,7 @@ bool setupWindow(void)
 {
 	SDL_DisplayMode dm;
 
-	video.vsync60HzPresent = false;
+	video.vsyncPresent = false;
 
 	uint32_t windowFlags = SDL_WINDOW_ALLOW_HIGHDPI;
 #if defined (__APPLE__) || defined (_WIN32) // yet another quirk!
@@ -919,11 +1009,25 @@ bool setupWindow(void)
 	SDL_GetDesktopDisplayMode(di, &dm);
 	video.dMonitorRefreshRate = (double)dm.refresh_rate;
 
-	if (dm.refresh_rate >= 59 && dm.refresh_rate <= 61)
-		video.vsync60HzPresent = true;
+	video.uiTick = true;
+	video.dFrameRateHz = VBLANK_HZ;
+
+	if (video.highRefreshRate && dm.refresh_rate > 61)
+	{
+		// present at the display's refresh rate (UI logic still runs at 60Hz, see flipFrame())
+		video.vsyncPresent = true;
+		video.dFrameRateHz = video.dMonitorRefreshRate;
+	}
+	else if (dm.refresh_rate >= 59 && dm.refresh_rate <= 61)
+	{
+		video.vsyncPresent = true;
+	}
 
 	if (config.windowFlags & FORCE_VSYNC_OFF)
-		video.vsync60HzPresent = false;
+		video.vsyncPresent = false;
+
+	hpc_SetDurationInHz(&video.vblankHpc, video.dFrameRateHz);
+	uiTickDuration64 = hpcFreq.freq64 / VBLANK_HZ;
 
 	video.window = SDL_CreateWindow("", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
 		SCREEN_W * video.windowModeUpscaleFactor, SCREEN_H * video.windowModeUpscaleFactor,
@@ -947,16 +1051,16 @@ bool setupWindow(void)
 bool setupRenderer(void)
 {
 	uint32_t rendererFlags = 0;
-	if (video.vsync60HzPresent)
+	if (video.vsyncPresent)
 		rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
 
 	video.renderer = SDL_CreateRenderer(video.window, -1, rendererFlags);
 	if (video.renderer == NULL)
 	{
-		if (video.vsync60HzPresent)
+		if (video.vsyncPresent)
 		{
 			// try again without vsync flag
-			video.vsync60HzPresent = false;
+			video.vsyncPresent = false;
 
 			rendererFlags &= ~SDL_RENDERER_PRESENTVSYNC;
 			video.renderer = SDL_CreateRenderer(video.window, -1, rendererFlags);
@@ -979,8 +1083,8 @@ bool setupRenderer(void)
 		return false;
 	}
 
-	// framebuffer used by SDL (for texture)
-	video.frameBuffer = (uint32_t *)malloc(SCREEN_W * SCREEN_H * sizeof (uint32_t));
+	// framebuffer (palette indices), expanded into the texture in flipFrame()
+	video.frameBuffer = (uint8_t *)malloc(SCREEN_W * SCREEN_H);
 	if (video.frameBuffer == NULL)
 	{
 		showErrorMsgBox("Not enough memory!");
@@ -1008,11 +1112,12 @@ void handleRedrawing(void)
 	{
 		if (ui.aboutScreenShown)
 		{
-			renderAboutScreenFrame();
+			if (video.uiTick)
+				renderAboutScreenFrame();
 		}
 		else if (ui.nibblesShown)
 		{
-			if (editor.NI_Play)
+			if (editor.NI_Play && video.uiTick)
 				moveNibblesPlayers();
 		}
 		else
@@ -1105,10 +1210,11 @@ void handleRedrawing(void)
 		else
 			hideSprite(SPRITE_TEXT_CURSOR); // hide text cursor
 
-		editor.textCursorBlinkCounter += TEXT_CURSOR_BLINK_RATE;
+		if (video.uiTick)
+			editor.textCursorBlinkCounter += TEXT_CURSOR_BLINK_RATE;
 	}
 
-	if (editor.busy)
+	if (editor.busy && video.uiTick)
 		animateBusyMouse();
 
 	renderLoopPins();
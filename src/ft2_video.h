@@ -19,11 +19,13 @@ enum
 
 typedef struct video_t
 {
-	bool fullscreen, showFPSCounter, useCustomRenderRect, vsync60HzPresent, windowHidden;
+	bool fullscreen, showFPSCounter, useCustomRenderRect, vsyncPresent, windowHidden;
+	bool highRefreshRate, uiTick; // uiTick = a 60Hz UI logic tick is due this frame
 	uint8_t windowModeUpscaleFactor;
 	int32_t renderX, renderY, renderW, renderH, displayW, displayH, windowW, windowH;
-	uint32_t mouseCursorUpscaleFactor, *frameBuffer, palette[PAL_NUM];
-	double dMonitorRefreshRate, dDpiZoomFactorX, dDpiZoomFactorY, dMouseXMul, dMouseYMul;
+	uint8_t *frameBuffer; // palette indices (PAL_xxx), SCREEN_W*SCREEN_H
+	uint32_t mouseCursorUpscaleFactor, palette[PAL_NUM];
+	double dMonitorRefreshRate, dFrameRateHz, dDpiZoomFactorX, dDpiZoomFactorY, dMouseXMul, dMouseYMul;
 #ifdef _WIN32
 	HWND hWnd;
 #endif
@@ -37,7 +39,7 @@ typedef struct video_t
 
 typedef struct
 {
-	uint32_t *refreshBuffer;
+	uint8_t *refreshBuffer;
 	const uint8_t *data;
 	bool visible;
 	int16_t newX, newY, x, y;
@@ -50,6 +52,7 @@ void resetFPSCounter(void);
 void beginFPSCounter(void);
 void endFPSCounter(void);
 void flipFrame(void);
+void setTrueColorLayer(const uint32_t *buffer, int32_t x, int32_t y, int32_t w, int32_t h); // NULL = off
 void showErrorMsgBox(const char *fmt, ...);
 void updateWindowTitle(bool forceUpdate);
 void handleScopesFromChQueue(chSyncData_t *chSyncData, uint8_t *scopeUpdateStatus);
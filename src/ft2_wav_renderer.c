@@ -22,6 +22,7 @@
 
 #define UPDATE_VISUALS_AT_TICK 4
 #define TICKS_PER_RENDER_CHUNK 64
+#define TICK_QUEUE_LEN 64
 
 enum
 {
@@ -44,6 +45,16 @@ static int16_t WDAmp;
 static uint32_t WDFrequency = 44100;
 static SDL_Thread *thread;
 
+/* The song is rendered as a two-stage pipeline: the replayer thread runs the
+** replayer and queues up the voice updates for each tick, while the render
+** thread mixes earlier ticks and writes them to disk.
+*/
+static uint8_t tickCounter;
+static uint64_t tickSamplesFrac;
+static tickUpdate_t tickQueue[TICK_QUEUE_LEN];
+static SDL_sem *tickQueueFree, *tickQueueFilled;
+static SDL_atomic_t stopReplayerThread;
+
 static void updateWavRenderer(void)
 {
 	char str[16];
@@ -219,16 +230,31 @@ static bool dump_Init(uint32_t frq, int16_t amp, int16_t songPos)
 	return true;
 }
 
-static void dump_Close(FILE *f, uint32_t totalSamples)
+// stops the song and restores the audio settings after rendering
+static void dump_Free(void)
 {
-	wavHeader_t wavHeader;
-
 	if (wavRenderBuffer != NULL)
 	{
 		free(wavRenderBuffer);
 		wavRenderBuffer = NULL;
 	}
 
+	stopPlaying();
+
+	// kludge: set speed to 6 if speed was set to 0
+	if (song.speed == 0)
+		song.speed = 6;
+
+	setBackOldAudioFreq();
+	setMixerBPM(song.BPM);
+	setAudioAmp(config.boostLevel, config.masterVol, !!(config.specialFlags & BITDEPTH_32));
+	editor.wavIsRendering = false;
+}
+
+static void dump_Close(FILE *f, uint32_t totalSamples)
+{
+	wavHeader_t wavHeader;
+
 	uint32_t totalBytes;
 	if (WDBitDepth == 16)
 		totalBytes = totalSamples * sizeof (int16_t);
@@ -266,17 +292,7 @@ static void dump_Close(FILE *f, uint32_t totalSamples)
 	fwrite(&wavHeader, 1, sizeof (wavHeader_t), f);
 	fclose(f);
 
-	stopPlaying();
-
-	// kludge: set speed to 6 if speed was set to 0
-	if (song.speed == 0)
-		song.speed = 6;
-
-	setBackOldAudioFreq();
-	setMixerBPM(song.BPM);
-	setAudioAmp(config.boostLevel, config.masterVol, !!(config.specialFlags & BITDEPTH_32));
-	editor.wavIsRendering = false;
-
+	dump_Free();
 	setMouseBusy(false);
 }
 
@@ -294,40 +310,107 @@ static bool dump_EndOfTune(int16_t endSongPos)
 	return returnValue;
 }
 
-void dump_TickReplayer(void)
+// mixer stage: shows the position/tempo of the tick that was just mixed (the replayer stage runs ahead)
+static void updateVisuals(const tickUpdate_t *t)
+{
+	editor.editPattern = t->pattNum;
+	editor.row = t->row;
+	editor.songPos = t->songPos;
+	editor.BPM = t->BPM;
+	editor.speed = t->speed;
+	editor.globalVolume = t->globalVolume;
+
+	ui.drawPosEdFlag = true;
+	ui.drawPattNumLenFlag = true;
+	ui.drawReplayerPianoFlag = true;
+	ui.drawBPMFlag = true;
+	ui.drawSpeedFlag = true;
+	ui.drawGlobVolFlag = true;
+	ui.updatePatternEditor = true;
+}
+
+static void storeTickVisuals(tickUpdate_t *t)
 {
+	t->pattNum = (uint8_t)song.pattNum;
+	t->globalVolume = (uint8_t)song.globalVolume;
+	t->songPos = (uint8_t)song.songPos;
+	t->speed = (uint8_t)song.speed;
+	t->row = (uint8_t)song.row;
+	t->BPM = (uint8_t)song.BPM;
+}
+
+// replayer stage: runs one replayer tick, and fills in its voice updates, length and visuals
+static void renderReplayerTick(tickUpdate_t *t)
+{
+	if (!editor.wavIsRendering || SDL_AtomicGet(&stopReplayerThread) || dump_EndOfTune(WDStopPos))
+	{
+		t->endOfRender = true;
+		storeTickVisuals(t);
+		return;
+	}
+
+	t->endOfRender = false;
+	t->hasVoiceUpdates = false;
+
 	replayerBusy = true;
 	if (!musicPaused)
 	{
-		if (audio.volumeRampingFlag)
-			resetRampVolumes();
-
 		tickReplayer();
-		updateVoices();
+		captureVoiceUpdates(t);
+		t->hasVoiceUpdates = true;
 	}
 	replayerBusy = false;
+
+	t->samplesToMix = audio.samplesPerTickInt;
+	if (!useLegacyBPM)
+	{
+		tickSamplesFrac += audio.samplesPerTickFrac;
+		if (tickSamplesFrac >= BPM_FRAC_SCALE)
+		{
+			tickSamplesFrac &= BPM_FRAC_MASK;
+			t->samplesToMix++;
+		}
+	}
+
+	storeTickVisuals(t);
 }
 
-static void updateVisuals(void)
+static void mixerTickVisuals(const tickUpdate_t *t)
 {
-	editor.editPattern = (uint8_t)song.pattNum;
-	editor.row = song.row;
-	editor.songPos = song.songPos;
-	editor.BPM = song.BPM;
-	editor.speed = song.speed;
-	editor.globalVolume = song.globalVolume;
+	if (++tickCounter >= UPDATE_VISUALS_AT_TICK || t->endOfRender)
+	{
+		tickCounter = 0;
+		updateVisuals(t);
+	}
+}
 
-	ui.drawPosEdFlag = true;
-	ui.drawPattNumLenFlag = true;
-	ui.drawReplayerPianoFlag = true;
-	ui.drawBPMFlag = true;
-	ui.drawSpeedFlag = true;
-	ui.drawGlobVolFlag = true;
-	ui.updatePatternEditor = true;
+static int32_t SDLCALL renderReplayerThread(void *ptr)
+{
+	int32_t writePos = 0;
+
+	bool endOfRender = false;
+	while (!endOfRender)
+	{
+		SDL_SemWait(tickQueueFree);
+
+		tickUpdate_t *t = &tickQueue[writePos];
+		renderReplayerTick(t);
+		endOfRender = t->endOfRender;
+
+		writePos = (writePos + 1) % TICK_QUEUE_LEN;
+		SDL_SemPost(tickQueueFilled);
+	}
+
+	return true;
+
+	(void)ptr;
 }
 
 static int32_t SDLCALL renderWavThread(void *ptr)
 {
+	tickUpdate_t serialTick;
+	SDL_Thread *replayerThread = NULL;
+
 	(void)ptr;
 
 	FILE *f = (FILE *)editor.wavRendererFileHandle;
@@ -344,12 +427,22 @@ static int32_t SDLCALL renderWavThread(void *ptr)
 
 	uint32_t sampleCounter = 0;
 	bool overflow = false, renderDone = false;
-	uint8_t tickCounter = UPDATE_VISUALS_AT_TICK;
-	uint64_t tickSamplesFrac = 0;
+
+	tickCounter = UPDATE_VISUALS_AT_TICK;
+	tickSamplesFrac = 0;
 
 	uint64_t bytesInFile = sizeof (wavHeader_t);
 
 	editor.wavReachedEndFlag = false;
+
+	// start the replayer stage (if that fails, the replayer is ticked from this thread instead)
+	SDL_AtomicSet(&stopReplayerThread, false);
+	tickQueueFree = SDL_CreateSemaphore(TICK_QUEUE_LEN);
+	tickQueueFilled = SDL_CreateSemaphore(0);
+	if (tickQueueFree != NULL && tickQueueFilled != NULL)
+		replayerThread = SDL_CreateThread(renderReplayerThread, NULL, NULL);
+
+	int32_t readPos = 0;
 	while (!renderDone)
 	{
 		uint32_t samplesInChunk = 0;
@@ -358,27 +451,36 @@ static int32_t SDLCALL renderWavThread(void *ptr)
 		uint8_t *ptr8 = wavRenderBuffer;
 		for (uint32_t i = 0; i < TICKS_PER_RENDER_CHUNK; i++)
 		{
-			if (!editor.wavIsRendering || dump_EndOfTune(WDStopPos))
+			tickUpdate_t *t;
+			if (replayerThread != NULL)
+			{
+				SDL_SemWait(tickQueueFilled);
+				t = &tickQueue[readPos];
+			}
+			else
+			{
+				t = &serialTick;
+				renderReplayerTick(t);
+			}
+
+			mixerTickVisuals(t);
+			if (t->endOfRender)
 			{
 				renderDone = true;
 				break;
 			}
 
-			dump_TickReplayer();
-			uint32_t tickSamples = audio.samplesPerTickInt;
+			applyVoiceUpdates(t);
 
-			if (!useLegacyBPM)
+			uint32_t tickSamples = t->samplesToMix;
+			mixReplayerTickToBuffer(tickSamples, ptr8, WDBitDepth);
+
+			if (replayerThread != NULL)
 			{
-				tickSamplesFrac += audio.samplesPerTickFrac;
-				if (tickSamplesFrac >= BPM_FRAC_SCALE)
-				{
-					tickSamplesFrac &= BPM_FRAC_MASK;
-					tickSamples++;
-				}
+				readPos = (readPos + 1) % TICK_QUEUE_LEN;
+				SDL_SemPost(tickQueueFree);
 			}
 
-			mixReplayerTickToBuffer(tickSamples, ptr8, WDBitDepth);
-
 			tickSamples *= 2; // stereo
 			samplesInChunk += tickSamples;
 			sampleCounter += tickSamples;
@@ -401,12 +503,6 @@ static int32_t SDLCALL renderWavThread(void *ptr)
 				overflow = true;
 				break;
 			}
-
-			if (++tickCounter >= UPDATE_VISUALS_AT_TICK)
-			{
-				tickCounter = 0;
-				updateVisuals();
-			}
 		}
 
 		// write buffer to disk
@@ -419,7 +515,26 @@ static int32_t SDLCALL renderWavThread(void *ptr)
 		}
 	}
 
-	updateVisuals();
+	if (replayerThread != NULL)
+	{
+		// let the replayer stage run into the end (it may be waiting for a free queue slot)
+		SDL_AtomicSet(&stopReplayerThread, true);
+		SDL_SemPost(tickQueueFree);
+		SDL_WaitThread(replayerThread, NULL);
+	}
+
+	if (tickQueueFree != NULL)
+	{
+		SDL_DestroySemaphore(tickQueueFree);
+		tickQueueFree = NULL;
+	}
+
+	if (tickQueueFilled != NULL)
+	{
+		SDL_DestroySemaphore(tickQueueFilled);
+		tickQueueFilled = NULL;
+	}
+
 	drawPlaybackTime(); // this is needed after the song stopped
 
 	dump_Close(f, sampleCounter);
@@ -432,6 +547,60 @@ static int32_t SDLCALL renderWavThread(void *ptr)
 	return true;
 }
 
+bool renderSongHeadless(uint32_t frequency, uint8_t bitDepth, int16_t amp, uint64_t maxFrames,
+	void (*writeFunc)(const void *data, uint32_t numBytes, void *userData), void *userData, uint64_t *numFrames)
+{
+	tickUpdate_t serialTick;
+
+	*numFrames = 0;
+
+	WDBitDepth = bitDepth;
+	WDStartPos = 0;
+	WDStopPos = (uint8_t)(song.songLength - 1);
+
+	if (!dump_Init(frequency, amp, WDStartPos))
+		return false;
+
+	tickCounter = UPDATE_VISUALS_AT_TICK;
+	tickSamplesFrac = 0;
+	editor.wavReachedEndFlag = false;
+	SDL_AtomicSet(&stopReplayerThread, false);
+
+	const uint32_t bytesPerFrame = (bitDepth == 16) ? (2 * sizeof (int16_t)) : (2 * sizeof (float));
+
+	// same as renderWavThread(), but the replayer is ticked from this thread
+	bool renderDone = false;
+	while (!renderDone)
+	{
+		uint32_t bytesInChunk = 0;
+
+		uint8_t *ptr8 = wavRenderBuffer;
+		for (uint32_t i = 0; i < TICKS_PER_RENDER_CHUNK; i++)
+		{
+			renderReplayerTick(&serialTick);
+			mixerTickVisuals(&serialTick);
+			if (serialTick.endOfRender || *numFrames >= maxFrames)
+			{
+				renderDone = true;
+				break;
+			}
+
+			applyVoiceUpdates(&serialTick);
+			mixReplayerTickToBuffer(serialTick.samplesToMix, ptr8, bitDepth);
+
+			ptr8 += serialTick.samplesToMix * bytesPerFrame;
+			bytesInChunk += serialTick.samplesToMix * bytesPerFrame;
+			*numFrames += serialTick.samplesToMix;
+		}
+
+		if (bytesInChunk > 0)
+			writeFunc(wavRenderBuffer, bytesInChunk, userData);
+	}
+
+	dump_Free();
+	return true;
+}
+
 static void wavRender(bool checkOverwrite)
 {
 	WDStartPos = (uint8_t)(MAX(0, MIN(WDStartPos, song.songLength - 1)));
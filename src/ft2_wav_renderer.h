@@ -27,3 +27,10 @@ void pbWavSongEndDown(void);
 void resetWavRenderer(void);
 void rbWavRenderBitDepth16(void);
 void rbWavRenderBitDepth32(void);
+
+/* Renders the song from the first to the last order without the GUI (for the
+** render test). The interleaved stereo output (int16_t or float, bitDepth 16/32)
+** goes to writeFunc in chunks. Stops after maxFrames sample frames.
+*/
+bool renderSongHeadless(uint32_t frequency, uint8_t bitDepth, int16_t amp, uint64_t maxFrames,
+	void (*writeFunc)(const void *data, uint32_t numBytes, void *userData), void *userData, uint64_t *numFrames);
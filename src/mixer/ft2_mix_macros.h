@@ -213,6 +213,21 @@
 ** There is also a second special case for the left edge (negative taps) after the sample has looped once.
 */
 
+#if SINC1_PHASE_INTERPOLATION
+#define WINDOWED_SINC8_INTERPOLATION(s, f, scale) \
+{ \
+	const float *t = v->fSincLUT + (((uint32_t)(f) >> SINC1_FRACSHIFT) & SINC1_FRACMASK); \
+	const float fPhase = (float)((uint32_t)(f) & SINC1_PHASE_FRACMASK) * (1.0f / (SINC1_PHASE_FRACMASK+1.0f)); \
+	fSample = ((s[-3] * (t[0] + t[1] * fPhase)) + \
+	           (s[-2] * (t[2] + t[3] * fPhase)) + \
+	           (s[-1] * (t[4] + t[5] * fPhase)) + \
+	           ( s[0] * (t[6] + t[7] * fPhase)) + \
+	           ( s[1] * (t[8] + t[9] * fPhase)) + \
+	           ( s[2] * (t[10] + t[11] * fPhase)) + \
+	           ( s[3] * (t[12] + t[13] * fPhase)) + \
+	           ( s[4] * (t[14] + t[15] * fPhase))) * (1.0f / scale); \
+}
+#else
 #define WINDOWED_SINC8_INTERPOLATION(s, f, scale) \
 { \
 	const float *t = v->fSincLUT + (((uint32_t)(f) >> SINC1_FRACSHIFT) & SINC1_FRACMASK); \
@@ -225,7 +240,31 @@
 	           ( s[3] * t[6]) + \
 	           ( s[4] * t[7])) * (1.0f / scale); \
 }
+#endif
 
+#if SINC2_PHASE_INTERPOLATION
+#define WINDOWED_SINC16_INTERPOLATION(s, f, scale) \
+{ \
+	const float *t = v->fSincLUT + (((uint32_t)(f) >> SINC2_FRACSHIFT) & SINC2_FRACMASK); \
+	const float fPhase = (float)((uint32_t)(f) & SINC2_PHASE_FRACMASK) * (1.0f / (SINC2_PHASE_FRACMASK+1.0f)); \
+	fSample = ((s[-7] * (t[0] + t[1] * fPhase)) + \
+	           (s[-6] * (t[2] + t[3] * fPhase)) + \
+	           (s[-5] * (t[4] + t[5] * fPhase)) + \
+	           (s[-4] * (t[6] + t[7] * fPhase)) + \
+	           (s[-3] * (t[8] + t[9] * fPhase)) + \
+	           (s[-2] * (t[10] + t[11] * fPhase)) + \
+	           (s[-1] * (t[12] + t[13] * fPhase)) + \
+	           ( s[0] * (t[14] + t[15] * fPhase)) + \
+	           ( s[1] * (t[16] + t[17] * fPhase)) + \
+	           ( s[2] * (t[18] + t[19] * fPhase)) + \
+	           ( s[3] * (t[20] + t[21] * fPhase)) + \
+	           ( s[4] * (t[22] + t[23] * fPhase)) + \
+	           ( s[5] * (t[24] + t[25] * fPhase)) + \
+	           ( s[6] * (t[26] + t[27] * fPhase)) + \
+	           ( s[7] * (t[28] + t[29] * fPhase)) + \
+	           ( s[8] * (t[30] + t[31] * fPhase))) * (1.0f / scale); \
+}
+#else
 #define WINDOWED_SINC16_INTERPOLATION(s, f, scale) \
 { \
 	const float *t = v->fSincLUT + (((uint32_t)(f) >> SINC2_FRACSHIFT) & SINC2_FRACMASK); \
@@ -246,6 +285,7 @@
 	           (  s[7] * t[14]) + \
 	           (  s[8] * t[15])) * (1.0f / scale); \
 }
+#endif
 
 #define RENDER_8BIT_SMP_S8INTRP \
 	WINDOWED_SINC8_INTERPOLATION(smpPtr, positionFrac, 128) \
@@ -16,6 +16,19 @@ float *fSinc16_1 = NULL, *fSinc16_2 = NULL, *fSinc16_3 = NULL;
 float *fSinc_1 = NULL, *fSinc_2 = NULL, *fSinc_3 = NULL;
 uint64_t sincRatio1, sincRatio2;
 
+#define NUM_SINC_TABLES 6
+
+typedef struct sincTableJob_t
+{
+	bool phaseInterpolation;
+	float *fOutput;
+	int32_t filterWidth, filterPhases;
+	double beta, cutoff;
+} sincTableJob_t;
+
+static sincTableJob_t sincJobs[NUM_SINC_TABLES];
+static SDL_Thread *sincThreads[NUM_SINC_TABLES];
+
 // zeroth-order modified Bessel function of the first kind (series approximation)
 static inline double besselI0(double z)
 {
@@ -61,53 +74,81 @@ static inline double sincWithCutoff(double x, const double cutoff)
 	}
 }
 
-static void generateWindowedSinc(float *fOutput, const int32_t filterWidth, const int32_t filterPhases, const double beta, const double cutoff)
+static inline double windowedSinc(double x, const double xMul, const double beta, const double besselI0Beta, const double cutoff)
+{
+	// Kaiser-Bessel window
+	const double n = x * xMul;
+	const double window = besselI0(beta * sqrt(1.0 - n * n)) * besselI0Beta;
+
+	if (cutoff < 1.0)
+		return sincWithCutoff(x, cutoff) * window; // windowed-sinc with frequency cutoff
+	else
+		return sinc(x) * window; // windowed-sinc with no frequency cutoff
+}
+
+static void generateWindowedSinc(float *fOutput, const int32_t filterWidth, const int32_t filterPhases,
+	const bool phaseInterpolation, const double beta, const double cutoff)
 {
-	const int32_t filterWidthBits = (int32_t)log2(filterWidth);
-	const int32_t filterWidthMask = filterWidth - 1;
 	const int32_t filterCenter = (filterWidth / 2) - 1;
 	const double besselI0Beta = 1.0 / besselI0(beta);
 	const double phaseMul = 1.0 / filterPhases;
 	const double xMul = 1.0 / (filterWidth / 2);
 
-	if (cutoff < 1.0)
+	for (int32_t phase = 0; phase < filterPhases; phase++)
 	{
-		// windowed-sinc with frequency cutoff
-		for (int32_t i = 0; i < filterPhases * filterWidth; i++)
+		for (int32_t i = 0; i < filterWidth; i++)
 		{
-			const double x = ((i & filterWidthMask) - filterCenter) - ((i >> filterWidthBits) * phaseMul);
-
-			// Kaiser-Bessel window
-			const double n = x * xMul;
-			const double window = besselI0(beta * sqrt(1.0 - n * n)) * besselI0Beta;
-
-			fOutput[i] = (float)(sincWithCutoff(x, cutoff) * window);
+			const double x = (i - filterCenter) - (phase * phaseMul);
+			const float fCoeff = (float)windowedSinc(x, xMul, beta, besselI0Beta, cutoff);
+
+			*fOutput++ = fCoeff;
+			if (phaseInterpolation)
+			{
+				// delta to the next phase (the one after the last phase is the first phase, one tap over)
+				const double xNext = (i - filterCenter) - ((phase + 1) * phaseMul);
+				*fOutput++ = (float)windowedSinc(xNext, xMul, beta, besselI0Beta, cutoff) - fCoeff;
+			}
 		}
 	}
-	else
-	{
-		// windowed-sinc with no frequency cutoff
-		for (int32_t i = 0; i < filterPhases * filterWidth; i++)
-		{
-			const double x = ((i & filterWidthMask) - filterCenter) - ((i >> filterWidthBits) * phaseMul);
+}
 
-			// Kaiser-Bessel window
-			const double n = x * xMul;
-			const double window = besselI0(beta * sqrt(1.0 - n * n)) * besselI0Beta;
+static int32_t SDLCALL generateWindowedSincThread(void *ptr)
+{
+	const sincTableJob_t *job = (const sincTableJob_t *)ptr;
+	generateWindowedSinc(job->fOutput, job->filterWidth, job->filterPhases, job->phaseInterpolation, job->beta, job->cutoff);
 
-			fOutput[i] = (float)(sinc(x) * window);
-		}
-	}
+	return true;
 }
 
+static void startSincTableJob(int32_t i, float *fOutput, const int32_t filterWidth, const int32_t filterPhases,
+	const bool phaseInterpolation, const double beta, const double cutoff)
+{
+	sincTableJob_t *job = &sincJobs[i];
+
+	job->phaseInterpolation = phaseInterpolation;
+	job->fOutput = fOutput;
+	job->filterWidth = filterWidth;
+	job->filterPhases = filterPhases;
+	job->beta = beta;
+	job->cutoff = cutoff;
+
+	sincThreads[i] = SDL_CreateThread(generateWindowedSincThread, NULL, job);
+	if (sincThreads[i] == NULL)
+		generateWindowedSinc(fOutput, filterWidth, filterPhases, phaseInterpolation, beta, cutoff); // couldn't create thread, do it here instead
+}
+
+/* The tables take a while to calculate (Bessel series for every coefficient),
+** so they are generated on worker threads while the window and audio are set up.
+** waitForWindowedSincTables() must be called before the tables are used.
+*/
 bool setupWindowedSincTables(void)
 {
-	fSinc8_1  = (float *)malloc(SINC1_WIDTH*SINC1_PHASES * sizeof (float));
-	fSinc8_2  = (float *)malloc(SINC1_WIDTH*SINC1_PHASES * sizeof (float));
-	fSinc8_3  = (float *)malloc(SINC1_WIDTH*SINC1_PHASES * sizeof (float));
-	fSinc16_1 = (float *)malloc(SINC2_WIDTH*SINC2_PHASES * sizeof (float));
-	fSinc16_2 = (float *)malloc(SINC2_WIDTH*SINC2_PHASES * sizeof (float));
-	fSinc16_3 = (float *)malloc(SINC2_WIDTH*SINC2_PHASES * sizeof (float));
+	fSinc8_1  = (float *)malloc(SINC1_LUT_LEN * sizeof (float));
+	fSinc8_2  = (float *)malloc(SINC1_LUT_LEN * sizeof (float));
+	fSinc8_3  = (float *)malloc(SINC1_LUT_LEN * sizeof (float));
+	fSinc16_1 = (float *)malloc(SINC2_LUT_LEN * sizeof (float));
+	fSinc16_2 = (float *)malloc(SINC2_LUT_LEN * sizeof (float));
+	fSinc16_3 = (float *)malloc(SINC2_LUT_LEN * sizeof (float));
 
 	if (fSinc8_1  == NULL || fSinc8_2  == NULL || fSinc8_3  == NULL ||
 		fSinc16_1 == NULL || fSinc16_2 == NULL || fSinc16_3 == NULL)
@@ -141,21 +182,35 @@ bool setupWindowedSincTables(void)
 	const double c2 = 0.500;
 	const double c3 = 0.425;
 
-	// 8 point
-	generateWindowedSinc(fSinc8_1,  SINC1_WIDTH, SINC1_PHASES, b1, c1);
-	generateWindowedSinc(fSinc8_2,  SINC1_WIDTH, SINC1_PHASES, b2, c2);
-	generateWindowedSinc(fSinc8_3,  SINC1_WIDTH, SINC1_PHASES, b3, c3);
+	// 16 point (largest tables first)
+	startSincTableJob(0, fSinc16_1, SINC2_WIDTH, SINC2_PHASES, SINC2_PHASE_INTERPOLATION, b1, c1);
+	startSincTableJob(1, fSinc16_2, SINC2_WIDTH, SINC2_PHASES, SINC2_PHASE_INTERPOLATION, b2, c2);
+	startSincTableJob(2, fSinc16_3, SINC2_WIDTH, SINC2_PHASES, SINC2_PHASE_INTERPOLATION, b3, c3);
 
-	// 16 point
-	generateWindowedSinc(fSinc16_1, SINC2_WIDTH, SINC2_PHASES, b1, c1);
-	generateWindowedSinc(fSinc16_2, SINC2_WIDTH, SINC2_PHASES, b2, c2);
-	generateWindowedSinc(fSinc16_3, SINC2_WIDTH, SINC2_PHASES, b3, c3);
+	// 8 point
+	startSincTableJob(3, fSinc8_1,  SINC1_WIDTH, SINC1_PHASES, SINC1_PHASE_INTERPOLATION, b1, c1);
+	startSincTableJob(4, fSinc8_2,  SINC1_WIDTH, SINC1_PHASES, SINC1_PHASE_INTERPOLATION, b2, c2);
+	startSincTableJob(5, fSinc8_3,  SINC1_WIDTH, SINC1_PHASES, SINC1_PHASE_INTERPOLATION, b3, c3);
 
 	return true;
 }
 
+void waitForWindowedSincTables(void)
+{
+	for (int32_t i = 0; i < NUM_SINC_TABLES; i++)
+	{
+		if (sincThreads[i] != NULL)
+		{
+			SDL_WaitThread(sincThreads[i], NULL);
+			sincThreads[i] = NULL;
+		}
+	}
+}
+
 void freeWindowedSincTables(void)
 {
+	waitForWindowedSincTables();
+
 	if (fSinc8_1 != NULL)
 	{
 		free(fSinc8_1);
@@ -4,24 +4,52 @@
 #include <stdbool.h>
 #include "ft2_mix.h" // MIXER_FRAC_BITS
 
+/* Phase-interpolated LUT layout (selectable per sinc interpolator):
+** Fewer phases are stored, with a coefficient/delta pair per tap, and the mixer
+** interpolates linearly between two adjacent phases. For the 16-point tables this
+** means 128kB instead of 512kB per table (less cache thrashing when many voices use
+** different tables), and the phase error goes down from ~-78dB to ~-126dB.
+*/
+#define SINC1_PHASE_INTERPOLATION 0
+#define SINC2_PHASE_INTERPOLATION 1
+
 #define SINC1_WIDTH 8
 #define SINC1_WIDTH_BITS 3 // log2(SINC1_WIDTH)
+#if SINC1_PHASE_INTERPOLATION
+#define SINC1_PHASES 1024
+#define SINC1_PHASES_BITS 10 // log2(SINC1_PHASES)
+#else
 #define SINC1_PHASES 8192
 #define SINC1_PHASES_BITS 13 // log2(SINC1_PHASES)
-#define SINC1_FRACSHIFT (MIXER_FRAC_BITS-(SINC1_PHASES_BITS+SINC1_WIDTH_BITS))
-#define SINC1_FRACMASK ((SINC1_WIDTH*SINC1_PHASES)-SINC1_WIDTH)
+#endif
+#define SINC1_STRIDE (SINC1_WIDTH << SINC1_PHASE_INTERPOLATION) // floats per phase
+#define SINC1_STRIDE_BITS (SINC1_WIDTH_BITS+SINC1_PHASE_INTERPOLATION)
+#define SINC1_LUT_LEN (SINC1_STRIDE*SINC1_PHASES)
+#define SINC1_FRACSHIFT (MIXER_FRAC_BITS-(SINC1_PHASES_BITS+SINC1_STRIDE_BITS))
+#define SINC1_FRACMASK (SINC1_LUT_LEN-SINC1_STRIDE)
+#define SINC1_PHASE_FRACMASK ((1U << (MIXER_FRAC_BITS-SINC1_PHASES_BITS))-1)
 
 #define SINC2_WIDTH 16
 #define SINC2_WIDTH_BITS 4 // log2(SINC2_WIDTH)
+#if SINC2_PHASE_INTERPOLATION
+#define SINC2_PHASES 1024
+#define SINC2_PHASES_BITS 10 // log2(SINC2_PHASES)
+#else
 #define SINC2_PHASES 8192
 #define SINC2_PHASES_BITS 13 // log2(SINC2_PHASES)
-#define SINC2_FRACSHIFT (MIXER_FRAC_BITS-(SINC2_PHASES_BITS+SINC2_WIDTH_BITS))
-#define SINC2_FRACMASK ((SINC2_WIDTH*SINC2_PHASES)-SINC2_WIDTH)
+#endif
+#define SINC2_STRIDE (SINC2_WIDTH << SINC2_PHASE_INTERPOLATION) // floats per phase
+#define SINC2_STRIDE_BITS (SINC2_WIDTH_BITS+SINC2_PHASE_INTERPOLATION)
+#define SINC2_LUT_LEN (SINC2_STRIDE*SINC2_PHASES)
+#define SINC2_FRACSHIFT (MIXER_FRAC_BITS-(SINC2_PHASES_BITS+SINC2_STRIDE_BITS))
+#define SINC2_FRACMASK (SINC2_LUT_LEN-SINC2_STRIDE)
+#define SINC2_PHASE_FRACMASK ((1U << (MIXER_FRAC_BITS-SINC2_PHASES_BITS))-1)
 
 extern float *fSinc8_1, *fSinc8_2, *fSinc8_3;
 extern float *fSinc16_1, *fSinc16_2, *fSinc16_3;
 extern float *fSinc_1, *fSinc_2, *fSinc_3;
 extern uint64_t sincRatio1, sincRatio2;
 
-bool setupWindowedSincTables(void);
+bool setupWindowedSincTables(void); // starts the table generation threads
+void waitForWindowedSincTables(void);
 void freeWindowedSincTables(void);
@@ -377,6 +377,9 @@ trackError:
 		}
 	}
 
+	if (tmpSkipSampleData) // module probing, leave sample data on disk
+		return true;
+
 	// load sample data
 	for (int32_t i = 0; i < h.numins; i++)
 	{
@@ -219,6 +219,12 @@ bool loadDIGI(FILE *f, uint32_t filesize)
 			s->loopLength = 0;
 		}
 
+		if (tmpSkipSampleData) // module probing, leave sample data on disk
+		{
+			fseek(f, s->length, SEEK_CUR);
+			continue;
+		}
+
 		if (!allocateSmpData(s, s->length, false))
 		{
 			loaderMsgBox("Not enough memory!");
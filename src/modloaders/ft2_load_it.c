@@ -1518,6 +1518,9 @@ static bool loadSample(FILE *f, sample_t *s, itSmpHdr_t *itSmp)
 	if (s->length <= 0 || itSmp->offsetInFile == 0)
 		return true; // empty sample, skip data loading
 
+	if (tmpSkipSampleData)
+		return true; // module probing, leave sample data on disk
+
 	if (!allocateSmpData(s, s->length, sampleIs16Bit))
 		return false;
 
@@ -338,6 +338,12 @@ bool loadMOD(FILE *f, uint32_t filesize)
 		if (s->loopStart+s->loopLength > 2)
 			s->flags |= LOOP_FWD; // enable loop
 
+		if (tmpSkipSampleData) // module probing, leave sample data on disk
+		{
+			fseek(f, s->length, SEEK_CUR);
+			continue;
+		}
+
 		if (!allocateSmpData(s, s->length, false))
 		{
 			loaderMsgBox("Not enough memory!");
@@ -584,6 +584,9 @@ bool loadS3M(FILE *f, uint32_t filesize)
 					lengthInFile <<= 1;
 				}
 
+				if (tmpSkipSampleData) // module probing, leave sample data on disk
+					continue;
+
 				if (!allocateSmpData(s, s->length, sample16Bit))
 				{
 					loaderMsgBox("Not enough memory!");
@@ -335,6 +335,12 @@ bool loadSTK(FILE *f, uint32_t filesize)
 			s->loopStart = 0;
 		}
 
+		if (tmpSkipSampleData) // module probing, leave sample data on disk
+		{
+			fseek(f, s->length, SEEK_CUR);
+			continue;
+		}
+
 		if (!allocateSmpData(s, s->length, false))
 		{
 			loaderMsgBox("Not enough memory!");
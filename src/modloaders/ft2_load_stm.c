@@ -200,6 +200,12 @@ bool loadSTM(FILE *f, uint32_t filesize)
 
 			sample_t *s = &instrTmp[1+i]->smp[0];
 
+			if (tmpSkipSampleData) // module probing, leave sample data on disk
+			{
+				fseek(f, hdr.smp[i].length, SEEK_CUR);
+				continue;
+			}
+
 			if (!allocateSmpData(s, hdr.smp[i].length, false))
 			{
 				loaderMsgBox("Not enough memory!");
@@ -363,6 +363,12 @@ static bool loadInstrSample(FILE *f, uint16_t i)
 				if (s->length > MAX_SAMPLE_LEN)
 					s->length = MAX_SAMPLE_LEN;
 
+				if (tmpSkipSampleData) // module probing, leave sample data on disk
+				{
+					fseek(f, adpcmSample ? 16 + ((lengthInFile + 1) / 2) : lengthInFile, SEEK_CUR);
+					continue;
+				}
+
 				if (!allocateSmpData(s, s->length, sample16Bit))
 				{
 					loaderMsgBox("Not enough memory!");
@@ -9,29 +9,23 @@
 /* ----------------------------------------------------------------------- */
 
 #define SCOPE_INIT \
-	const uint32_t color = video.palette[PAL_PATTEXT]; \
-	uint32_t width = x + w; \
+	int32_t x = 0; \
 	int32_t sample; \
 	int32_t position = s->position; \
 	uint64_t positionFrac = 0;
 
 #define SCOPE_INIT_BIDI \
-	const uint32_t color = video.palette[PAL_PATTEXT]; \
-	uint32_t width = x + w; \
-	int32_t sample; \
-	int32_t actualPos, position = s->position; \
-	uint64_t positionFrac = 0; \
+	SCOPE_INIT \
+	int32_t actualPos; \
 	bool samplingBackwards = s->samplingBackwards;
 
 #define LINED_SCOPE_INIT \
 	SCOPE_INIT \
-	int32_t smpY1, smpY2; \
-	width--;
+	const uint8_t interpolation = config.interpolation;
 
 #define LINED_SCOPE_INIT_BIDI \
 	SCOPE_INIT_BIDI \
-	int32_t smpY1, smpY2; \
-	width--;
+	const uint8_t interpolation = config.interpolation;
 
 /* Note: Sample data already has fixed tap samples at the end of the sample,
 ** so that out-of-bounds reads get the correct interpolation tap data.
@@ -107,9 +101,9 @@
 
 #define INTERPOLATE_SMP8(pos, frac) \
 	const int8_t *s8 = s->base8 + pos; \
-	if (config.interpolation == INTERPOLATION_DISABLED) \
+	if (interpolation == INTERPOLATION_DISABLED) \
 		NEAREST_NEIGHGBOR8 \
-	else if (config.interpolation == INTERPOLATION_LINEAR) \
+	else if (interpolation == INTERPOLATION_LINEAR) \
 		LINEAR_INTERPOLATION8(frac) \
 	else \
 		CUBIC_INTERPOLATION8(frac) \
@@ -117,9 +111,9 @@
 
 #define INTERPOLATE_SMP16(pos, frac) \
 	const int16_t *s16 = s->base16 + pos; \
-	if (config.interpolation == INTERPOLATION_DISABLED) \
+	if (interpolation == INTERPOLATION_DISABLED) \
 		NEAREST_NEIGHGBOR16 \
-	else if (config.interpolation == INTERPOLATION_LINEAR) \
+	else if (interpolation == INTERPOLATION_LINEAR) \
 		LINEAR_INTERPOLATION16(frac) \
 	else \
 		CUBIC_INTERPOLATION16(frac) \
@@ -127,9 +121,9 @@
 
 #define INTERPOLATE_SMP8_LOOP(pos, frac) \
 	const int8_t *s8 = s->base8 + pos; \
-	if (config.interpolation == INTERPOLATION_DISABLED) \
+	if (interpolation == INTERPOLATION_DISABLED) \
 		NEAREST_NEIGHGBOR8 \
-	else if (config.interpolation == INTERPOLATION_LINEAR) \
+	else if (interpolation == INTERPOLATION_LINEAR) \
 		LINEAR_INTERPOLATION8(frac) \
 	else \
 		CUBIC_INTERPOLATION8_LOOP(pos, frac) \
@@ -137,9 +131,9 @@
 
 #define INTERPOLATE_SMP16_LOOP(pos, frac) \
 	const int16_t *s16 = s->base16 + pos; \
-	if (config.interpolation == INTERPOLATION_DISABLED) \
+	if (interpolation == INTERPOLATION_DISABLED) \
 		NEAREST_NEIGHGBOR16 \
-	else if (config.interpolation == INTERPOLATION_LINEAR) \
+	else if (interpolation == INTERPOLATION_LINEAR) \
 		LINEAR_INTERPOLATION16(frac) \
 	else \
 		CUBIC_INTERPOLATION16_LOOP(pos, frac) \
@@ -253,42 +247,7 @@
 	positionFrac &= UINT32_MAX;
 
 #define SCOPE_DRAW_SMP \
-	video.frameBuffer[((lineY - sample) * SCREEN_W) + x] = color;
-
-#define LINED_SCOPE_PREPARE_SMP8 \
-	SCOPE_GET_INTERPOLATED_SMP8 \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_PREPARE_SMP16 \
-	SCOPE_GET_INTERPOLATED_SMP16 \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_PREPARE_SMP8_LOOP \
-	SCOPE_GET_INTERPOLATED_SMP8_LOOP \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_PREPARE_SMP16_LOOP \
-	SCOPE_GET_INTERPOLATED_SMP16_LOOP \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_PREPARE_SMP8_BIDI \
-	SCOPE_GET_INTERPOLATED_SMP8_BIDI \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_PREPARE_SMP16_BIDI \
-	SCOPE_GET_INTERPOLATED_SMP16_BIDI \
-	smpY1 = lineY - sample; \
-	SCOPE_UPDATE_READPOS
-
-#define LINED_SCOPE_DRAW_SMP \
-	smpY2 = lineY - sample; \
-	scopeLine(x, smpY1, smpY2, color); \
-	smpY1 = smpY2;
+	smpY[x] = (int16_t)(SCOPE_CENTER_Y - sample);
 
 #define SCOPE_HANDLE_POS_NO_LOOP \
 	if (position >= s->sampleEnd) \
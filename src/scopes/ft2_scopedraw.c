@@ -2,17 +2,17 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <assert.h>
 #include <math.h>
 #include "../ft2_config.h"
-#include "../ft2_video.h"
-#include "../ft2_palette.h"
 #include "ft2_scopes.h"
 #include "ft2_scopedraw.h"
 #include "ft2_scope_macros.h"
 
-static int16_t *scopeIntrpLUT;
+typedef void (*scopeDrawRoutine)(scope_t *, int16_t *, int32_t);
 
-static void scopeLine(int32_t x1, int32_t y1, int32_t y2, const uint32_t color);
+static int16_t *scopeIntrpLUT;
 
 bool calcScopeIntrpLUT(void)
 {
@@ -66,14 +66,14 @@ void freeScopeIntrpLUT(void)
 }
 
 /* ----------------------------------------------------------------------- */
-/*                    NON-LINED SCOPE DRAWING ROUTINES                     */
+/*                    NON-LINED SCOPE SAMPLING ROUTINES                    */
 /* ----------------------------------------------------------------------- */
 
-static void scopeDrawNoLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawNoLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP8
 		SCOPE_DRAW_SMP
@@ -82,11 +82,11 @@ static void scopeDrawNoLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_
 	}
 }
 
-static void scopeDrawLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP8
 		SCOPE_DRAW_SMP
@@ -95,11 +95,11 @@ static void scopeDrawLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t
 	}
 }
 
-static void scopeDrawBidiLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawBidiLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT_BIDI
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP8_BIDI
 		SCOPE_DRAW_SMP
@@ -108,11 +108,11 @@ static void scopeDrawBidiLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint3
 	}
 }
 
-static void scopeDrawNoLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawNoLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP16
 		SCOPE_DRAW_SMP
@@ -121,11 +121,11 @@ static void scopeDrawNoLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32
 	}
 }
 
-static void scopeDrawLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP16
 		SCOPE_DRAW_SMP
@@ -134,11 +134,11 @@ static void scopeDrawLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t
 	}
 }
 
-static void scopeDrawBidiLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void scopeDrawBidiLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	SCOPE_INIT_BIDI
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_SMP16_BIDI
 		SCOPE_DRAW_SMP
@@ -148,172 +148,213 @@ static void scopeDrawBidiLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint
 }
 
 /* ----------------------------------------------------------------------- */
-/*                       LINED SCOPE DRAWING ROUTINES                      */
+/*                      LINED SCOPE SAMPLING ROUTINES                      */
 /* ----------------------------------------------------------------------- */
 
-static void linedScopeDrawNoLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawNoLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT
-	LINED_SCOPE_PREPARE_SMP8
-	SCOPE_HANDLE_POS_NO_LOOP
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP8
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_NO_LOOP
 	}
 }
 
-static void linedScopeDrawLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT
-	LINED_SCOPE_PREPARE_SMP8_LOOP
-	SCOPE_HANDLE_POS_LOOP
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP8_LOOP
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_LOOP
 	}
 }
 
-static void linedScopeDrawBidiLoop_8bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawBidiLoop_8bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT_BIDI
-	LINED_SCOPE_PREPARE_SMP8_BIDI
-	SCOPE_HANDLE_POS_BIDI
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP8_BIDI
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_BIDI
 	}
 }
 
-static void linedScopeDrawNoLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawNoLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT
-	LINED_SCOPE_PREPARE_SMP16
-	SCOPE_HANDLE_POS_NO_LOOP
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP16
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_NO_LOOP
 	}
 }
 
-static void linedScopeDrawLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT
-	LINED_SCOPE_PREPARE_SMP16_LOOP
-	SCOPE_HANDLE_POS_LOOP
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP16_LOOP
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_LOOP
 	}
 }
 
-static void linedScopeDrawBidiLoop_16bit(scope_t *s, uint32_t x, uint32_t lineY, uint32_t w)
+static void linedScopeDrawBidiLoop_16bit(scope_t *s, int16_t *smpY, int32_t w)
 {
 	LINED_SCOPE_INIT_BIDI
-	LINED_SCOPE_PREPARE_SMP16_BIDI
-	SCOPE_HANDLE_POS_BIDI
 
-	for (; x < width; x++)
+	for (; x < w; x++)
 	{
 		SCOPE_GET_INTERPOLATED_SMP16_BIDI
-		LINED_SCOPE_DRAW_SMP
+		SCOPE_DRAW_SMP
 		SCOPE_UPDATE_READPOS
 		SCOPE_HANDLE_POS_BIDI
 	}
 }
 
-// -----------------------------------------------------------------------
+static const scopeDrawRoutine scopeDrawRoutineTable[12] =
+{
+	scopeDrawNoLoop_8bit,
+	scopeDrawLoop_8bit,
+	scopeDrawBidiLoop_8bit,
+	scopeDrawNoLoop_16bit,
+	scopeDrawLoop_16bit,
+	scopeDrawBidiLoop_16bit,
+	linedScopeDrawNoLoop_8bit,
+	linedScopeDrawLoop_8bit,
+	linedScopeDrawBidiLoop_8bit,
+	linedScopeDrawNoLoop_16bit,
+	linedScopeDrawLoop_16bit,
+	linedScopeDrawBidiLoop_16bit
+};
+
+/* ----------------------------------------------------------------------- */
+/*                        SCOPE SPANS / COMPOSITING                        */
+/* ----------------------------------------------------------------------- */
+
+/* Scopes are rendered as one vertical pixel span per column. Dots are one
+** pixel high, and connected lines are rasterized as a column-split Bresenham
+** line (same pixels as drawing every line segment separately): The first half
+** of a segment's vertical run goes into its own column, the second half into
+** the next column. Both halves meet at the sample point, so every column ends
+** up with a single contiguous span. Rows outside the scope are clipped away.
+*/
 
-static void scopeLine(int32_t x1, int32_t y1, int32_t y2, const uint32_t color)
+static void clipSpans(int16_t *top, int16_t *bottom, int32_t w)
 {
-#ifdef _DEBUG
-	if (x1 < 0 || x1 >= SCREEN_W || y1 < 0 || y1 >= SCREEN_H || y2 < 0 || y2 >= SCREEN_H)
-		return;
-#endif
+	for (int32_t x = 0; x < w; x++)
+	{
+		top[x] = CLAMP(top[x], 0, SCOPE_HEIGHT);
+		bottom[x] = CLAMP(bottom[x], -1, SCOPE_HEIGHT-1);
+	}
+}
 
-	uint32_t *dst32 = &video.frameBuffer[(y1 * SCREEN_W) + x1];
+static void calcDotSpans(const int16_t *smpY, int16_t *top, int16_t *bottom, int32_t w)
+{
+	for (int32_t x = 0; x < w; x++)
+		top[x] = bottom[x] = smpY[x];
 
-	*dst32 = color; // set first pixel
+	clipSpans(top, bottom, w);
+}
 
-	const int32_t dy = y2 - y1;
-	if (dy == 0) // y1 == y2
+static void calcLineSpans(const int16_t *smpY, int16_t *top, int16_t *bottom, int32_t w)
+{
+	// the first column only has the first half of the first segment
+	int32_t y = smpY[0];
+	int32_t yHalf = y + ((smpY[1] - y) / 2);
+	top[0] = (int16_t)MIN(y, yHalf);
+	bottom[0] = (int16_t)MAX(y, yHalf);
+
+	for (int32_t x = 1; x < w-1; x++)
 	{
-		dst32[1] = color;
-		return;
+		y = smpY[x];
+
+		// end of the first half of this segment
+		yHalf = y + ((smpY[x+1] - y) / 2);
+
+		// start of the second half of the previous segment (or the sample point if it's flat)
+		const int32_t dyPrev = y - smpY[x-1];
+		const int32_t yPrev = smpY[x-1] + (dyPrev / 2) + ((dyPrev > 0) - (dyPrev < 0));
+
+		top[x] = (int16_t)MIN(MIN(y, yHalf), yPrev);
+		bottom[x] = (int16_t)MAX(MAX(y, yHalf), yPrev);
 	}
 
-	uint32_t ay = ABS(dy);
-	int32_t d = 1 - ay;
+	// the last column only has the second half of the last segment
+	y = smpY[w-1];
+	const int32_t dyPrev = y - smpY[w-2];
+	const int32_t yPrev = smpY[w-2] + (dyPrev / 2) + ((dyPrev > 0) - (dyPrev < 0));
+	top[w-1] = (int16_t)MIN(y, yPrev);
+	bottom[w-1] = (int16_t)MAX(y, yPrev);
 
-	ay <<= 1;
+	clipSpans(top, bottom, w);
+}
 
-	if (y1 > y2)
+void clearScopeRowSpans(scopeRowSpans_t *spans) // leaves all columns untouched when composited
+{
+	for (int32_t x = 0; x < SCOPE_ROW_WIDTH; x++)
 	{
-		for (; y1 != y2; y1--)
-		{
-			if (d >= 0)
-			{
-				d -= ay;
-				dst32++;
-			}
-
-			d += 2;
-
-			dst32 -= SCREEN_W;
-			*dst32 = color;
-		}
+		spans->top[x] = SCOPE_HEIGHT;
+		spans->bottom[x] = -1;
+		spans->keepMask[x] = 0xFF;
 	}
+}
+
+void renderScope(scope_t *s, scopeRowSpans_t *spans, int32_t x, int32_t w, bool linedScopes)
+{
+	int16_t smpY[SCOPE_ROW_WIDTH];
+
+	assert(w >= 2 && x+w <= SCOPE_ROW_WIDTH);
+
+	scopeDrawRoutineTable[(linedScopes * 6) + (s->sample16Bit * 3) + s->loopType](s, smpY, w);
+
+	if (linedScopes)
+		calcLineSpans(smpY, &spans->top[x], &spans->bottom[x], w);
 	else
+		calcDotSpans(smpY, &spans->top[x], &spans->bottom[x], w);
+
+	memset(&spans->keepMask[x], 0, w);
+}
+
+void renderEmptyScope(scopeRowSpans_t *spans, int32_t x, int32_t w)
+{
+	assert(x+w <= SCOPE_ROW_WIDTH);
+
+	for (int32_t i = x; i < x+w; i++)
 	{
-		for (; y1 != y2; y1++)
-		{
-			if (d >= 0)
-			{
-				d -= ay;
-				dst32++;
-			}
-
-			d += 2;
-
-			dst32 += SCREEN_W;
-			*dst32 = color;
-		}
+		spans->top[i] = spans->bottom[i] = SCOPE_CENTER_Y;
+		spans->keepMask[i] = 0;
 	}
 }
 
-// -----------------------------------------------------------------------
-
-const scopeDrawRoutine scopeDrawRoutineTable[12] =
+// draws a whole row of scopes (clearing their background), leaving skipped columns untouched
+void compositeScopeRow(uint8_t *dstPtr, const scopeRowSpans_t *spans, uint8_t color)
 {
-	(scopeDrawRoutine)scopeDrawNoLoop_8bit,
-	(scopeDrawRoutine)scopeDrawLoop_8bit,
-	(scopeDrawRoutine)scopeDrawBidiLoop_8bit,
-	(scopeDrawRoutine)scopeDrawNoLoop_16bit,
-	(scopeDrawRoutine)scopeDrawLoop_16bit,
-	(scopeDrawRoutine)scopeDrawBidiLoop_16bit,
-	(scopeDrawRoutine)linedScopeDrawNoLoop_8bit,
-	(scopeDrawRoutine)linedScopeDrawLoop_8bit,
-	(scopeDrawRoutine)linedScopeDrawBidiLoop_8bit,
-	(scopeDrawRoutine)linedScopeDrawNoLoop_16bit,
-	(scopeDrawRoutine)linedScopeDrawLoop_16bit,
-	(scopeDrawRoutine)linedScopeDrawBidiLoop_16bit
-};
+	const int16_t *top = spans->top;
+	const int16_t *bottom = spans->bottom;
+	const uint8_t *keepMask = spans->keepMask;
+
+	for (int32_t y = 0; y < SCOPE_HEIGHT; y++, dstPtr += SCREEN_W)
+	{
+		// branchless, so that the compiler can vectorize it
+		for (int32_t x = 0; x < SCOPE_ROW_WIDTH; x++)
+			dstPtr[x] = (dstPtr[x] & keepMask[x]) | ((y >= top[x] && y <= bottom[x]) ? color : PAL_BCKGRND);
+	}
+}
@@ -1,11 +1,23 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "ft2_scopes.h"
 
-typedef void (*scopeDrawRoutine)(const scope_t *, uint32_t, uint32_t, uint32_t);
+#define SCOPE_ROW_WIDTH 285 /* total width of a row of scopes (plus the gaps between them) */
+#define SCOPE_CENTER_Y 17 /* y position of the scopes' center line (relative to the top of the scopes) */
 
-extern const scopeDrawRoutine scopeDrawRoutineTable[12]; // ft2_scopedraw.c
+// a row of scopes, rendered as one vertical pixel span per column (relative to the top of the scopes)
+typedef struct scopeRowSpans_t
+{
+	int16_t top[SCOPE_ROW_WIDTH], bottom[SCOPE_ROW_WIDTH];
+	uint8_t keepMask[SCOPE_ROW_WIDTH]; // 0xFF = column is left untouched
+} scopeRowSpans_t;
+
+void clearScopeRowSpans(scopeRowSpans_t *spans);
+void renderScope(scope_t *s, scopeRowSpans_t *spans, int32_t x, int32_t w, bool linedScopes);
+void renderEmptyScope(scopeRowSpans_t *spans, int32_t x, int32_t w);
+void compositeScopeRow(uint8_t *dstPtr, const scopeRowSpans_t *spans, uint8_t color);
 
 bool calcScopeIntrpLUT(void);
 void freeScopeIntrpLUT(void);
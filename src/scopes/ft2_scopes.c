@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include <math.h> // modf()
 #ifndef _WIN32
 #include <unistd.h> // usleep()
@@ -24,19 +25,59 @@
 #include "ft2_scopes.h"
 #include "ft2_scopedraw.h"
 
-static volatile bool scopesUpdatingFlag, scopesDisplayingFlag;
+static volatile bool scopesDisplayingFlag;
+static bool scopeWasCleared[MAX_CHANNELS];
 static hpc_t scopeHpc;
-static volatile scope_t scope[MAX_CHANNELS];
 static SDL_Thread *scopeThread;
+static scopeRowSpans_t scopeRowSpans[2];
+
+/* The scope thread and the tracker thread (triggers, volume/period changes)
+** both modify the live scope states, so they are only touched with scopeLock
+** held. After every change, a copy of them is published to scopeSnapshot[].
+** Readers (scope drawing etc.) only ever read the snapshot and never block.
+*/
+static SDL_SpinLock scopeLock;
+static scope_t scope[MAX_CHANNELS];
+static scope_t scopeSnapshot[2][MAX_CHANNELS];
+static SDL_atomic_t scopeSnapshotSeq;
 
 lastChInstr_t lastChInstr[MAX_CHANNELS]; // global
 
+/* The snapshot is double-buffered and written one copy at a time, with the
+** sequence counter telling the readers which copy is not being written to.
+** If a new snapshot was published while reading, the read is retried.
+** Must be called with scopeLock held.
+*/
+static void publishScopes(void)
+{
+	SDL_AtomicIncRef(&scopeSnapshotSeq); // odd: readers use copy #1
+	memcpy(scopeSnapshot[0], scope, sizeof (scope));
+	SDL_MemoryBarrierRelease();
+
+	SDL_AtomicIncRef(&scopeSnapshotSeq); // even: readers use copy #0
+	memcpy(scopeSnapshot[1], scope, sizeof (scope));
+	SDL_MemoryBarrierRelease();
+}
+
+static void readScopes(scope_t *dst, int32_t firstCh, int32_t numChannels)
+{
+	int32_t seq;
+	do
+	{
+		seq = SDL_AtomicGet(&scopeSnapshotSeq);
+		memcpy(dst, &scopeSnapshot[seq & 1][firstCh], numChannels * sizeof (scope_t));
+		SDL_MemoryBarrierAcquire();
+	}
+	while (SDL_AtomicGet(&scopeSnapshotSeq) != seq);
+}
+
 int32_t getSamplePositionFromScopes(uint8_t ch)
 {
 	if (ch >= song.numChannels)
 		return -1;
 
-	volatile scope_t sc = scope[ch]; // cache it
+	scope_t sc;
+	readScopes(&sc, ch, 1);
 
 	if (!sc.active || sc.sampleEnd == 0)
 		return -1;
@@ -52,15 +93,32 @@ int32_t getSamplePositionFromScopes(uint8_t ch)
 	return -1; // not active or overflown
 }
 
+bool scopesUseSmpData(const int8_t *dataPtr)
+{
+	scope_t s[MAX_CHANNELS];
+	readScopes(s, 0, MAX_CHANNELS);
+
+	const scope_t *sc = s;
+	for (int32_t i = 0; i < MAX_CHANNELS; i++, sc++)
+	{
+		if (sc->active && (sc->base8 == dataPtr || (const int8_t *)sc->base16 == dataPtr))
+			return true;
+	}
+
+	return false;
+}
+
 void stopAllScopes(void)
 {
-	// wait for scopes to finish updating
-	while (scopesUpdatingFlag);
-	
-	volatile scope_t *sc = scope;
+	SDL_AtomicLock(&scopeLock);
+
+	scope_t *sc = scope;
 	for (int32_t i = 0; i < MAX_CHANNELS; i++, sc++)
 		sc->active = false;
 
+	publishScopes();
+	SDL_AtomicUnlock(&scopeLock);
+
 	// wait for scope displaying to be done (safety)
 	while (scopesDisplayingFlag);
 }
@@ -87,7 +145,7 @@ static void setChannel(int32_t chNr, bool on)
 		ch->keyOff = true; // non-FT2 bug fix for stuck piano keys
 	}
 
-	scope[chNr].wasCleared = false;
+	scopeWasCleared[chNr] = false;
 }
 
 static void drawScopeNumber(uint16_t scopeXOffs, uint16_t scopeYOffs, uint8_t chNr, bool outline)
@@ -168,13 +226,13 @@ static void redrawScope(int32_t ch)
 			drawScopeNumber(x + 1, y + 1, (uint8_t)i, true);
 	}
 
-	scope[ch].wasCleared = false;
+	scopeWasCleared[ch] = false;
 }
 
 void refreshScopes(void)
 {
 	for (int32_t i = 0; i < MAX_CHANNELS; i++)
-		scope[i].wasCleared = false;
+		scopeWasCleared[i] = false;
 }
 
 static void channelMode(int32_t chn)
@@ -277,10 +335,10 @@ bool testScopesMouseDown(void)
 	return false;
 }
 
-static void scopeTrigger(int32_t ch, const sample_t *s, int32_t playOffset)
+static void scopeTrigger(int32_t ch, const sample_t *s, int32_t playOffset) // scopeLock must be held
 {
-	volatile scope_t tempState;
-	volatile scope_t *sc = &scope[ch];
+	scope_t tempState;
+	scope_t *sc = &scope[ch];
 
 	int32_t length = s->length;
 	int32_t loopStart = s->loopStart;
@@ -321,6 +379,7 @@ static void scopeTrigger(int32_t ch, const sample_t *s, int32_t playOffset)
 	tempState.loopEnd = loopEnd;
 	tempState.position = playOffset;
 	tempState.positionFrac = 0;
+	tempState.time64 = SDL_GetPerformanceCounter();
 	
 	// if position overflows (f.ex. through 9xx command), shut down scopes
 	if (tempState.position >= tempState.sampleEnd)
@@ -331,143 +390,174 @@ static void scopeTrigger(int32_t ch, const sample_t *s, int32_t playOffset)
 
 	tempState.active = true;
 
-	/* Update live scope now.
-	** In theory it -can- be written to in the middle of a cached read,
-	** then the read thread writes its own non-updated cached copy back and
-	** the trigger never happens. So far I have never seen it happen,
-	** so it's probably very rare. Yes, this is not good coding...
-	*/
-
 	*sc = tempState; // set new scope state
 }
 
-static void updateScopes(void)
+static void advanceScope(scope_t *s, uint64_t delta)
 {
-	scopesUpdatingFlag = true;
+	s->positionFrac += delta;
+	s->position += s->positionFrac >> SCOPE_FRAC_BITS;
+	s->positionFrac &= SCOPE_FRAC_MASK;
 
-	volatile scope_t *sc = scope;
-	for (int32_t i = 0; i < song.numChannels; i++, sc++)
+	if (s->position >= s->sampleEnd)
 	{
-		volatile scope_t s = *sc; // get copy of current scope state
-		if (!s.active)
-			continue; // scope is not active
-
-		// scope position update
-
-		s.positionFrac += s.delta;
-		s.position += s.positionFrac >> SCOPE_FRAC_BITS;
-		s.positionFrac &= SCOPE_FRAC_MASK;
-
-		if (s.position >= s.sampleEnd)
+		if (s->loopType == LOOP_BIDI)
 		{
-			if (s.loopType == LOOP_BIDI)
-			{
-				if (s.loopLength >= 2)
-				{
-					// wrap as forward loop (position is inverted if sampling backwards, when needed)
-
-					const uint32_t overflow = s.position - s.sampleEnd;
-					const uint32_t cycles = overflow / s.loopLength;
-					const uint32_t phase = overflow % s.loopLength;
-
-					s.position = s.loopStart + phase;
-					s.samplingBackwards ^= !(cycles & 1);
-				}
-				else
-				{
-					s.position = s.loopStart;
-				}
-
-				s.hasLooped = true;
-			}
-			else if (s.loopType == LOOP_FORWARD)
+			if (s->loopLength >= 2)
 			{
-				if (s.loopLength >= 2)
-					s.position = s.loopStart + ((s.position - s.sampleEnd) % s.loopLength);
-				else
-					s.position = s.loopStart;
+				// wrap as forward loop (position is inverted if sampling backwards, when needed)
+
+				const uint32_t overflow = s->position - s->sampleEnd;
+				const uint32_t cycles = overflow / s->loopLength;
+				const uint32_t phase = overflow % s->loopLength;
 
-				s.hasLooped = true;
+				s->position = s->loopStart + phase;
+				s->samplingBackwards ^= !(cycles & 1);
 			}
-			else // no loop
+			else
 			{
-				s.active = false;
+				s->position = s->loopStart;
 			}
+
+			s->hasLooped = true;
 		}
+		else if (s->loopType == LOOP_FORWARD)
+		{
+			if (s->loopLength >= 2)
+				s->position = s->loopStart + ((s->position - s->sampleEnd) % s->loopLength);
+			else
+				s->position = s->loopStart;
+
+			s->hasLooped = true;
+		}
+		else // no loop
+		{
+			s->active = false;
+		}
+	}
+}
+
+/* The scope thread only advances the scopes at SCOPE_HZ. Advance our copy to the
+** actual frame time, so that the scopes move smoothly at any display refresh rate.
+*/
+static void catchUpScope(scope_t *s, uint64_t time64)
+{
+	if (time64 <= s->time64)
+		return;
+
+	double dScopeTicks = (time64 - s->time64) * ((double)SCOPE_HZ / hpcFreq.freq64);
+	if (dScopeTicks > 1.0)
+		dScopeTicks = 1.0; // scope thread was stalled, don't run ahead of it too far
+
+	advanceScope(s, (uint64_t)(s->delta * dScopeTicks));
+}
+
+static void updateScopes(void)
+{
+	SDL_AtomicLock(&scopeLock);
+
+	const uint64_t time64 = SDL_GetPerformanceCounter();
+
+	scope_t *sc = scope;
+	for (int32_t i = 0; i < song.numChannels; i++, sc++)
+	{
+		if (!sc->active)
+			continue; // scope is not active
 
-		*sc = s; // set new scope state
+		advanceScope(sc, sc->delta); // scope position update
+		sc->time64 = time64;
 	}
-	scopesUpdatingFlag = false;
+
+	publishScopes();
+	SDL_AtomicUnlock(&scopeLock);
 }
 
 void drawScopes(void)
 {
+	scope_t s[MAX_CHANNELS];
+
 	scopesDisplayingFlag = true;
-	int32_t chansPerRow = (uint32_t)song.numChannels >> 1;
 
+	const int32_t numChannels = song.numChannels;
+	const int32_t chansPerRow = (uint32_t)numChannels >> 1;
 	const uint16_t *scopeLens = scopeLenTab[chansPerRow-1];
-	uint16_t scopeXOffs = 3;
-	uint16_t scopeYOffs = 95;
-	int16_t scopeLineY = 112;
+	const bool linedScopesFlag = !!(config.specialFlags & LINED_SCOPES);
 
-	for (int32_t i = 0; i < song.numChannels; i++)
+	readScopes(s, 0, numChannels); // get a consistent copy of all scopes
+	const uint64_t time64 = SDL_GetPerformanceCounter();
+
+	// render scopes that need to be redrawn into the span buffers of their scope row
+
+	clearScopeRowSpans(&scopeRowSpans[0]);
+	clearScopeRowSpans(&scopeRowSpans[1]);
+
+	scopeRowSpans_t *spans = &scopeRowSpans[0];
+	int32_t x = 0;
+
+	for (int32_t i = 0; i < numChannels; i++)
 	{
 		// if we reached the last scope on the row, go to first scope on the next row
 		if (i == chansPerRow)
 		{
-			scopeXOffs = 3;
-			scopeYOffs = 134;
-			scopeLineY = 151;
-		}
-
-		const uint16_t scopeDrawLen = scopeLens[i];
-		if (!editor.chnMode[i]) // scope muted (mute graphics blit()'ed elsewhere)
-		{
-			scopeXOffs += scopeDrawLen+3; // align x to next scope
-			continue;
+			spans = &scopeRowSpans[1];
+			x = 0;
 		}
 
-		volatile scope_t s = scope[i]; // cache scope to lower thread race condition issues
-		if (s.active && s.volume > 0 && !audio.locked)
+		const int32_t scopeDrawLen = scopeLens[i];
+		if (editor.chnMode[i]) // scope not muted (mute graphics blit()'ed elsewhere)
 		{
-			// scope is active
-			scope[i].wasCleared = false;
+			if (s[i].active)
+				catchUpScope(&s[i], time64);
 
-			// get relative voice Hz (in relation to C4/2 rate)
-			s.drawDelta = (uint64_t)(scope[i].delta * ((double)SCOPE_HZ / ((double)C4_FREQ / 2.0)));
+			if (s[i].active && s[i].volume > 0 && !audio.locked)
+			{
+				// scope is active
+				scopeWasCleared[i] = false;
 
-			// clear scope background
-			clearRect(scopeXOffs, scopeYOffs, scopeDrawLen, SCOPE_HEIGHT);
+				// get relative voice Hz (in relation to C4/2 rate)
+				s[i].drawDelta = (uint64_t)(s[i].delta * ((double)SCOPE_HZ / ((double)C4_FREQ / 2.0)));
 
-			// draw scope
-			bool linedScopesFlag = !!(config.specialFlags & LINED_SCOPES);
-			scopeDrawRoutineTable[(linedScopesFlag * 6) + (s.sample16Bit * 3) + s.loopType]((const scope_t *)&s, scopeXOffs, scopeLineY, scopeDrawLen);
-		}
-		else
-		{
-			// scope is inactive
-			volatile scope_t *sc = &scope[i];
-			if (!sc->wasCleared)
+				renderScope(&s[i], spans, x, scopeDrawLen, linedScopesFlag);
+			}
+			else if (!scopeWasCleared[i])
 			{
-				// clear scope background
-				clearRect(scopeXOffs, scopeYOffs, scopeDrawLen, SCOPE_HEIGHT);
+				// scope is inactive, draw empty line
+				renderEmptyScope(spans, x, scopeDrawLen);
+				scopeWasCleared[i] = true;
+			}
+		}
 
-				// draw empty line
-				hLine(scopeXOffs, scopeLineY, scopeDrawLen, PAL_PATTEXT);
+		x += scopeDrawLen+3; // align x to next scope
+	}
 
-				sc->wasCleared = true;
-			}
+	// composite both scope rows into the frame buffer (this also clears the background of redrawn scopes)
+	const uint8_t color = PAL_PATTEXT;
+	compositeScopeRow(&video.frameBuffer[( 95 * SCREEN_W) + 3], &scopeRowSpans[0], color);
+	compositeScopeRow(&video.frameBuffer[(134 * SCREEN_W) + 3], &scopeRowSpans[1], color);
+
+	uint16_t scopeXOffs = 3;
+	uint16_t scopeYOffs = 95;
+
+	for (int32_t i = 0; i < numChannels; i++)
+	{
+		if (i == chansPerRow)
+		{
+			scopeXOffs = 3;
+			scopeYOffs = 134;
 		}
 
-		// draw channel numbering (if enabled)
-		if (config.ptnChnNumbers)
-			drawScopeNumber(scopeXOffs, scopeYOffs, (uint8_t)i, false);
+		if (editor.chnMode[i])
+		{
+			// draw channel numbering (if enabled)
+			if (config.ptnChnNumbers)
+				drawScopeNumber(scopeXOffs, scopeYOffs, (uint8_t)i, false);
 
-		// draw rec. symbol (if enabled)
-		if (config.multiRecChn[i])
-			blit(scopeXOffs + 1, scopeYOffs + 31, bmp.scopeRec, 13, 4);
+			// draw rec. symbol (if enabled)
+			if (config.multiRecChn[i])
+				blit(scopeXOffs + 1, scopeYOffs + 31, bmp.scopeRec, 13, 4);
+		}
 
-		scopeXOffs += scopeDrawLen+3; // align x to next scope
+		scopeXOffs += scopeLens[i]+3; // align x to next scope
 	}
 
 	scopesDisplayingFlag = false;
@@ -482,19 +572,21 @@ void drawScopeFramework(void)
 
 void handleScopesFromChQueue(chSyncData_t *chSyncData, uint8_t *scopeUpdateStatus)
 {
-	volatile scope_t *sc = scope;
+	SDL_AtomicLock(&scopeLock);
+
+	scope_t *sc = scope;
 	syncedChannel_t *ch = chSyncData->channels;
 	for (int32_t i = 0; i < song.numChannels; i++, sc++, ch++)
 	{
 		const uint8_t status = scopeUpdateStatus[i];
 
-		if (status & IS_Vol)
+		if (status & (IS_Vol + IS_ScopeTrigger))
 			sc->volume = ch->scopeVolume;
 
-		if (status & IS_Period)
+		if (status & (IS_Period + IS_ScopeTrigger))
 			sc->delta = (uint64_t)(dPeriod2Hz(ch->period) * (SCOPE_FRAC_SCALE / (double)SCOPE_HZ));
 
-		if (status & IS_Trigger)
+		if (status & (IS_Trigger + IS_ScopeTrigger))
 		{
 			if (instr[ch->instrNum] != NULL)
 			{
@@ -511,12 +603,15 @@ void handleScopesFromChQueue(chSyncData_t *chSyncData, uint8_t *scopeUpdateStatu
 			else
 			{
 				// empty instrument, shut down scope
-				scope[i].active = false;
+				sc->active = false;
 				lastChInstr[i].instrNum = 255;
 				lastChInstr[i].smpNum = 255;
 			}
 		}
 	}
+
+	publishScopes();
+	SDL_AtomicUnlock(&scopeLock);
 }
 
 static int32_t SDLCALL scopeThreadFunc(void *ptr)
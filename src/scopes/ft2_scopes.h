@@ -25,6 +25,7 @@
 
 int32_t getSamplePositionFromScopes(uint8_t ch);
 void stopAllScopes(void);
+bool scopesUseSmpData(const int8_t *dataPtr);
 void refreshScopes(void);
 bool testScopesMouseDown(void);
 void drawScopes(void);
@@ -34,13 +35,14 @@ bool initScopes(void);
 // actual scope data
 typedef struct scope_t
 {
-	volatile bool active;
+	bool active;
 	const int8_t *base8;
 	const int16_t *base16;
-	bool wasCleared, sample16Bit, samplingBackwards, hasLooped;
+	bool sample16Bit, samplingBackwards, hasLooped;
 	uint8_t loopType;
 	int32_t volume, loopStart, loopLength, loopEnd, sampleEnd, position;
 	uint64_t delta, drawDelta, positionFrac;
+	uint64_t time64; // performance counter time of the last position update
 
 	// if (loopEnabled && hasLooped && samplingPos <= loopStart+MAX_LEFT_TAPS) readFixedTapsFromThisPointer();
 	const int8_t *leftEdgeTaps8;
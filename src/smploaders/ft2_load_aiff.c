@@ -18,17 +18,12 @@
 static double getAIFFSampleRate(uint8_t *in);
 static bool aiffIsStereo(FILE *f); // only ran on files that are confirmed to be AIFFs
 
-bool loadAIFF(FILE *f, uint32_t filesize)
+bool loadAIFF(FILE *f, uint32_t filesize, sample_t *s)
 {
 	char compType[4];
-	int8_t *audioDataS8;
-	uint8_t sampleRateBytes[10], *audioDataU8;
-	int16_t *audioDataS16, smp16;
+	uint8_t sampleRateBytes[10];
 	uint16_t numChannels, bitDepth;
-	int32_t *audioDataS32;
-	uint32_t i, blockName, blockSize;
-	uint32_t offset, len32;
-	sample_t *s = &tmpSmp;
+	uint32_t blockName, blockSize, offset;
 
 	fseek(f, 8, SEEK_SET);
 	fread(compType, 1, 4, f);
@@ -149,432 +144,24 @@ bool loadAIFF(FILE *f, uint32_t filesize)
 
 	int16_t stereoSampleLoadMode = -1;
 	if (aiffIsStereo(f))
-		stereoSampleLoadMode = loaderSysReq(4, "System request", "This is a stereo sample...", NULL);
-
-	// read sample data
-
-	if (!floatSample && bitDepth == 8) // 8-BIT INTEGER SAMPLE
-	{
-		if (!allocateSmpData(s, sampleLength, false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, 1, f) != 1)
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataS8 = (int8_t *)s->dataPtr;
-		if (!signedSample)
-		{
-			for (i = 0; i < sampleLength; i++)
-				audioDataS8[i] ^= 0x80;
-		}
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					for (i = 1; i < sampleLength; i++)
-						audioDataS8[i] = audioDataS8[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS8[i] = audioDataS8[(i * 2) + 1];
-
-					audioDataS8[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						smp16 = (audioDataS8[(i * 2) + 0] + audioDataS8[(i * 2) + 1]) >> 1;
-						audioDataS8[i] = (int8_t)smp16;
-					}
-
-					audioDataS8[i] = 0;
-				}
-				break;
-			}
-		}
-	}
-	else if (!floatSample && bitDepth == 16) // 16-BIT INTEGER SAMPLE
-	{
-		sampleLength /= sizeof (int16_t);
-		if (!allocateSmpData(s, sampleLength * sizeof (int16_t), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (int16_t), f) != sizeof (int16_t))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		// change endianness
-		audioDataS16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS16[i] = SWAP16(audioDataS16[i]);
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					for (i = 1; i < sampleLength; i++)
-						audioDataS16[i] = audioDataS16[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS16[i] = audioDataS16[(i * 2) + 1];
-
-					audioDataS16[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int32_t smp32 = (audioDataS16[(i * 2) + 0] + audioDataS16[(i * 2) + 1]) >> 1;
-						audioDataS16[i] = (int16_t)smp32;
-					}
-
-					audioDataS16[i] = 0;
-				}
-				break;
-			}
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (!floatSample && bitDepth == 24) // 24-BIT INTEGER SAMPLE
-	{
-		sampleLength /= 3;
-		if (!allocateSmpData(s, sampleLength * sizeof (int32_t), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(&s->dataPtr[sampleLength], sampleLength, 3, f) != 3)
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataS32 = (int32_t *)s->dataPtr;
-
-		// convert to 32-bit
-		audioDataU8 = (uint8_t *)s->dataPtr + sampleLength;
-		for (i = 0; i < sampleLength; i++)
-		{
-			audioDataS32[i] = (audioDataU8[0] << 24) | (audioDataU8[1] << 16) | (audioDataU8[2] << 8);
-			audioDataU8 += 3;
-		}
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					for (i = 1; i < sampleLength; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 1];
-
-					audioDataS32[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int64_t smp64 = audioDataS32[(i * 2) + 0];
-						smp64 += audioDataS32[(i * 2) + 1];
-						smp64 >>= 1;
-
-						audioDataS32[i] = (int32_t)smp64;
-					}
-
-					audioDataS32[i] = 0;
-				}
-				break;
-			}
-		}
-
-		normalizeSigned32Bit(audioDataS32, sampleLength);
-
-		audioDataS16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS16[i] = audioDataS32[i] >> 16;
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (!floatSample && bitDepth == 32) // 32-BIT INTEGER SAMPLE
-	{
-		sampleLength /= sizeof (int32_t);
-		if (!allocateSmpData(s, sampleLength * sizeof (int32_t), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (int32_t), f) != sizeof (int32_t))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		// change endianness
-		audioDataS32 = (int32_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS32[i] = SWAP32(audioDataS32[i]);
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					for (i = 1; i < sampleLength; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 1];
-
-					audioDataS32[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int64_t smp64 = audioDataS32[(i * 2) + 0];
-						smp64 += audioDataS32[(i * 2) + 1];
-						smp64 >>= 1;
-
-						audioDataS32[i] = (int32_t)smp64;
-					}
-
-					audioDataS32[i] = 0;
-				}
-				break;
-			}
-		}
-
-		normalizeSigned32Bit(audioDataS32, sampleLength);
-
-		audioDataS16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS16[i] = audioDataS32[i] >> 16;
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (floatSample && bitDepth == 32) // 32-BIT FLOAT SAMPLE
-	{
-		sampleLength /= sizeof (float);
-		if (!allocateSmpData(s, sampleLength * sizeof (float), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (float), f) != sizeof (float))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		// change endianness
-		audioDataS32 = (int32_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS32[i] = SWAP32(audioDataS32[i]);
-
-		float *fAudioDataFloat = (float *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						fAudioDataFloat[i] = fAudioDataFloat[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						fAudioDataFloat[i] = fAudioDataFloat[(i * 2) + 1];
-
-					fAudioDataFloat[i] = 0.0f;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						fAudioDataFloat[i] = (fAudioDataFloat[(i * 2) + 0] + fAudioDataFloat[(i * 2) + 1]) * 0.5f;
-
-					fAudioDataFloat[i] = 0.0f;
-				}
-				break;
-			}
-		}
-
-		normalize32BitFloatToSigned16Bit(fAudioDataFloat, sampleLength);
-
-		int16_t *ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-		{
-			const int32_t smp32 = (const int32_t)fAudioDataFloat[i];
-			ptr16[i] = (int16_t)smp32;
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (floatSample && bitDepth == 64) // 64-BIT FLOAT SAMPLE
-	{
-		sampleLength /= sizeof (double);
-		if (!allocateSmpData(s, sampleLength * sizeof (double), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (double), f) != sizeof (double))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		// change endianness
-		int64_t *audioDataS64 = (int64_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			audioDataS64[i] = SWAP64(audioDataS64[i]);
-
-		double *dAudioDataDouble = (double *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						dAudioDataDouble[i] = dAudioDataDouble[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						dAudioDataDouble[i] = dAudioDataDouble[(i * 2) + 1];
-
-					dAudioDataDouble[i] = 0.0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						dAudioDataDouble[i] = (dAudioDataDouble[(i * 2) + 0] + dAudioDataDouble[(i * 2) + 1]) * 0.5;
-
-					dAudioDataDouble[i] = 0.0;
-				}
-				break;
-			}
-		}
-
-		normalize64BitFloatToSigned16Bit(dAudioDataDouble, sampleLength);
-
-		int16_t *ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-		{
-			const int32_t smp32 = (const int32_t)dAudioDataDouble[i];
-			ptr16[i] = (int16_t)smp32;
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-
-	if (sampleLength > MAX_SAMPLE_LEN)
-		sampleLength = MAX_SAMPLE_LEN;
-
-	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
-	reallocateSmpData(s, sampleLength, sample16Bit); // readjust memory needed
+		stereoSampleLoadMode = askStereoSampleLoadMode();
+
+	int8_t pcmFormat;
+	if (floatSample)
+		pcmFormat = (bitDepth == 64) ? PCM_FORMAT_DOUBLE : PCM_FORMAT_FLOAT;
+	else if (bitDepth == 8)
+		pcmFormat = signedSample ? PCM_FORMAT_S8 : PCM_FORMAT_U8;
+	else if (bitDepth == 16)
+		pcmFormat = PCM_FORMAT_S16;
+	else if (bitDepth == 24)
+		pcmFormat = PCM_FORMAT_S24;
+	else
+		pcmFormat = PCM_FORMAT_S32;
+
+	const uint32_t numFrames = sampleLength / ((bitDepth / 8) * numChannels);
+	if (!loadPCMSampleData(f, s, numFrames, pcmFormat, true, (uint8_t)numChannels, stereoSampleLoadMode))
+		return false;
 
-	s->length = sampleLength;
 	s->volume = 64;
 	s->panning = 128;
 
@@ -15,8 +15,6 @@
 
 #define BRR_RATIO(x) (((x) * 16) / 9)
 
-static int16_t s1, s2;
-
 bool detectBRR(FILE *f)
 {
 	if (f == NULL)
@@ -74,7 +72,8 @@ error:
 	return false;
 }
 
-static int16_t decodeSample(int8_t nybble, int32_t shift, int32_t filter)
+// s1/s2 are the last two decoded samples (15-bit)
+static int16_t decodeSample(int8_t nybble, int32_t shift, int32_t filter, int16_t *s1, int16_t *s2)
 {
 	int32_t smp = (nybble << shift) >> 1;
 	if (shift >= 13)
@@ -85,17 +84,17 @@ static int16_t decodeSample(int8_t nybble, int32_t shift, int32_t filter)
 		default: break;
 
 		case 1:
-			smp += (s1 * 15) >> 4;
+			smp += (*s1 * 15) >> 4;
 			break;
 
 		case 2:
-			smp += (s1 * 61) >> 5;
-			smp -= (s2 * 15) >> 4;
+			smp += (*s1 * 61) >> 5;
+			smp -= (*s2 * 15) >> 4;
 			break;
 
 		case 3:
-			smp += (s1 * 115) >> 6;
-			smp -= (s2 *  13) >> 4;
+			smp += (*s1 * 115) >> 6;
+			smp -= (*s2 *  13) >> 4;
 			break;
 	}
 
@@ -109,16 +108,14 @@ static int16_t decodeSample(int8_t nybble, int32_t shift, int32_t filter)
 		smp &= 16383;
 
 	// shuffle last samples (store as 15-bit sample)
-	s2 = s1;
-	s1 = (int16_t)smp;
+	*s2 = *s1;
+	*s1 = (int16_t)smp;
 
 	return (int16_t)(smp << 1); // multiply by two to get 16-bit scale
 }
 
-bool loadBRR(FILE *f, uint32_t filesize)
+bool loadBRR(FILE *f, uint32_t filesize, sample_t *s)
 {
-	sample_t *s = &tmpSmp;
-
 	uint32_t blockBytes = filesize, loopStart = 0;
 	if ((filesize % 9) == 2) // loop header present
 	{
@@ -138,7 +135,7 @@ bool loadBRR(FILE *f, uint32_t filesize)
 	uint32_t shift = 0, filter = 0;
 	bool loopFlag = false, endFlag = false;
 
-	s1 = s2 = 0; // clear last BRR samples (for decoding)
+	int16_t s1 = 0, s2 = 0; // last BRR samples (for decoding)
 
 	int16_t *ptr16 = (int16_t *)s->dataPtr;
 	for (uint32_t i = 0; i < blockBytes; i++)
@@ -156,8 +153,8 @@ bool loadBRR(FILE *f, uint32_t filesize)
 		}
 
 		// decode samples
-		*ptr16++ = decodeSample((int8_t)byte >> 4, shift, filter);
-		*ptr16++ = decodeSample((int8_t)(byte << 4) >> 4, shift, filter);
+		*ptr16++ = decodeSample((int8_t)byte >> 4, shift, filter, &s1, &s2);
+		*ptr16++ = decodeSample((int8_t)(byte << 4) >> 4, shift, filter, &s1, &s2);
 
 		if (endFlag && blockOffset == 8)
 		{
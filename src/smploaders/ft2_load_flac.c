@@ -32,10 +32,15 @@
 #include "../libflac/FLAC/stream_decoder.h"
 #endif
 
-static bool sample16Bit;
-static int16_t stereoSampleLoadMode = -1;
-static uint32_t numChannels, bitDepth, sampleLength, sampleRate, samplesRead;
-static sample_t *s;
+// decoder state, passed to the callbacks so that several FLACs can be loaded at once
+typedef struct flacLoader_t
+{
+	FILE *f;
+	sample_t *s;
+	bool sample16Bit;
+	int16_t stereoSampleLoadMode;
+	uint32_t numChannels, bitDepth, sampleLength, sampleRate, samplesRead;
+} flacLoader_t;
 
 static FLAC__StreamDecoderReadStatus read_callback(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data);
 static FLAC__StreamDecoderSeekStatus seek_callback(const FLAC__StreamDecoder *decoder, FLAC__uint64 absolute_byte_offset, void *client_data);
@@ -46,19 +51,17 @@ static void metadata_callback(const FLAC__StreamDecoder *decoder, const FLAC__St
 static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[], void *client_data);
 static void error_callback(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status, void *client_data);
 
-bool loadFLAC(FILE *f, uint32_t filesize)
+bool loadFLAC(FILE *f, uint32_t filesize, sample_t *s)
 {
-	s = &tmpSmp;
+	flacLoader_t fl;
+	memset(&fl, 0, sizeof (fl));
+	fl.f = f;
+	fl.s = s;
+	fl.stereoSampleLoadMode = -1;
 
 	s->volume = 64;
 	s->panning = 128;
 
-	numChannels = 0;
-	bitDepth = 0;
-	sampleLength = 0;
-	sampleRate = 0;
-	samplesRead = 0;
-
 	FLAC__StreamDecoder *decoder = FLAC__stream_decoder_new();
 	if (decoder == NULL)
 	{
@@ -76,7 +79,7 @@ bool loadFLAC(FILE *f, uint32_t filesize)
 			tell_callback, length_callback,
 			eof_callback, write_callback,
 			metadata_callback, error_callback,
-			f
+			&fl
 		);
 
 	if (initStatus != FLAC__STREAM_DECODER_INIT_STATUS_OK)
@@ -94,7 +97,7 @@ bool loadFLAC(FILE *f, uint32_t filesize)
 	FLAC__stream_decoder_finish(decoder);
 	FLAC__stream_decoder_delete(decoder);
 
-	setSampleC4Hz(s, sampleRate);
+	setSampleC4Hz(s, fl.sampleRate);
 
 	return true;
 
@@ -108,7 +111,7 @@ error:
 
 static FLAC__StreamDecoderReadStatus read_callback(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data)
 {
-	FILE *file = (FILE *)client_data;
+	FILE *file = ((flacLoader_t *)client_data)->f;
 	if (*bytes > 0)
 	{
 		*bytes = fread(buffer, sizeof (FLAC__byte), *bytes, file);
@@ -129,7 +132,7 @@ static FLAC__StreamDecoderReadStatus read_callback(const FLAC__StreamDecoder *de
 
 static FLAC__StreamDecoderSeekStatus seek_callback(const FLAC__StreamDecoder *decoder, FLAC__uint64 absolute_byte_offset, void *client_data)
 {
-	FILE *file = (FILE *)client_data;
+	FILE *file = ((flacLoader_t *)client_data)->f;
 
 	if (absolute_byte_offset > INT32_MAX)
 		return FLAC__STREAM_DECODER_SEEK_STATUS_ERROR;
@@ -144,7 +147,7 @@ static FLAC__StreamDecoderSeekStatus seek_callback(const FLAC__StreamDecoder *de
 
 static FLAC__StreamDecoderTellStatus tell_callback(const FLAC__StreamDecoder *decoder, FLAC__uint64 *absolute_byte_offset, void *client_data)
 {
-	FILE *file = (FILE *)client_data;
+	FILE *file = ((flacLoader_t *)client_data)->f;
 	int32_t pos = ftell(file);
 
 	if (pos < 0)
@@ -162,7 +165,7 @@ static FLAC__StreamDecoderTellStatus tell_callback(const FLAC__StreamDecoder *de
 
 static FLAC__StreamDecoderLengthStatus length_callback(const FLAC__StreamDecoder *decoder, FLAC__uint64 *stream_length, void *client_data)
 {
-	FILE *file = (FILE *)client_data;
+	FILE *file = ((flacLoader_t *)client_data)->f;
 	struct stat filestats;
 
 	if (fstat(fileno(file), &filestats) != 0)
@@ -180,7 +183,7 @@ static FLAC__StreamDecoderLengthStatus length_callback(const FLAC__StreamDecoder
 
 static FLAC__bool eof_callback(const FLAC__StreamDecoder *decoder, void *client_data)
 {
-	FILE *file = (FILE *)client_data;
+	FILE *file = ((flacLoader_t *)client_data)->f;
 	return feof(file) ? true : false;
 
 	(void)decoder;
@@ -188,27 +191,30 @@ static FLAC__bool eof_callback(const FLAC__StreamDecoder *decoder, void *client_
 
 static void metadata_callback(const FLAC__StreamDecoder *decoder, const FLAC__StreamMetadata *metadata, void *client_data)
 {
+	flacLoader_t *fl = (flacLoader_t *)client_data;
+	sample_t *s = fl->s;
+
 	if (metadata->type == FLAC__METADATA_TYPE_STREAMINFO && metadata->data.stream_info.total_samples != 0)
 	{
-		bitDepth = metadata->data.stream_info.bits_per_sample;
-		numChannels = metadata->data.stream_info.channels;
-		sampleRate = metadata->data.stream_info.sample_rate;
+		fl->bitDepth = metadata->data.stream_info.bits_per_sample;
+		fl->numChannels = metadata->data.stream_info.channels;
+		fl->sampleRate = metadata->data.stream_info.sample_rate;
 
-		sample16Bit = (bitDepth != 8);
+		fl->sample16Bit = (fl->bitDepth != 8);
 
 		int64_t tmp64 = metadata->data.stream_info.total_samples;
 		if (tmp64 > MAX_SAMPLE_LEN)
 			tmp64 = MAX_SAMPLE_LEN;
 
-		sampleLength = (uint32_t)tmp64;
+		fl->sampleLength = (uint32_t)tmp64;
 
-		s->length = sampleLength;
-		if (sample16Bit)
+		s->length = fl->sampleLength;
+		if (fl->sample16Bit)
 			s->flags |= SAMPLE_16BIT;
 
-		stereoSampleLoadMode = -1;
-		if (numChannels == 2)
-			stereoSampleLoadMode = loaderSysReq(4, "System request", "This is a stereo sample...", NULL);
+		fl->stereoSampleLoadMode = -1;
+		if (fl->numChannels == 2)
+			fl->stereoSampleLoadMode = askStereoSampleLoadMode();
 	}
 
 	// check for RIFF chunks (loop/vol/pan information)
@@ -278,8 +284,6 @@ static void metadata_callback(const FLAC__StreamDecoder *decoder, const FLAC__St
 
 				memcpy(s->name, &tag[6], length);
 				s->name[22] = '\0';
-
-				smpFilenameSet = true;
 			}
 
 			// the following tags haven't been tested!
@@ -306,29 +310,31 @@ static void metadata_callback(const FLAC__StreamDecoder *decoder, const FLAC__St
 			}
 
 			if (tmpSampleRate > 0)
-				sampleRate = tmpSampleRate;
+				fl->sampleRate = tmpSampleRate;
 		}
 	}
 
-	(void)client_data;
 	(void)decoder;
 }
 
 static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[], void *client_data)
 {
-	if (sampleLength == 0 || numChannels == 0)
+	flacLoader_t *fl = (flacLoader_t *)client_data;
+	sample_t *s = fl->s;
+
+	if (fl->sampleLength == 0 || fl->numChannels == 0)
 	{
 		loaderMsgBox("Error loading sample: The sample is empty or corrupt!");
 		return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
 	}
 
-	if (numChannels > 2)
+	if (fl->numChannels > 2)
 	{
 		loaderMsgBox("Error loading sample: Only mono/stereo FLACs are supported!");
 		return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
 	}
 
-	if (bitDepth != 8 && bitDepth != 16 && bitDepth != 24)
+	if (fl->bitDepth != 8 && fl->bitDepth != 16 && fl->bitDepth != 24)
 	{
 		loaderMsgBox("Error loading sample: Only FLACs with a bitdepth of 8/16/24 are supported!");
 		return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
@@ -336,31 +342,31 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 
 	if (frame->header.number.sample_number == 0)
 	{
-		if (!allocateSmpData(s, sampleLength, sample16Bit))
+		if (!allocateSmpData(s, fl->sampleLength, fl->sample16Bit))
 		{
 			loaderMsgBox("Error loading sample: Not enough memory!");
 			return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
 		}
 
-		samplesRead = 0;
+		fl->samplesRead = 0;
 	}
 
 	uint32_t blockSize = frame->header.blocksize;
 
-	const uint32_t samplesAllocated = sampleLength;
-	if (samplesRead+blockSize > samplesAllocated)
-		blockSize = samplesAllocated-samplesRead;
+	const uint32_t samplesAllocated = fl->sampleLength;
+	if (fl->samplesRead+blockSize > samplesAllocated)
+		blockSize = samplesAllocated-fl->samplesRead;
 
-	if (stereoSampleLoadMode == STEREO_SAMPLE_CONVERT) // mix to mono
+	if (fl->stereoSampleLoadMode == STEREO_SAMPLE_CONVERT) // mix to mono
 	{
 		const int32_t *src32_L = buffer[0];
 		const int32_t *src32_R = buffer[1];
 
-		switch (bitDepth)
+		switch (fl->bitDepth)
 		{
 			case 8:
 			{
-				int8_t *dst8 = s->dataPtr + samplesRead;
+				int8_t *dst8 = s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst8[i] = (int8_t)((src32_L[i] + src32_R[i]) >> 1);
 			}
@@ -368,7 +374,7 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 
 			case 16:
 			{
-				int16_t *dst16 = (int16_t *)s->dataPtr + samplesRead;
+				int16_t *dst16 = (int16_t *)s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst16[i] = (int16_t)((src32_L[i] + src32_R[i]) >> 1);
 			}
@@ -376,7 +382,7 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 
 			case 24:
 			{
-				int16_t *dst16 = (int16_t *)s->dataPtr + samplesRead;
+				int16_t *dst16 = (int16_t *)s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst16[i] = (int16_t)((src32_L[i] + src32_R[i]) >> ((24-16)+1));
 			}
@@ -387,13 +393,13 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 	}
 	else // mono sample
 	{
-		const int32_t *src32 = (stereoSampleLoadMode == STEREO_SAMPLE_READ_RIGHT) ? buffer[1] : buffer[0];
+		const int32_t *src32 = (fl->stereoSampleLoadMode == STEREO_SAMPLE_READ_RIGHT) ? buffer[1] : buffer[0];
 
-		switch (bitDepth)
+		switch (fl->bitDepth)
 		{
 			case 8:
 			{
-				int8_t *dst8 = s->dataPtr + samplesRead;
+				int8_t *dst8 = s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst8[i] = (int8_t)src32[i];
 			}
@@ -401,7 +407,7 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 
 			case 16:
 			{
-				int16_t *dst16 = (int16_t *)s->dataPtr + samplesRead;
+				int16_t *dst16 = (int16_t *)s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst16[i] = (int16_t)src32[i];
 			}
@@ -409,7 +415,7 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 
 			case 24:
 			{
-				int16_t *dst16 = (int16_t *)s->dataPtr + samplesRead;
+				int16_t *dst16 = (int16_t *)s->dataPtr + fl->samplesRead;
 				for (uint32_t i = 0; i < blockSize; i++)
 					dst16[i] = (int16_t)(src32[i] >> (24-16));
 			}
@@ -419,10 +425,9 @@ static FLAC__StreamDecoderWriteStatus write_callback(const FLAC__StreamDecoder *
 		}
 	}
 
-	samplesRead += blockSize;
+	fl->samplesRead += blockSize;
 	return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 
-	(void)client_data;
 	(void)decoder;
 }
 
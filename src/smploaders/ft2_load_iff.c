@@ -14,11 +14,10 @@
 #include "../ft2_sysreqs.h"
 #include "../ft2_sample_loader.h"
 
-bool loadIFF(FILE *f, uint32_t filesize)
+bool loadIFF(FILE *f, uint32_t filesize, sample_t *s)
 {
 	char hdr[4+1];
 	uint32_t length, volume, loopStart, loopLength, sampleRate;
-	sample_t *s = &tmpSmp;
 
 	if (filesize < 12)
 	{
@@ -155,8 +154,6 @@ bool loadIFF(FILE *f, uint32_t filesize)
 
 		fread(s->name, 1, nameLen, f);
 		s->name[22] = '\0';
-
-		smpFilenameSet = true;
 	}
 
 	return true;
@@ -11,23 +11,11 @@
 #include "../ft2_sysreqs.h"
 #include "../ft2_sample_loader.h"
 
-bool loadRAW(FILE *f, uint32_t filesize)
+bool loadRAW(FILE *f, uint32_t filesize, sample_t *s)
 {
-	sample_t *s = &tmpSmp;
-
-	if (!allocateSmpData(s, filesize, false))
-	{
-		loaderMsgBox("Not enough memory!");
-		return false;
-	}
-
-	if (fread(s->dataPtr, filesize, 1, f) != 1)
-	{
-		okBoxThreadSafe(0, "System message", "General I/O error during loading! Is the file in use?", NULL);
+	if (!loadPCMSampleData(f, s, filesize, PCM_FORMAT_S8, false, 1, -1))
 		return false;
-	}
 
-	s->length = filesize;
 	s->volume = 64;
 	s->panning = 128;
 
@@ -22,17 +22,10 @@ enum
 
 static bool wavIsStereo(FILE *f);
 
-bool loadWAV(FILE *f, uint32_t filesize)
+bool loadWAV(FILE *f, uint32_t filesize, sample_t *s)
 {
-	uint8_t *audioDataU8;
-	int16_t *audioDataS16, *ptr16;
 	uint16_t audioFormat, numChannels, bitsPerSample;
-	int32_t *audioDataS32;
-	uint32_t i, sampleRate, sampleLength;
-	uint32_t len32;
-	float *fAudioDataFloat;
-	double *dAudioDataDouble;
-	sample_t *s = &tmpSmp;
+	uint32_t sampleRate, sampleLength;
 
 	if (filesize < 12)
 	{
@@ -169,7 +162,8 @@ bool loadWAV(FILE *f, uint32_t filesize)
 		return false;
 	}
 
-	if (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32 && bitsPerSample != 64)
+	if (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32 &&
+		!(audioFormat == WAV_FORMAT_IEEE_FLOAT && bitsPerSample == 64))
 	{
 		loaderMsgBox("Error loading sample: Unsupported bitdepth!");
 		return false;
@@ -180,423 +174,28 @@ bool loadWAV(FILE *f, uint32_t filesize)
 
 	int16_t stereoSampleLoadMode = -1;
 	if (wavIsStereo(f))
-		stereoSampleLoadMode = loaderSysReq(4, "System request", "This is a stereo sample...", NULL);
-
-	if (bitsPerSample == 8) // 8-BIT INTEGER SAMPLE
-	{
-		if (!allocateSmpData(s, sampleLength, false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, 1, f) != 1)
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataU8 = (uint8_t *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						audioDataU8[i] = audioDataU8[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataU8[i] = audioDataU8[(i * 2) + 1];
-
-					audioDataU8[i] = 128;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataU8[i] = (audioDataU8[(i * 2) + 0] + audioDataU8[(i * 2) + 1]) >> 1;
-
-					audioDataU8[i] = 128;
-				}
-				break;
-			}
-		}
-
-		// convert from unsigned to signed
-		for (i = 0; i < sampleLength; i++)
-			s->dataPtr[i] ^= 0x80;
-	}
-	else if (bitsPerSample == 16) // 16-BIT INTEGER SAMPLE
-	{
-		sampleLength /= 2;
-		if (!allocateSmpData(s, sampleLength, true))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, 2, f) != 2)
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataS16 = (int16_t *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						audioDataS16[i] = audioDataS16[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS16[i] = audioDataS16[(i * 2) + 1];
-
-					audioDataS16[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int32_t smp32 = audioDataS16[(i * 2) + 0] + audioDataS16[(i * 2) + 1];
-						audioDataS16[i] = (int16_t)(smp32 >> 1);
-					}
-
-					audioDataS16[i] = 0;
-				}
-				break;
-			}
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (bitsPerSample == 24) // 24-BIT INTEGER SAMPLE
-	{
-		sampleLength /= 3;
-		if (!allocateSmpData(s, sampleLength * sizeof (int32_t), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(&s->dataPtr[sampleLength], sampleLength, 3, f) != 3)
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataS32 = (int32_t *)s->dataPtr;
-
-		// convert to 32-bit
-		audioDataU8 = (uint8_t *)s->dataPtr + sampleLength;
-		for (i = 0; i < sampleLength; i++)
-		{
-			audioDataS32[i] = (audioDataU8[2] << 24) | (audioDataU8[1] << 16) | (audioDataU8[0] << 8);
-			audioDataU8 += 3;
-		}
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 1];
-
-					audioDataS32[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int64_t smp64 = audioDataS32[(i * 2) + 0];
-						smp64 += audioDataS32[(i * 2) + 1];
-						smp64 >>= 1;
-
-						audioDataS32[i] = (int32_t)smp64;
-					}
-
-					audioDataS32[i] = 0;
-				}
-				break;
-			}
-		}
-
-		normalizeSigned32Bit(audioDataS32, sampleLength);
-
-		ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			ptr16[i] = audioDataS32[i] >> 16;
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (audioFormat == WAV_FORMAT_PCM && bitsPerSample == 32) // 32-BIT INTEGER SAMPLE
-	{
-		sampleLength /= sizeof (int32_t);
-		if (!allocateSmpData(s, sampleLength * sizeof (int32_t), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (int32_t), f) != sizeof (int32_t))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		audioDataS32 = (int32_t *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						audioDataS32[i] = audioDataS32[(i * 2) + 1];
-
-					audioDataS32[i] = 0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-					{
-						int64_t smp64 = audioDataS32[(i * 2) + 0];
-						smp64 += audioDataS32[(i * 2) + 1];
-						smp64 >>= 1;
-
-						audioDataS32[i] = (int32_t)smp64;
-					}
-
-					audioDataS32[i] = 0;
-				}
-				break;
-			}
-		}
-
-		normalizeSigned32Bit(audioDataS32, sampleLength);
-
-		ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-			ptr16[i] = audioDataS32[i] >> 16;
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (audioFormat == WAV_FORMAT_IEEE_FLOAT && bitsPerSample == 32) // 32-BIT FLOATING POINT SAMPLE
-	{
-		sampleLength /= sizeof (float);
-		if (!allocateSmpData(s, sampleLength * sizeof (float), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (float), f) != sizeof (float))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		fAudioDataFloat = (float *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						fAudioDataFloat[i] = fAudioDataFloat[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						fAudioDataFloat[i] = fAudioDataFloat[(i * 2) + 1];
-
-					fAudioDataFloat[i] = 0.0f;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						fAudioDataFloat[i] = (fAudioDataFloat[(i * 2) + 0] + fAudioDataFloat[(i * 2) + 1]) * 0.5f;
-
-					fAudioDataFloat[i] = 0.0f;
-				}
-				break;
-			}
-		}
-
-		normalize32BitFloatToSigned16Bit(fAudioDataFloat, sampleLength);
-
-		ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-		{
-			const int32_t smp32 = (const int32_t)fAudioDataFloat[i];
-			ptr16[i] = (int16_t)smp32;
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-	else if (audioFormat == WAV_FORMAT_IEEE_FLOAT && bitsPerSample == 64) // 64-BIT FLOATING POINT SAMPLE
-	{
-		sampleLength /= sizeof (double);
-		if (!allocateSmpData(s, sampleLength * sizeof (double), false))
-		{
-			loaderMsgBox("Not enough memory!");
-			return false;
-		}
-
-		if (fread(s->dataPtr, sampleLength, sizeof (double), f) != sizeof (double))
-		{
-			loaderMsgBox("General I/O error during loading! Is the file in use?");
-			return false;
-		}
-
-		dAudioDataDouble = (double *)s->dataPtr;
-
-		// stereo conversion
-		if (numChannels == 2)
-		{
-			sampleLength /= 2;
-			switch (stereoSampleLoadMode)
-			{
-				case STEREO_SAMPLE_READ_LEFT:
-				{
-					// remove right channel data
-					for (i = 1; i < sampleLength; i++)
-						dAudioDataDouble[i] = dAudioDataDouble[(i * 2) + 0];
-				}
-				break;
-
-				case STEREO_SAMPLE_READ_RIGHT:
-				{
-					// remove left channel data
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						dAudioDataDouble[i] = dAudioDataDouble[(i * 2) + 1];
-
-					dAudioDataDouble[i] = 0.0;
-				}
-				break;
-
-				default:
-				case STEREO_SAMPLE_CONVERT:
-				{
-					// mix stereo to mono
-					len32 = sampleLength - 1;
-					for (i = 0; i < len32; i++)
-						dAudioDataDouble[i] = (dAudioDataDouble[(i * 2) + 0] + dAudioDataDouble[(i * 2) + 1]) * 0.5;
-
-					dAudioDataDouble[i] = 0.0;
-				}
-				break;
-			}
-		}
-
-		normalize64BitFloatToSigned16Bit(dAudioDataDouble, sampleLength);
-
-		ptr16 = (int16_t *)s->dataPtr;
-		for (i = 0; i < sampleLength; i++)
-		{
-			const int32_t smp32 = (const int32_t)dAudioDataDouble[i];
-			ptr16[i] = (int16_t)smp32;
-		}
-
-		s->flags |= SAMPLE_16BIT;
-	}
-
-	if (sampleLength > MAX_SAMPLE_LEN)
-		sampleLength = MAX_SAMPLE_LEN;
-
-	bool sample16Bit = !!(s->flags & SAMPLE_16BIT);
-	reallocateSmpData(s, sampleLength, sample16Bit); // readjust memory needed
+		stereoSampleLoadMode = askStereoSampleLoadMode();
+
+	int8_t pcmFormat;
+	if (audioFormat == WAV_FORMAT_IEEE_FLOAT)
+		pcmFormat = (bitsPerSample == 64) ? PCM_FORMAT_DOUBLE : PCM_FORMAT_FLOAT;
+	else if (bitsPerSample == 8)
+		pcmFormat = PCM_FORMAT_U8;
+	else if (bitsPerSample == 16)
+		pcmFormat = PCM_FORMAT_S16;
+	else if (bitsPerSample == 24)
+		pcmFormat = PCM_FORMAT_S24;
+	else
+		pcmFormat = PCM_FORMAT_S32;
+
+	const uint32_t numFrames = sampleLength / ((bitsPerSample / 8) * numChannels);
+	if (!loadPCMSampleData(f, s, numFrames, pcmFormat, false, (uint8_t)numChannels, stereoSampleLoadMode))
+		return false;
 
 	setSampleC4Hz(s, sampleRate);
 
 	s->volume = 64;
 	s->panning = 128;
-	s->length = sampleLength;
 
 	// ---- READ "smpl" chunk ----
 	if (smplPtr != 0 && smplLen > 52)
@@ -615,7 +214,7 @@ bool loadWAV(FILE *f, uint32_t filesize)
 			fread(&loopEnd, 4, 1, f);
 
 			loopEnd++;
-			if (loopEnd <= sampleLength)
+			if (loopEnd <= (uint32_t)s->length)
 			{
 				s->loopStart = loopStart;
 				s->loopLength = loopEnd - loopStart;
@@ -667,8 +266,6 @@ bool loadWAV(FILE *f, uint32_t filesize)
 
 		fread(s->name, 1, inamLen, f);
 		s->name[22] = '\0';
-
-		smpFilenameSet = true;
 	}
 
 	return true;